@@ -39,7 +39,12 @@ public class BDC_LevelSelector : ModuleRules
 				"ContentBrowser",
 				"AssetRegistry",
 				"DeveloperSettings",
-				"LevelEditor"
+				"LevelEditor",
+				"Projects",
+				"Json",
+				"DesktopPlatform",
+				"ImageWrapper",
+				"SourceControl"
 			}
 		);
 	}
@@ -9,6 +9,14 @@
 #include "BDC_LevelSelector.h"
 
 #include "BDC_LevelSelectorSettings.h"
+#include "BDC_LevelSelectorUserSettings.h"
+#include "LevelSelectorIndex.h"
+#include "LevelSelectorMetadataCache.h"
+#include "LevelSelectorPrefetcher.h"
+#include "LevelSelectorStats.h"
+#include "LevelSelectorStyle.h"
+#include "LevelSelectorSwitchTelemetry.h"
+#include "LevelSelectorThumbnailCache.h"
 #include "SLevelSelectorComboBox.h"
 #include "SLevelSelectorCameraOverlay.h"
 #include "LevelEditor.h"
@@ -16,7 +24,7 @@
 #include "Editor.h"
 #include "Misc/CoreDelegates.h"
 
-DEFINE_LOG_CATEGORY_STATIC(LogBDCLevelSelector, All, All);
+DEFINE_LOG_CATEGORY(LogBDCLevelSelector);
 
 #define LOCTEXT_NAMESPACE "FBDC_LevelSelectorModule"
 
@@ -25,12 +33,30 @@ void FBDC_LevelSelectorModule::StartupModule()
 {
 	if (!IsRunningCommandlet())
 	{
+		FLevelSelectorStyle::Initialize();
+
+		LevelIndex = MakeShared<FLevelSelectorIndex>();
+		LevelIndex->Initialize();
+
+		Prefetcher = MakeShared<FLevelSelectorPrefetcher>();
+		Prefetcher->Initialize();
+
+		SwitchTelemetry = MakeShared<FLevelSelectorSwitchTelemetry>();
+		SwitchTelemetry->Initialize();
+
+		MetadataCache = MakeShared<FLevelSelectorMetadataCache>();
+		MetadataCache->Initialize();
+
+		ThumbnailCache = MakeShared<FLevelSelectorThumbnailCache>();
+		ThumbnailCache->Initialize();
+
 		FLevelEditorModule& LevelEditorModule = FModuleManager::LoadModuleChecked<FLevelEditorModule>("LevelEditor");
 		ToolbarExtender = MakeShareable(new FExtender);
 		ToolbarExtender->AddToolBarExtension("Play",EExtensionHook::After, nullptr, FToolBarExtensionDelegate::CreateRaw(this, &FBDC_LevelSelectorModule::AddToolbarExtension));
 		LevelEditorModule.GetToolBarExtensibilityManager()->AddExtender(ToolbarExtender);
 		FEditorDelegates::OnMapOpened.AddRaw(this, &FBDC_LevelSelectorModule::OnMapOpened);
 		FCoreDelegates::OnPostEngineInit.AddRaw(this, &FBDC_LevelSelectorModule::OnPostEngineInit);
+		FCoreDelegates::OnEnginePreExit.AddRaw(this, &FBDC_LevelSelectorModule::OnEnginePreExit);
 	}
 }
 
@@ -43,6 +69,8 @@ void FBDC_LevelSelectorModule::ShutdownModule()
 	}
 	FEditorDelegates::OnMapOpened.RemoveAll(this);
 	FCoreDelegates::OnPostEngineInit.RemoveAll(this);
+	FCoreDelegates::OnEnginePreExit.RemoveAll(this);
+	OnEnginePreExit();
 
 	if (OverlayWidget.IsValid())
 	{
@@ -59,15 +87,68 @@ void FBDC_LevelSelectorModule::ShutdownModule()
 		}
 	}
 	OverlayWidget.Reset();
+
+	LevelSelectorWidget.Reset();
+	if (Prefetcher.IsValid())
+	{
+		Prefetcher->Shutdown();
+		Prefetcher.Reset();
+	}
+	if (SwitchTelemetry.IsValid())
+	{
+		SwitchTelemetry->Shutdown();
+		SwitchTelemetry.Reset();
+	}
+	if (MetadataCache.IsValid())
+	{
+		MetadataCache->Shutdown();
+		MetadataCache.Reset();
+	}
+	if (ThumbnailCache.IsValid())
+	{
+		ThumbnailCache->Shutdown();
+		ThumbnailCache.Reset();
+	}
+	if (LevelIndex.IsValid())
+	{
+		LevelIndex->Shutdown();
+		LevelIndex.Reset();
+	}
+	FLevelSelectorStyle::Shutdown();
+}
+#pragma endregion
+
+#pragma region Settings Persistence
+void FBDC_LevelSelectorModule::OnEnginePreExit()
+{
+	if (UObjectInitialized())
+	{
+		GetMutableDefault<UBDC_LevelSelectorSettings>()->FlushConfigSave();
+		GetMutableDefault<UBDC_LevelSelectorUserSettings>()->FlushConfigSave();
+	}
+	if (SwitchTelemetry.IsValid())
+	{
+		SwitchTelemetry->FlushSave();
+	}
 }
 #pragma endregion
 
 #pragma region Toolbar Extension
 void FBDC_LevelSelectorModule::AddToolbarExtension(FToolBarBuilder& Builder)
 {
+	LEVELSELECTOR_SCOPE_CYCLE_COUNTER(STAT_LevelSelector_ToolbarConstruct);
+	const double StartTime = FPlatformTime::Seconds();
 	Builder.AddWidget(
 		SAssignNew(LevelSelectorWidget, SLevelSelectorComboBox)
+		.LevelIndex(LevelIndex)
+		.Prefetcher(Prefetcher)
+		.SwitchTelemetry(SwitchTelemetry)
+		.MetadataCache(MetadataCache)
+		.ThumbnailCache(ThumbnailCache)
 	);
+
+	// Runs before stats or a trace can be enabled by hand, -LogCmds="LogBDCLevelSelector Verbose" shows it from the first toolbar on.
+	UE_LOG(LogBDCLevelSelector, Verbose, TEXT("Constructed the toolbar widget in %.2f ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
 }
 #pragma endregion
 
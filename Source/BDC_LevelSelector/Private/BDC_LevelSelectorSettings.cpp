@@ -7,31 +7,231 @@
 * and are used with permission.
 */
 #include "BDC_LevelSelectorSettings.h"
+#include "BDC_LevelSelector.h"
+#include "LevelSelectorCameraFavoriteStore.h"
+#include "LevelSelectorCameraFavoriteTransfer.h"
+#include "LevelSelectorConfigWriter.h"
 #include "Engine/World.h"
 #include "GameplayTagContainer.h"
+#include "HAL/IConsoleManager.h"
+
+static FAutoConsoleCommand CmdLevelSelectorSaveStats(
+	TEXT("LevelSelector.Settings.SaveStats"),
+	TEXT("Prints how many level selector settings saves were requested, coalesced and written."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		const FLevelSelectorConfigWriterStats& Stats = GetDefault<UBDC_LevelSelectorSettings>()->GetConfigWriterStats();
+		UE_LOG(LogBDCLevelSelector, Display, TEXT("Level selector settings: %d save requests, %d coalesced, %d writes issued."),
+			Stats.RequestedSaves, Stats.CoalescedSaves, Stats.IssuedWrites);
+	}));
 
 void UBDC_LevelSelectorSettings::SaveToProjectDefaultConfig()
 {
+	if (ConfigWriter.IsValid() && ConfigWriter->HasPendingSave())
+	{
+		ConfigWriter->Flush();
+		return;
+	}
 	TryUpdateDefaultConfigFile();
 }
 
+void UBDC_LevelSelectorSettings::RequestConfigSave()
+{
+	if (!ConfigWriter.IsValid())
+	{
+		ConfigWriter = MakeShared<FLevelSelectorConfigWriter>(this);
+	}
+	ConfigWriter->RequestSave(SaveQuietPeriodSeconds);
+}
+
+void UBDC_LevelSelectorSettings::FlushConfigSave()
+{
+	if (ConfigWriter.IsValid())
+	{
+		ConfigWriter->Flush();
+	}
+}
+
+void UBDC_LevelSelectorSettings::CancelConfigSave()
+{
+	if (ConfigWriter.IsValid())
+	{
+		ConfigWriter->Cancel();
+	}
+}
+
+bool UBDC_LevelSelectorSettings::HasPendingConfigSave() const
+{
+	return ConfigWriter.IsValid() && ConfigWriter->HasPendingSave();
+}
+
+const FLevelSelectorConfigWriterStats& UBDC_LevelSelectorSettings::GetConfigWriterStats() const
+{
+	static const FLevelSelectorConfigWriterStats EmptyStats;
+	return ConfigWriter.IsValid() ? ConfigWriter->GetStats() : EmptyStats;
+}
+
 UBDC_LevelSelectorSettings::UBDC_LevelSelectorSettings():
-	bDisplayCameraFavoritesOverlay(false)
+	bDisplayCameraFavoritesOverlay(false),
+	SaveQuietPeriodSeconds(2.0f),
+	CameraFavoriteStore(MakeShared<FLevelSelectorCameraFavoriteStore>())
 {
 	CategoryName = TEXT("Plugins");
 	SectionName = TEXT("BDC Level Selector");
+	IncludedContentRoots.Add(TEXT("/Game/"));
+}
+
+void UBDC_LevelSelectorSettings::PostInitProperties()
+{
+	Super::PostInitProperties();
+	const bool bMigratedTags = MigrateLegacyLevelTags();
+	const bool bMigratedCameraFavorites = MigrateLegacyCameraFavorites();
+	if ((bMigratedTags || bMigratedCameraFavorites) && HasAnyFlags(RF_ClassDefaultObject))
+	{
+		RequestConfigSave();
+	}
+	RebuildLevelLookups();
+}
+
+void UBDC_LevelSelectorSettings::PostReloadConfig(FProperty* PropertyThatWasLoaded)
+{
+	Super::PostReloadConfig(PropertyThatWasLoaded);
+	const bool bMigratedTags = MigrateLegacyLevelTags();
+	const bool bMigratedCameraFavorites = MigrateLegacyCameraFavorites();
+	if ((bMigratedTags || bMigratedCameraFavorites) && HasAnyFlags(RF_ClassDefaultObject))
+	{
+		RequestConfigSave();
+	}
+	RebuildLevelLookups();
+	CameraFavoritesChangedDelegate.Broadcast(FSoftObjectPath());
+}
+
+bool UBDC_LevelSelectorSettings::MigrateLegacyLevelTags()
+{
+	if (LevelTags.IsEmpty())
+	{
+		return false;
+	}
+
+	for (const auto& Pair : LevelTags)
+	{
+		if (!Pair.Key.IsNull() && Pair.Value.IsValid())
+		{
+			LevelTagContainers.FindOrAdd(Pair.Key).AddTag(Pair.Value);
+		}
+	}
+	LevelTags.Reset();
+	return true;
+}
+
+bool UBDC_LevelSelectorSettings::MigrateLegacyCameraFavorites()
+{
+	// Only the default object owns the files, instances must not write them a second time.
+	if (HoldFavorites.IsEmpty() || !HasAnyFlags(RF_ClassDefaultObject))
+	{
+		return false;
+	}
+
+	// Favorites already in a level's file win over the ini, in case the ini came back through source control.
+	// Levels whose file could not be written stay in the ini and are tried again on the next editor start.
+	int32 NumMigrated = 0;
+	int32 NumFailed = 0;
+	for (auto It = HoldFavorites.CreateIterator(); It; ++It)
+	{
+		if (FailedCameraFavoriteMigrations.Contains(It->Key))
+		{
+			continue;
+		}
+
+		bool bChanged = false;
+		if (!It->Key.IsNull() && !It->Value.HoldFavorites.IsEmpty())
+		{
+			const FCameraFavorite& Legacy = It->Value;
+			const bool bSaved = CameraFavoriteStore->Modify(It->Key.ToSoftObjectPath().GetLongPackageFName(), [&Legacy, &bChanged](FCameraFavorite& Favorites)
+			{
+				for (const auto& Favorite : Legacy.HoldFavorites)
+				{
+					if (!Favorites.HoldFavorites.Contains(Favorite.Key))
+					{
+						Favorites.HoldFavorites.Add(Favorite.Key, Favorite.Value);
+						bChanged = true;
+					}
+				}
+				return bChanged;
+			});
+			if (bChanged && !bSaved)
+			{
+				FailedCameraFavoriteMigrations.Add(It->Key);
+				++NumFailed;
+				continue;
+			}
+		}
+		It.RemoveCurrent();
+		++NumMigrated;
+	}
+
+	if (NumFailed > 0)
+	{
+		UE_LOG(LogBDCLevelSelector, Warning, TEXT("Could not write the camera favorites of %d levels to %s, they are kept in the config."),
+			NumFailed, *FLevelSelectorCameraFavoriteStore::GetRootDir());
+	}
+	if (NumMigrated > 0)
+	{
+		UE_LOG(LogBDCLevelSelector, Log, TEXT("Moved the camera favorites of %d levels from the config into %s."), NumMigrated, *FLevelSelectorCameraFavoriteStore::GetRootDir());
+	}
+	return NumMigrated > 0;
+}
+
+#if WITH_EDITOR
+void UBDC_LevelSelectorSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	RebuildLevelLookups();
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+}
+#endif
+
+void UBDC_LevelSelectorSettings::RebuildLevelLookups()
+{
+	FavoritePackages.Reset();
+	FavoritePackages.Reserve(FavoriteLevels.Num());
+	for (const TSoftObjectPtr<UWorld>& Level : FavoriteLevels)
+	{
+		if (!Level.IsNull())
+		{
+			FavoritePackages.Add(Level.ToSoftObjectPath().GetLongPackageFName());
+		}
+	}
+
+	LevelTagsByPackage.Reset();
+	LevelTagsByPackage.Reserve(LevelTagContainers.Num());
+	for (const auto& Pair : LevelTagContainers)
+	{
+		if (!Pair.Key.IsNull() && !Pair.Value.IsEmpty())
+		{
+			LevelTagsByPackage.Add(Pair.Key.ToSoftObjectPath().GetLongPackageFName(), Pair.Value);
+		}
+	}
 }
 
 void UBDC_LevelSelectorSettings::AddFavorite(UWorld* TargetedLevel)
 {
 	if (TargetedLevel)
 	{
-		auto SoftLevel = TSoftObjectPtr<UWorld>(TargetedLevel);
-		if (!FavoriteLevels.Contains(SoftLevel))
+		AddFavorite(FSoftObjectPath(TargetedLevel));
+	}
+}
+
+void UBDC_LevelSelectorSettings::AddFavorite(const FSoftObjectPath& LevelPath)
+{
+	if (LevelPath.IsValid())
+	{
+		bool bAlreadyFavorite = false;
+		FavoritePackages.Add(LevelPath.GetLongPackageFName(), &bAlreadyFavorite);
+		if (!bAlreadyFavorite)
 		{
-			FavoriteLevels.Add(SoftLevel);
+			FavoriteLevels.Add(TSoftObjectPtr<UWorld>(LevelPath));
 		}
-		SaveToProjectDefaultConfig();
+		RequestConfigSave();
 	}
 }
 
@@ -39,31 +239,183 @@ void UBDC_LevelSelectorSettings::RemoveFavorite(UWorld* TargetedLevel)
 {
 	if (TargetedLevel)
 	{
-		auto SoftLevel = TSoftObjectPtr<UWorld>(TargetedLevel);
-		FavoriteLevels.Remove(SoftLevel);
-		SaveToProjectDefaultConfig();
+		RemoveFavorite(FSoftObjectPath(TargetedLevel));
+	}
+}
+
+void UBDC_LevelSelectorSettings::RemoveFavorite(const FSoftObjectPath& LevelPath)
+{
+	if (LevelPath.IsValid())
+	{
+		if (FavoritePackages.Remove(LevelPath.GetLongPackageFName()) > 0)
+		{
+			FavoriteLevels.Remove(TSoftObjectPtr<UWorld>(LevelPath));
+		}
+		RequestConfigSave();
 	}
 }
 
-void UBDC_LevelSelectorSettings::SetLevelTag(UWorld* TargetedLevel, FGameplayTag NewTag)
+void UBDC_LevelSelectorSettings::SetLevelTags(UWorld* TargetedLevel, const FGameplayTagContainer& NewTags)
 {
 	if (TargetedLevel)
 	{
-		auto SoftLevel = TSoftObjectPtr<UWorld>(TargetedLevel);
-		LevelTags.Add(SoftLevel, NewTag);
-		SaveToProjectDefaultConfig();
+		SetLevelTags(FSoftObjectPath(TargetedLevel), NewTags);
+	}
+}
+
+void UBDC_LevelSelectorSettings::SetLevelTags(const FSoftObjectPath& LevelPath, const FGameplayTagContainer& NewTags)
+{
+	if (LevelPath.IsValid())
+	{
+		if (NewTags.IsEmpty())
+		{
+			LevelTagContainers.Remove(TSoftObjectPtr<UWorld>(LevelPath));
+			LevelTagsByPackage.Remove(LevelPath.GetLongPackageFName());
+		}
+		else
+		{
+			LevelTagContainers.Add(TSoftObjectPtr<UWorld>(LevelPath), NewTags);
+			LevelTagsByPackage.Add(LevelPath.GetLongPackageFName(), NewTags);
+		}
+		RequestConfigSave();
 	}
 }
 
-FGameplayTag UBDC_LevelSelectorSettings::GetLevelTag(UWorld* TargetedLevel)
+const FGameplayTagContainer& UBDC_LevelSelectorSettings::GetLevelTags(UWorld* TargetedLevel) const
 {
 	if (TargetedLevel)
 	{
-		auto SoftLevel = TSoftObjectPtr<UWorld>(TargetedLevel);
-		if (const FGameplayTag* Found = LevelTags.Find(SoftLevel))
+		return GetLevelTags(TargetedLevel->GetPackage()->GetFName());
+	}
+	return FGameplayTagContainer::EmptyContainer;
+}
+
+const FGameplayTagContainer& UBDC_LevelSelectorSettings::GetLevelTags(const FSoftObjectPath& LevelPath) const
+{
+	return GetLevelTags(LevelPath.GetLongPackageFName());
+}
+
+const FGameplayTagContainer& UBDC_LevelSelectorSettings::GetLevelTags(FName PackageName) const
+{
+	const FGameplayTagContainer* Tags = LevelTagsByPackage.Find(PackageName);
+	return Tags ? *Tags : FGameplayTagContainer::EmptyContainer;
+}
+
+#pragma region Camera Favorites
+const FCameraFavorite* UBDC_LevelSelectorSettings::FindCameraFavorites(const FSoftObjectPath& LevelPath) const
+{
+	return CameraFavoriteStore->Find(LevelPath.GetLongPackageFName());
+}
+
+bool UBDC_LevelSelectorSettings::HasCameraFavorites(FName PackageName) const
+{
+	return CameraFavoriteStore->HasFavorites(PackageName);
+}
+
+const FLevelSelectorCameraSpatialIndex* UBDC_LevelSelectorSettings::FindCameraFavoriteSpatialIndex(const FSoftObjectPath& LevelPath) const
+{
+	return CameraFavoriteStore->FindSpatialIndex(LevelPath.GetLongPackageFName());
+}
+
+void UBDC_LevelSelectorSettings::AddCameraFavorite(const FSoftObjectPath& LevelPath, FName FavoriteName, const FTransform& CameraTransform)
+{
+	if (LevelPath.IsValid() && !FavoriteName.IsNone())
+	{
+		if (CameraFavoriteStore->AddFavorite(LevelPath.GetLongPackageFName(), FavoriteName, CameraTransform))
+		{
+			CameraFavoritesChangedDelegate.Broadcast(LevelPath);
+		}
+	}
+}
+
+int32 UBDC_LevelSelectorSettings::AddCameraFavorites(const FSoftObjectPath& LevelPath, const TMap<FName, FTransform>& NewFavorites, bool bOverwrite, int32* OutNumReplaced)
+{
+	if (OutNumReplaced)
+	{
+		*OutNumReplaced = 0;
+	}
+	if (!LevelPath.IsValid() || NewFavorites.IsEmpty())
+	{
+		return 0;
+	}
+
+	int32 NumAdded = 0;
+	int32 NumReplaced = 0;
+	const bool bSaved = CameraFavoriteStore->Modify(LevelPath.GetLongPackageFName(), [&NewFavorites, bOverwrite, &NumAdded, &NumReplaced](FCameraFavorite& Favorites)
+	{
+		Favorites.HoldFavorites.Reserve(Favorites.HoldFavorites.Num() + NewFavorites.Num());
+		for (const auto& Pair : NewFavorites)
 		{
-			return *Found;
+			if (Pair.Key.IsNone() || !FLevelSelectorCameraFavoriteStore::IsValidFavoriteName(Pair.Key.ToString()))
+			{
+				continue;
+			}
+
+			FName Name = Pair.Key;
+			if (Favorites.HoldFavorites.Contains(Name))
+			{
+				if (bOverwrite)
+				{
+					++NumReplaced;
+				}
+				else
+				{
+					Name = FLevelSelectorCameraFavoriteTransfer::MakeUniqueName(Name.ToString(), Favorites.HoldFavorites);
+				}
+			}
+			Favorites.HoldFavorites.Add(Name, Pair.Value);
+			++NumAdded;
 		}
+		return NumAdded > 0;
+	});
+	if (!bSaved)
+	{
+		return 0;
 	}
-	return FGameplayTag();
+
+	if (OutNumReplaced)
+	{
+		*OutNumReplaced = NumReplaced;
+	}
+	CameraFavoritesChangedDelegate.Broadcast(LevelPath);
+	return NumAdded;
+}
+
+bool UBDC_LevelSelectorSettings::RenameCameraFavorite(const FSoftObjectPath& LevelPath, FName OldName, FName NewName)
+{
+	if (NewName.IsNone() || NewName == OldName)
+	{
+		return false;
+	}
+
+	const bool bRenamed = CameraFavoriteStore->RenameFavorite(LevelPath.GetLongPackageFName(), OldName, NewName);
+	if (bRenamed)
+	{
+		CameraFavoritesChangedDelegate.Broadcast(LevelPath);
+	}
+	return bRenamed;
+}
+
+bool UBDC_LevelSelectorSettings::RemoveCameraFavorite(const FSoftObjectPath& LevelPath, FName FavoriteName)
+{
+	const bool bRemoved = CameraFavoriteStore->RemoveFavorite(LevelPath.GetLongPackageFName(), FavoriteName);
+	if (bRemoved)
+	{
+		CameraFavoritesChangedDelegate.Broadcast(LevelPath);
+	}
+	return bRemoved;
+}
+
+void UBDC_LevelSelectorSettings::MoveCameraFavorites(FName OldPackageName, FName NewPackageName)
+{
+	if (CameraFavoriteStore->Move(OldPackageName, NewPackageName))
+	{
+		CameraFavoritesChangedDelegate.Broadcast(FSoftObjectPath());
+	}
+}
+
+void UBDC_LevelSelectorSettings::CollectCameraFavoriteGarbage(TFunctionRef<bool(FName)> DoesLevelExist)
+{
+	CameraFavoriteStore->CollectGarbage(DoesLevelExist);
 }
+#pragma endregion
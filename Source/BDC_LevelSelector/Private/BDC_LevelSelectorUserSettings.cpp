@@ -0,0 +1,156 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "BDC_LevelSelectorUserSettings.h"
+#include "LevelSelectorConfigWriter.h"
+#include "Algo/Sort.h"
+
+namespace LevelSelectorFrecency
+{
+	/** Hours after which an open counts half. */
+	static constexpr double HalfLifeHours = 72.0;
+	/** Fixed point scale of the keys, keeps them within int32 for centuries past the epoch. */
+	static constexpr double KeyScale = 65536.0;
+	/** Levels whose decayed open count dropped below this are forgotten. */
+	static constexpr double MinDecayedCount = 0.01;
+	/** Opens and other changes within this many seconds of each other share one config write. */
+	static constexpr float SaveQuietPeriodSeconds = 5.0f;
+
+	static const FDateTime Epoch(2025, 1, 1);
+
+	/** Log of the weight an open at the given time has, relative to the epoch. */
+	static double GetLogWeight(const FDateTime& Time)
+	{
+		const double HoursSinceEpoch = FMath::Max((Time - Epoch).GetTotalHours(), 0.0);
+		return HoursSinceEpoch * UE_LN2 / HalfLifeHours;
+	}
+
+	static double LogAddExp(double A, double B)
+	{
+		const double Max = FMath::Max(A, B);
+		return Max + FMath::Loge(1.0 + FMath::Exp(-FMath::Abs(A - B)));
+	}
+}
+
+UBDC_LevelSelectorUserSettings::UBDC_LevelSelectorUserSettings():
+	bEnablePrefetch(true),
+	PrefetchHoverDelaySeconds(0.35f),
+	PredictedPrefetchCount(3),
+	PrefetchMemoryCapMB(512),
+	SortMode(ELevelSelectorSortMode::Name),
+	HeavyLevelThresholdMB(1024),
+	bHideHeavyLevels(false),
+	ThumbnailMemoryBudgetMB(32),
+	bShowFolderTree(false),
+	CameraFavoriteMenuRadius(0.0f),
+	OpenAtFavoriteLoadRadius(25600.0f)
+{
+	CategoryName = TEXT("Plugins");
+	SectionName = TEXT("BDC Level Selector (User)");
+}
+
+void UBDC_LevelSelectorUserSettings::PostInitProperties()
+{
+	Super::PostInitProperties();
+	RebuildFrecencyLookup();
+}
+
+void UBDC_LevelSelectorUserSettings::PostReloadConfig(FProperty* PropertyThatWasLoaded)
+{
+	Super::PostReloadConfig(PropertyThatWasLoaded);
+	RebuildFrecencyLookup();
+}
+
+void UBDC_LevelSelectorUserSettings::RebuildFrecencyLookup()
+{
+	FrecencyKeysByPackage.Reset();
+	FrecencyKeysByPackage.Reserve(LevelFrecency.Num());
+	for (const FLevelFrecencyRecord& Record : LevelFrecency)
+	{
+		FrecencyKeysByPackage.Add(Record.PackageName, Record.Key);
+	}
+}
+
+int32 UBDC_LevelSelectorUserSettings::RecordLevelOpen(FName PackageName, TArray<FName>* OutForgottenPackages)
+{
+	if (PackageName.IsNone())
+	{
+		return 0;
+	}
+
+	const double LogWeight = LevelSelectorFrecency::GetLogWeight(FDateTime::UtcNow());
+	double LogCount = LogWeight;
+	if (const int32* ExistingKey = FrecencyKeysByPackage.Find(PackageName))
+	{
+		LogCount = LevelSelectorFrecency::LogAddExp(*ExistingKey / LevelSelectorFrecency::KeyScale, LogWeight);
+	}
+	const int32 Key = FMath::Max(FMath::RoundToInt32(LogCount * LevelSelectorFrecency::KeyScale), 1);
+
+	// Forget levels whose decayed count is negligible by now, so the record list stays short.
+	const int32 MinKey = FMath::RoundToInt32((LogWeight + FMath::Loge(LevelSelectorFrecency::MinDecayedCount)) * LevelSelectorFrecency::KeyScale);
+	LevelFrecency.RemoveAll([PackageName, MinKey, OutForgottenPackages](const FLevelFrecencyRecord& Record)
+	{
+		if (Record.PackageName == PackageName)
+		{
+			return true;
+		}
+		if (Record.Key < MinKey)
+		{
+			if (OutForgottenPackages)
+			{
+				OutForgottenPackages->Add(Record.PackageName);
+			}
+			return true;
+		}
+		return false;
+	});
+
+	FLevelFrecencyRecord& Record = LevelFrecency.AddDefaulted_GetRef();
+	Record.PackageName = PackageName;
+	Record.Key = Key;
+	RebuildFrecencyLookup();
+	RequestConfigSave();
+	return Key;
+}
+
+void UBDC_LevelSelectorUserSettings::GetPredictedLevels(int32 Count, FName ExcludedPackage, TArray<FName>& OutPackageNames) const
+{
+	// Keys rank by decayed open count, so the highest keys are the levels most likely opened next.
+	TArray<const FLevelFrecencyRecord*> Records;
+	Records.Reserve(LevelFrecency.Num());
+	for (const FLevelFrecencyRecord& Record : LevelFrecency)
+	{
+		if (Record.PackageName != ExcludedPackage)
+		{
+			Records.Add(&Record);
+		}
+	}
+
+	Algo::Sort(Records, [](const FLevelFrecencyRecord* A, const FLevelFrecencyRecord* B) { return A->Key > B->Key; });
+	for (int32 Index = 0; Index < FMath::Min(Count, Records.Num()); ++Index)
+	{
+		OutPackageNames.Add(Records[Index]->PackageName);
+	}
+}
+
+void UBDC_LevelSelectorUserSettings::RequestConfigSave()
+{
+	if (!ConfigWriter.IsValid())
+	{
+		ConfigWriter = MakeShared<FLevelSelectorConfigWriter>(this);
+	}
+	ConfigWriter->RequestSave(LevelSelectorFrecency::SaveQuietPeriodSeconds);
+}
+
+void UBDC_LevelSelectorUserSettings::FlushConfigSave()
+{
+	if (ConfigWriter.IsValid())
+	{
+		ConfigWriter->Flush();
+	}
+}
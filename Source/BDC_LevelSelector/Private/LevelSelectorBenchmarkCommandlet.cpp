@@ -0,0 +1,289 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "LevelSelectorBenchmarkCommandlet.h"
+#include "BDC_LevelSelector.h"
+#include "BDC_LevelSelectorSettings.h"
+#include "GameplayTagsManager.h"
+#include "LevelSelectorIndex.h"
+#include "LevelSelectorIndexCache.h"
+#include "Algo/Sort.h"
+#include "Dom/JsonObject.h"
+#include "Engine/World.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace LevelSelectorBenchmark
+{
+	/** Seconds to milliseconds, all samples are reported in milliseconds. */
+	static double ToMilliseconds(double StartSeconds)
+	{
+		return (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+	}
+
+	static TSharedRef<FJsonObject> MakePercentiles(TArray<double> Samples)
+	{
+		TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+		Result->SetNumberField(TEXT("Samples"), Samples.Num());
+		if (Samples.IsEmpty())
+		{
+			return Result;
+		}
+
+		Samples.Sort();
+		const auto Percentile = [&Samples](double Fraction)
+		{
+			return Samples[FMath::Clamp(FMath::CeilToInt(Fraction * Samples.Num()) - 1, 0, Samples.Num() - 1)];
+		};
+
+		double Sum = 0.0;
+		for (const double Sample : Samples)
+		{
+			Sum += Sample;
+		}
+
+		Result->SetNumberField(TEXT("MinMs"), Samples[0]);
+		Result->SetNumberField(TEXT("P50Ms"), Percentile(0.5));
+		Result->SetNumberField(TEXT("P90Ms"), Percentile(0.9));
+		Result->SetNumberField(TEXT("P99Ms"), Percentile(0.99));
+		Result->SetNumberField(TEXT("MaxMs"), Samples.Last());
+		Result->SetNumberField(TEXT("MeanMs"), Sum / Samples.Num());
+		return Result;
+	}
+
+	static void MakeWorldAssets(int32 NumAssets, TArray<FAssetData>& OutAssets)
+	{
+		const TCHAR* Regions[] = { TEXT("Desert"), TEXT("Forest"), TEXT("Arctic"), TEXT("City"), TEXT("Swamp"), TEXT("Canyon") };
+		const TCHAR* Kinds[] = { TEXT("Gym"), TEXT("Test"), TEXT("Lighting"), TEXT("Gameplay"), TEXT("Art"), TEXT("Audio") };
+		const FTopLevelAssetPath WorldClassPath = UWorld::StaticClass()->GetClassPathName();
+
+		OutAssets.Reset(NumAssets);
+		for (int32 Index = 0; Index < NumAssets; ++Index)
+		{
+			const TCHAR* Region = Regions[Index % UE_ARRAY_COUNT(Regions)];
+			const TCHAR* Kind = Kinds[(Index / UE_ARRAY_COUNT(Regions)) % UE_ARRAY_COUNT(Kinds)];
+			const FString AssetName = FString::Printf(TEXT("L_%s_%s_%06d"), Region, Kind, Index);
+			const FString PackagePath = FString::Printf(TEXT("/Game/Maps/%s/%s/%03d"), Region, Kind, Index % 997);
+			OutAssets.Emplace(FName(PackagePath / AssetName), FName(PackagePath), FName(AssetName), WorldClassPath);
+		}
+	}
+}
+
+ULevelSelectorBenchmarkCommandlet::ULevelSelectorBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 ULevelSelectorBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace LevelSelectorBenchmark;
+
+	FString SizesString = TEXT("1000,10000,100000");
+	int32 Iterations = 20;
+	float FavoriteRatio = 0.05f;
+	float TagRatio = 0.25f;
+	FString OutputFilename = FPaths::ProjectSavedDir() / TEXT("LevelSelector") / TEXT("Benchmark.json");
+	FParse::Value(*Params, TEXT("Sizes="), SizesString);
+	FParse::Value(*Params, TEXT("Iterations="), Iterations);
+	FParse::Value(*Params, TEXT("FavoriteRatio="), FavoriteRatio);
+	FParse::Value(*Params, TEXT("TagRatio="), TagRatio);
+	FParse::Value(*Params, TEXT("Output="), OutputFilename);
+	Iterations = FMath::Max(Iterations, 1);
+
+	TArray<FString> SizeStrings;
+	SizesString.ParseIntoArray(SizeStrings, TEXT(","));
+
+	FGameplayTagContainer AllTags;
+	UGameplayTagsManager::Get().RequestAllGameplayTags(AllTags, true);
+	TArray<FGameplayTag> AvailableTags;
+	AllTags.GetGameplayTagArray(AvailableTags);
+	if (AvailableTags.IsEmpty() && TagRatio > 0.0f)
+	{
+		UE_LOG(LogBDCLevelSelector, Warning, TEXT("The project defines no gameplay tags, levels are benchmarked without tags."));
+	}
+
+	// Favorites, tags and content roots are set on the in-memory settings only and restored below, nothing is written to config.
+	UBDC_LevelSelectorSettings* Settings = GetMutableDefault<UBDC_LevelSelectorSettings>();
+	const TArray<TSoftObjectPtr<UWorld>> SavedFavorites = Settings->FavoriteLevels;
+	const TMap<TSoftObjectPtr<UWorld>, FGameplayTagContainer> SavedTags = Settings->LevelTagContainers;
+	const TArray<FString> SavedIncludedRoots = Settings->IncludedContentRoots;
+	const TArray<FString> SavedExcludedRoots = Settings->ExcludedContentRoots;
+	Settings->IncludedContentRoots = { TEXT("/Game/") };
+	Settings->ExcludedContentRoots.Reset();
+
+	const TCHAR* Queries[] = { TEXT("d"), TEXT("des"), TEXT("desert_gym"), TEXT("004242"), TEXT("city/art/12") };
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetNumberField(TEXT("Iterations"), Iterations);
+	Root->SetNumberField(TEXT("FavoriteRatio"), FavoriteRatio);
+	Root->SetNumberField(TEXT("TagRatio"), TagRatio);
+	Root->SetNumberField(TEXT("AvailableTags"), AvailableTags.Num());
+	TArray<TSharedPtr<FJsonValue>> Results;
+
+	for (const FString& SizeString : SizeStrings)
+	{
+		const int32 NumAssets = FCString::Atoi(*SizeString.TrimStartAndEnd());
+		if (NumAssets <= 0)
+		{
+			continue;
+		}
+
+		TArray<FAssetData> Assets;
+		MakeWorldAssets(NumAssets, Assets);
+
+		FRandomStream Random(NumAssets);
+		Settings->FavoriteLevels.Reset();
+		Settings->LevelTagContainers.Reset();
+		for (const FAssetData& Asset : Assets)
+		{
+			const TSoftObjectPtr<UWorld> Level(Asset.GetSoftObjectPath());
+			if (Random.FRand() < FavoriteRatio)
+			{
+				Settings->FavoriteLevels.Add(Level);
+			}
+			if (!AvailableTags.IsEmpty() && Random.FRand() < TagRatio)
+			{
+				FGameplayTagContainer& Tags = Settings->LevelTagContainers.Add(Level);
+				for (int32 TagCount = Random.RandRange(1, 3); TagCount > 0; --TagCount)
+				{
+					Tags.AddTag(AvailableTags[Random.RandHelper(AvailableTags.Num())]);
+				}
+			}
+		}
+		Settings->RebuildLevelLookups();
+
+		TMap<FString, TArray<double>> Stages;
+
+		// PopulateLevelList: building the index from a full registry result.
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			FLevelSelectorIndex ScratchIndex;
+			const double Start = FPlatformTime::Seconds();
+			ScratchIndex.Reconcile(Assets);
+			Stages.FindOrAdd(TEXT("Populate")).Add(ToMilliseconds(Start));
+		}
+
+		FLevelSelectorIndex Index;
+		Index.Reconcile(Assets);
+
+		// SortLevelList: a full sort of the index from a shuffled order.
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			TArray<TSharedPtr<FLevelSelectorItem>> Items = Index.GetSortedItems();
+			for (int32 ItemIndex = Items.Num() - 1; ItemIndex > 0; --ItemIndex)
+			{
+				Items.Swap(ItemIndex, Random.RandHelper(ItemIndex + 1));
+			}
+			const double Start = FPlatformTime::Seconds();
+			Algo::Sort(Items, &FLevelSelectorIndex::CompareItems);
+			Stages.FindOrAdd(TEXT("Sort")).Add(ToMilliseconds(Start));
+		}
+
+		// IndexFilter: the index side of the dropdown's full filter pass for every query, with and without tag filters.
+		// Rebuilding the widget's list source and its rows needs Slate and is not timed here.
+		const FLevelSelectorTagIndex::FQuery NoTagsQuery = Index.MakeTagQuery(FGameplayTagContainer(), ELevelSelectorTagMatch::Any);
+		FGameplayTagContainer FilterTags;
+		for (int32 TagIndex = 0; TagIndex < FMath::Min(AvailableTags.Num(), 2); ++TagIndex)
+		{
+			FilterTags.AddTag(AvailableTags[TagIndex]);
+		}
+		const FLevelSelectorTagIndex::FQuery AnyTagsQuery = Index.MakeTagQuery(FilterTags, ELevelSelectorTagMatch::Any);
+		const FLevelSelectorTagIndex::FQuery AllTagsQuery = Index.MakeTagQuery(FilterTags, ELevelSelectorTagMatch::All);
+
+		TArray<TSharedPtr<FLevelSelectorItem>> Filtered;
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			for (const TCHAR* Query : Queries)
+			{
+				const FString Folded = FLevelSelectorSearchIndex::Fold(Query);
+				Filtered.Reset();
+				const double Start = FPlatformTime::Seconds();
+				Index.GetFilteredItems(Folded, NoTagsQuery, Filtered);
+				Stages.FindOrAdd(FString::Printf(TEXT("IndexFilter:%s"), Query)).Add(ToMilliseconds(Start));
+			}
+
+			if (!FilterTags.IsEmpty())
+			{
+				Filtered.Reset();
+				double Start = FPlatformTime::Seconds();
+				Index.GetFilteredItems(FString(), AnyTagsQuery, Filtered);
+				Stages.FindOrAdd(TEXT("IndexFilter:TagsAny")).Add(ToMilliseconds(Start));
+
+				Filtered.Reset();
+				Start = FPlatformTime::Seconds();
+				Index.GetFilteredItems(FString(), AllTagsQuery, Filtered);
+				Stages.FindOrAdd(TEXT("IndexFilter:TagsAll")).Add(ToMilliseconds(Start));
+			}
+		}
+
+		// RefreshSelection: object path to package name to item, as done for every map change. Reported per lookup.
+		const int32 NumLookups = FMath::Min(NumAssets, 1000);
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			int32 NumFound = 0;
+			const double Start = FPlatformTime::Seconds();
+			for (int32 Lookup = 0; Lookup < NumLookups; ++Lookup)
+			{
+				const FString ObjectPath = Assets[Random.RandHelper(NumAssets)].GetSoftObjectPath().ToString();
+				const FString PackagePath = FPackageName::ObjectPathToPackageName(ObjectPath);
+				NumFound += Index.FindItem(FName(*PackagePath, FNAME_Find)).IsValid() ? 1 : 0;
+			}
+			Stages.FindOrAdd(TEXT("RefreshSelection")).Add(ToMilliseconds(Start) / NumLookups);
+			ensure(NumFound == NumLookups);
+		}
+
+		// Serializing the index cache, done once the asset registry finished loading.
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			const double Start = FPlatformTime::Seconds();
+			const TArray<uint8> CacheData = FLevelSelectorIndexCache::Serialize(Index.GetSortedItems());
+			Stages.FindOrAdd(TEXT("CacheSerialize")).Add(ToMilliseconds(Start));
+		}
+
+		TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+		Result->SetNumberField(TEXT("Items"), NumAssets);
+		Result->SetNumberField(TEXT("Favorites"), Settings->FavoriteLevels.Num());
+		Result->SetNumberField(TEXT("Tagged"), Settings->LevelTagContainers.Num());
+
+		TSharedRef<FJsonObject> StagesObject = MakeShared<FJsonObject>();
+		for (TPair<FString, TArray<double>>& Stage : Stages)
+		{
+			TSharedRef<FJsonObject> StageResult = MakePercentiles(Stage.Value);
+			UE_LOG(LogBDCLevelSelector, Display, TEXT("%7d levels  %-20s p50 %9.3f ms  p99 %9.3f ms"),
+				NumAssets, *Stage.Key, StageResult->GetNumberField(TEXT("P50Ms")), StageResult->GetNumberField(TEXT("P99Ms")));
+			StagesObject->SetObjectField(Stage.Key, StageResult);
+		}
+		Result->SetObjectField(TEXT("Stages"), StagesObject);
+		Results.Add(MakeShared<FJsonValueObject>(Result));
+	}
+	Root->SetArrayField(TEXT("Results"), Results);
+
+	Settings->FavoriteLevels = SavedFavorites;
+	Settings->LevelTagContainers = SavedTags;
+	Settings->IncludedContentRoots = SavedIncludedRoots;
+	Settings->ExcludedContentRoots = SavedExcludedRoots;
+	Settings->RebuildLevelLookups();
+
+	FString JsonText;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonText);
+	FJsonSerializer::Serialize(Root, Writer);
+
+	if (!FFileHelper::SaveStringToFile(JsonText, *OutputFilename))
+	{
+		UE_LOG(LogBDCLevelSelector, Error, TEXT("Failed to write benchmark results to %s."), *OutputFilename);
+		return 1;
+	}
+	UE_LOG(LogBDCLevelSelector, Display, TEXT("Benchmark results written to %s."), *OutputFilename);
+	return 0;
+}
@@ -0,0 +1,416 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "LevelSelectorCameraFavoriteStore.h"
+#include "BDC_LevelSelector.h"
+#include "BDC_LevelSelectorSettings.h"
+#include "LevelSelectorCameraSpatialIndex.h"
+#include "LevelSelectorTextStream.h"
+#include "SourceControlHelpers.h"
+#include "HAL/FileManager.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+
+namespace LevelSelectorCameraFavoriteStore
+{
+	static const TCHAR* Extension = TEXT(".lscam");
+	/** First line of every file, bump the number whenever the line format changes. */
+	static const TCHAR* Header = TEXT("LevelSelectorCameraFavorites 1");
+}
+
+FLevelSelectorCameraFavoriteStore::FLevelSelectorCameraFavoriteStore() = default;
+FLevelSelectorCameraFavoriteStore::~FLevelSelectorCameraFavoriteStore() = default;
+
+FString FLevelSelectorCameraFavoriteStore::GetRootDir()
+{
+	return FPaths::ProjectConfigDir() / TEXT("LevelSelector") / TEXT("CameraFavorites");
+}
+
+FString FLevelSelectorCameraFavoriteStore::GetFilename(FName PackageName)
+{
+	FString PackagePath = PackageName.ToString();
+	PackagePath.RemoveFromStart(TEXT("/"));
+	return GetRootDir() / PackagePath + LevelSelectorCameraFavoriteStore::Extension;
+}
+
+bool FLevelSelectorCameraFavoriteStore::IsValidFavoriteName(FStringView Name)
+{
+	int32 Index = INDEX_NONE;
+	return !Name.IsEmpty() && Name.Len() < NAME_SIZE && !Name.FindChar(TEXT('\n'), Index) && !Name.FindChar(TEXT('\r'), Index);
+}
+
+const FCameraFavorite* FLevelSelectorCameraFavoriteStore::Find(FName PackageName)
+{
+	if (PackageName.IsNone())
+	{
+		return nullptr;
+	}
+
+	if (const TUniquePtr<FCameraFavorite>* Loaded = LoadedLevels.Find(PackageName))
+	{
+		return Loaded->Get();
+	}
+
+	TUniquePtr<FCameraFavorite> Favorites = MakeUnique<FCameraFavorite>();
+	if (!Load(PackageName, *Favorites) || Favorites->HoldFavorites.IsEmpty())
+	{
+		Favorites.Reset();
+	}
+	return LoadedLevels.Add(PackageName, MoveTemp(Favorites)).Get();
+}
+
+bool FLevelSelectorCameraFavoriteStore::HasFavorites(FName PackageName)
+{
+	if (const TUniquePtr<FCameraFavorite>* Loaded = LoadedLevels.Find(PackageName))
+	{
+		return Loaded->IsValid();
+	}
+	ListFiles();
+	return LevelsWithFile.Contains(PackageName);
+}
+
+void FLevelSelectorCameraFavoriteStore::ListFiles()
+{
+	if (bListedFiles)
+	{
+		return;
+	}
+	bListedFiles = true;
+
+	const FString RootDir = GetRootDir();
+	TArray<FString> Filenames;
+	IFileManager::Get().FindFilesRecursive(Filenames, *RootDir, *(FString(TEXT("*")) + LevelSelectorCameraFavoriteStore::Extension), true, false);
+	for (const FString& Filename : Filenames)
+	{
+		const FName PackageName = GetPackageName(Filename, RootDir);
+		if (!PackageName.IsNone())
+		{
+			LevelsWithFile.Add(PackageName);
+		}
+	}
+}
+
+FName FLevelSelectorCameraFavoriteStore::GetPackageName(const FString& Filename, const FString& RootDir)
+{
+	FString PackagePath = Filename;
+	if (!FPaths::MakePathRelativeTo(PackagePath, *(RootDir / TEXT(""))))
+	{
+		return NAME_None;
+	}
+	return FName(*(TEXT("/") + FPaths::ChangeExtension(PackagePath, FString())));
+}
+
+bool FLevelSelectorCameraFavoriteStore::Modify(FName PackageName, TFunctionRef<bool(FCameraFavorite&)> Mutation)
+{
+	// The store can't tell what Mutation changed, the spatial index is rebuilt on its next use.
+	if (ModifyInternal(PackageName, Mutation))
+	{
+		SpatialIndices.Remove(PackageName);
+		return true;
+	}
+	return false;
+}
+
+bool FLevelSelectorCameraFavoriteStore::AddFavorite(FName PackageName, FName FavoriteName, const FTransform& CameraTransform)
+{
+	if (!IsValidFavoriteName(FavoriteName.ToString()))
+	{
+		return false;
+	}
+
+	const bool bAdded = ModifyInternal(PackageName, [FavoriteName, &CameraTransform](FCameraFavorite& Favorites)
+	{
+		Favorites.HoldFavorites.Add(FavoriteName, CameraTransform);
+		return true;
+	});
+	if (bAdded)
+	{
+		if (const TUniquePtr<FLevelSelectorCameraSpatialIndex>* SpatialIndex = SpatialIndices.Find(PackageName))
+		{
+			(*SpatialIndex)->Add(FavoriteName, CameraTransform.GetLocation());
+		}
+	}
+	return bAdded;
+}
+
+bool FLevelSelectorCameraFavoriteStore::RenameFavorite(FName PackageName, FName OldName, FName NewName)
+{
+	if (!IsValidFavoriteName(NewName.ToString()))
+	{
+		return false;
+	}
+
+	const bool bRenamed = ModifyInternal(PackageName, [OldName, NewName](FCameraFavorite& Favorites)
+	{
+		FTransform CameraTransform;
+		if (!Favorites.HoldFavorites.RemoveAndCopyValue(OldName, CameraTransform))
+		{
+			return false;
+		}
+		Favorites.HoldFavorites.Add(NewName, CameraTransform);
+		return true;
+	});
+	if (bRenamed)
+	{
+		if (const TUniquePtr<FLevelSelectorCameraSpatialIndex>* SpatialIndex = SpatialIndices.Find(PackageName))
+		{
+			// Renaming onto an existing favorite replaced it, the index drops the old entry first.
+			(*SpatialIndex)->Remove(NewName);
+			(*SpatialIndex)->Rename(OldName, NewName);
+		}
+	}
+	return bRenamed;
+}
+
+bool FLevelSelectorCameraFavoriteStore::RemoveFavorite(FName PackageName, FName FavoriteName)
+{
+	const bool bRemoved = ModifyInternal(PackageName, [FavoriteName](FCameraFavorite& Favorites)
+	{
+		return Favorites.HoldFavorites.Remove(FavoriteName) > 0;
+	});
+	if (bRemoved)
+	{
+		if (const TUniquePtr<FLevelSelectorCameraSpatialIndex>* SpatialIndex = SpatialIndices.Find(PackageName))
+		{
+			(*SpatialIndex)->Remove(FavoriteName);
+		}
+	}
+	return bRemoved;
+}
+
+const FLevelSelectorCameraSpatialIndex* FLevelSelectorCameraFavoriteStore::FindSpatialIndex(FName PackageName)
+{
+	if (const TUniquePtr<FLevelSelectorCameraSpatialIndex>* SpatialIndex = SpatialIndices.Find(PackageName))
+	{
+		return (*SpatialIndex)->Num() > 0 ? SpatialIndex->Get() : nullptr;
+	}
+
+	const FCameraFavorite* Favorites = Find(PackageName);
+	if (!Favorites)
+	{
+		return nullptr;
+	}
+
+	TUniquePtr<FLevelSelectorCameraSpatialIndex> SpatialIndex = MakeUnique<FLevelSelectorCameraSpatialIndex>();
+	for (const auto& Pair : Favorites->HoldFavorites)
+	{
+		SpatialIndex->Add(Pair.Key, Pair.Value.GetLocation());
+	}
+	return SpatialIndices.Add(PackageName, MoveTemp(SpatialIndex)).Get();
+}
+
+bool FLevelSelectorCameraFavoriteStore::ModifyInternal(FName PackageName, TFunctionRef<bool(FCameraFavorite&)> Mutation)
+{
+	if (PackageName.IsNone())
+	{
+		return false;
+	}
+
+	Find(PackageName);
+	TUniquePtr<FCameraFavorite>& Favorites = LoadedLevels.FindChecked(PackageName);
+	if (!Favorites.IsValid())
+	{
+		Favorites = MakeUnique<FCameraFavorite>();
+	}
+
+	FCameraFavorite Previous = *Favorites;
+	const bool bChanged = Mutation(*Favorites);
+	const bool bSaved = bChanged && Save(PackageName, *Favorites);
+	if (bChanged && !bSaved)
+	{
+		// The file still holds the old favorites, memory must not show any that would be gone after a restart.
+		*Favorites = MoveTemp(Previous);
+	}
+	if (Favorites->HoldFavorites.IsEmpty())
+	{
+		Favorites.Reset();
+	}
+	return bSaved;
+}
+
+bool FLevelSelectorCameraFavoriteStore::Move(FName OldPackageName, FName NewPackageName)
+{
+	const FCameraFavorite* OldFavorites = Find(OldPackageName);
+	if (!OldFavorites || OldPackageName == NewPackageName)
+	{
+		return false;
+	}
+
+	// The old file is only removed once the new one was written.
+	const FCameraFavorite Favorites = *OldFavorites;
+	const bool bMoved = Modify(NewPackageName, [&Favorites](FCameraFavorite& NewFavorites)
+	{
+		NewFavorites.HoldFavorites.Append(Favorites.HoldFavorites);
+		return true;
+	});
+	if (bMoved)
+	{
+		Modify(OldPackageName, [](FCameraFavorite& OldLevelFavorites)
+		{
+			OldLevelFavorites.HoldFavorites.Reset();
+			return true;
+		});
+	}
+	return bMoved;
+}
+
+int32 FLevelSelectorCameraFavoriteStore::CollectGarbage(TFunctionRef<bool(FName)> DoesLevelExist)
+{
+	const FString RootDir = GetRootDir();
+	TArray<FString> Filenames;
+	IFileManager::Get().FindFilesRecursive(Filenames, *RootDir, *(FString(TEXT("*")) + LevelSelectorCameraFavoriteStore::Extension), true, false);
+
+	int32 NumDeleted = 0;
+	for (const FString& Filename : Filenames)
+	{
+		// Unmounted plugins fail the root check, their levels are not gone.
+		const FName PackageName = GetPackageName(Filename, RootDir);
+		if (PackageName.IsNone() || !FPackageName::IsValidLongPackageName(PackageName.ToString()))
+		{
+			continue;
+		}
+
+		if (!DoesLevelExist(PackageName) && RemoveFile(Filename))
+		{
+			LoadedLevels.Remove(PackageName);
+			SpatialIndices.Remove(PackageName);
+			LevelsWithFile.Remove(PackageName);
+			++NumDeleted;
+		}
+	}
+
+	if (NumDeleted > 0)
+	{
+		UE_LOG(LogBDCLevelSelector, Log, TEXT("Removed camera favorites of %d levels that no longer exist."), NumDeleted);
+	}
+	return NumDeleted;
+}
+
+bool FLevelSelectorCameraFavoriteStore::Load(FName PackageName, FCameraFavorite& OutFavorites) const
+{
+	const FString Filename = GetFilename(PackageName);
+	if (!IFileManager::Get().FileExists(*Filename))
+	{
+		return false;
+	}
+
+	FLevelSelectorLineReader Reader(Filename);
+	FString Line;
+	if (!Reader.ReadLine(Line) || Line != LevelSelectorCameraFavoriteStore::Header)
+	{
+		UE_LOG(LogBDCLevelSelector, Warning, TEXT("Ignoring camera favorites file %s with an unknown header."), *Filename);
+		return false;
+	}
+
+	// One favorite per line, "Name=Transform" with the transform as written by FTransform::ToString.
+	while (Reader.ReadLine(Line))
+	{
+		int32 SeparatorIndex = INDEX_NONE;
+		FTransform CameraTransform;
+		if (!Line.FindLastChar(TEXT('='), SeparatorIndex) || !IsValidFavoriteName(FStringView(Line).Left(SeparatorIndex))
+			|| !CameraTransform.InitFromString(Line.Mid(SeparatorIndex + 1)))
+		{
+			continue;
+		}
+		OutFavorites.HoldFavorites.Add(FName(Line.Left(SeparatorIndex)), CameraTransform);
+	}
+	return true;
+}
+
+bool FLevelSelectorCameraFavoriteStore::Save(FName PackageName, const FCameraFavorite& Favorites)
+{
+	const FString Filename = GetFilename(PackageName);
+	if (Favorites.HoldFavorites.IsEmpty())
+	{
+		const bool bDeleted = RemoveFile(Filename);
+		if (bDeleted)
+		{
+			LevelsWithFile.Remove(PackageName);
+		}
+		return bDeleted;
+	}
+
+	// Sorted by name, so the files diff cleanly in source control.
+	TArray<FName> Names;
+	Favorites.HoldFavorites.GetKeys(Names);
+	Names.Sort(FNameLexicalLess());
+
+	const bool bIsNewFile = !IFileManager::Get().FileExists(*Filename);
+	if (!bIsNewFile && !CheckOutFile(Filename))
+	{
+		return false;
+	}
+
+	// Written next to the file and moved over it, a failed write never leaves a half written file behind.
+	const FString TempFilename = Filename + TEXT(".tmp");
+	FLevelSelectorLineWriter Writer(TempFilename);
+	Writer.WriteLine(LevelSelectorCameraFavoriteStore::Header);
+	TStringBuilder<256> Line;
+	for (const FName& Name : Names)
+	{
+		// Modify takes any name, a line break in one would split its line and corrupt the file.
+		Line.Reset();
+		Line << Name;
+		if (!IsValidFavoriteName(Line.ToView()))
+		{
+			UE_LOG(LogBDCLevelSelector, Warning, TEXT("Not writing camera favorite %s with a line break to %s."), *Name.ToString().ReplaceCharWithEscapedChar(), *Filename);
+			continue;
+		}
+		Line << TEXT('=') << Favorites.HoldFavorites[Name].ToString();
+		Writer.WriteLine(Line);
+	}
+
+	if (!Writer.Close() || !IFileManager::Get().Move(*Filename, *TempFilename, true, false))
+	{
+		UE_LOG(LogBDCLevelSelector, Warning, TEXT("Could not write camera favorites file %s."), *Filename);
+		return false;
+	}
+	if (bIsNewFile && USourceControlHelpers::IsEnabled())
+	{
+		USourceControlHelpers::MarkFileForAdd(Filename, true);
+	}
+	LevelsWithFile.Add(PackageName);
+	return true;
+}
+
+bool FLevelSelectorCameraFavoriteStore::CheckOutFile(const FString& Filename)
+{
+	// Only read-only files ask source control, a writable file is checked out already or not versioned at all.
+	IFileManager& FileManager = IFileManager::Get();
+	if (!FileManager.IsReadOnly(*Filename))
+	{
+		return true;
+	}
+	if (USourceControlHelpers::IsEnabled() && USourceControlHelpers::CheckOutFile(Filename, true) && !FileManager.IsReadOnly(*Filename))
+	{
+		return true;
+	}
+	UE_LOG(LogBDCLevelSelector, Warning, TEXT("Camera favorites file %s is read-only and could not be checked out."), *Filename);
+	return false;
+}
+
+bool FLevelSelectorCameraFavoriteStore::RemoveFile(const FString& Filename)
+{
+	IFileManager& FileManager = IFileManager::Get();
+	if (!FileManager.FileExists(*Filename))
+	{
+		return true;
+	}
+
+	// Marking for delete removes the file as well, files source control does not know are left to the file manager.
+	if (USourceControlHelpers::IsEnabled())
+	{
+		USourceControlHelpers::MarkFileForDelete(Filename, true);
+	}
+	if (FileManager.FileExists(*Filename) && !FileManager.Delete(*Filename, false, false, true))
+	{
+		UE_LOG(LogBDCLevelSelector, Warning, TEXT("Could not delete camera favorites file %s, it is read-only or could not be marked for delete."), *Filename);
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,521 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "LevelSelectorCameraFavoriteTransfer.h"
+#include "BDC_LevelSelector.h"
+#include "BDC_LevelSelectorSettings.h"
+#include "LevelSelectorCameraFavoriteStore.h"
+#include "LevelSelectorTextStream.h"
+#include "Dom/JsonObject.h"
+#include "Editor.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "WorldPartition/DataLayer/DataLayerInstance.h"
+
+namespace LevelSelectorCameraFavoriteTransfer
+{
+	static const TCHAR* CsvHeader = TEXT("Name,X,Y,Z,Pitch,Yaw,Roll");
+
+	static UWorld* GetEditorWorld()
+	{
+		return GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	}
+
+	static FSoftObjectPath GetEditorLevelPath()
+	{
+		const UWorld* World = GetEditorWorld();
+		return World && !FPackageName::IsTemporaryPackage(World->GetPackage()->GetName()) ? FSoftObjectPath(World) : FSoftObjectPath();
+	}
+
+	static FString EscapeCsv(const FString& Text)
+	{
+		if (!Text.Contains(TEXT(",")) && !Text.Contains(TEXT("\"")))
+		{
+			return Text;
+		}
+		return TEXT("\"") + Text.Replace(TEXT("\""), TEXT("\"\"")) + TEXT("\"");
+	}
+
+	static FString EscapeJson(const FString& Text)
+	{
+		FString Result;
+		Result.Reserve(Text.Len() + 2);
+		for (const TCHAR Char : Text)
+		{
+			switch (Char)
+			{
+			case TEXT('"'): Result += TEXT("\\\""); break;
+			case TEXT('\\'): Result += TEXT("\\\\"); break;
+			case TEXT('\n'): Result += TEXT("\\n"); break;
+			case TEXT('\r'): Result += TEXT("\\r"); break;
+			case TEXT('\t'): Result += TEXT("\\t"); break;
+			default:
+				if (Char < 0x20)
+				{
+					Result += FString::Printf(TEXT("\\u%04x"), static_cast<uint32>(Char));
+				}
+				else
+				{
+					Result.AppendChar(Char);
+				}
+			}
+		}
+		return Result;
+	}
+}
+
+static FAutoConsoleCommand CmdLevelSelectorCameraFavoritesFromActors(
+	TEXT("LevelSelector.CameraFavorites.AddFromActors"),
+	TEXT("Adds a camera favorite for every matching loaded actor of the open level. Names the level already uses get a numbered suffix unless Overwrite is given. Usage: LevelSelector.CameraFavorites.AddFromActors [Class=Name] [Tag=Name] [DataLayer=Name] [Distance=cm] [Overwrite]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const FSoftObjectPath LevelPath = LevelSelectorCameraFavoriteTransfer::GetEditorLevelPath();
+		if (!LevelPath.IsValid())
+		{
+			UE_LOG(LogBDCLevelSelector, Display, TEXT("Save the level before adding camera favorites to it."));
+			return;
+		}
+
+		FLevelSelectorActorQuery Query;
+		bool bOverwrite = false;
+		for (const FString& Arg : Args)
+		{
+			FString Key, Value;
+			if (!Arg.Split(TEXT("="), &Key, &Value))
+			{
+				bOverwrite |= Arg.Equals(TEXT("Overwrite"), ESearchCase::IgnoreCase);
+				continue;
+			}
+			if (Key.Equals(TEXT("Class"), ESearchCase::IgnoreCase))
+			{
+				Query.ActorClass = FLevelSelectorCameraFavoriteTransfer::FindActorClass(Value);
+				if (!Query.ActorClass)
+				{
+					UE_LOG(LogBDCLevelSelector, Display, TEXT("Unknown actor class %s."), *Value);
+					return;
+				}
+			}
+			else if (Key.Equals(TEXT("Tag"), ESearchCase::IgnoreCase))
+			{
+				Query.ActorTag = FName(*Value);
+			}
+			else if (Key.Equals(TEXT("DataLayer"), ESearchCase::IgnoreCase))
+			{
+				Query.DataLayerName = FName(*Value);
+			}
+			else if (Key.Equals(TEXT("Distance"), ESearchCase::IgnoreCase))
+			{
+				LexFromString(Query.ViewDistance, *Value);
+			}
+		}
+
+		TMap<FName, FTransform> Favorites;
+		FLevelSelectorCameraFavoriteTransfer::CollectFromActors(LevelSelectorCameraFavoriteTransfer::GetEditorWorld(), Query, Favorites);
+		int32 NumReplaced = 0;
+		const int32 NumAdded = GetMutableDefault<UBDC_LevelSelectorSettings>()->AddCameraFavorites(LevelPath, Favorites, bOverwrite, &NumReplaced);
+		UE_LOG(LogBDCLevelSelector, Display, TEXT("Added %d camera favorites to %s, %d of them replaced existing ones."), NumAdded, *LevelPath.GetLongPackageName(), NumReplaced);
+	}));
+
+static FAutoConsoleCommand CmdLevelSelectorCameraFavoritesImport(
+	TEXT("LevelSelector.CameraFavorites.Import"),
+	TEXT("Adds the camera favorites of a file to the open level. Names the level already uses get a numbered suffix unless Overwrite is given. Usage: LevelSelector.CameraFavorites.Import Filename.csv|Filename.json [Overwrite]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const FSoftObjectPath LevelPath = LevelSelectorCameraFavoriteTransfer::GetEditorLevelPath();
+		if (Args.IsEmpty() || !LevelPath.IsValid())
+		{
+			UE_LOG(LogBDCLevelSelector, Display, TEXT("Usage: LevelSelector.CameraFavorites.Import Filename.csv|Filename.json [Overwrite], with a saved level open."));
+			return;
+		}
+
+		const bool bOverwrite = Args.Num() > 1 && Args[1].Equals(TEXT("Overwrite"), ESearchCase::IgnoreCase);
+		TMap<FName, FTransform> Favorites;
+		if (FLevelSelectorCameraFavoriteTransfer::Import(FPaths::ConvertRelativePathToFull(Args[0]), Favorites))
+		{
+			int32 NumReplaced = 0;
+			const int32 NumAdded = GetMutableDefault<UBDC_LevelSelectorSettings>()->AddCameraFavorites(LevelPath, Favorites, bOverwrite, &NumReplaced);
+			UE_LOG(LogBDCLevelSelector, Display, TEXT("Imported %d camera favorites into %s, %d of them replaced existing ones."), NumAdded, *LevelPath.GetLongPackageName(), NumReplaced);
+		}
+	}));
+
+static FAutoConsoleCommand CmdLevelSelectorCameraFavoritesExport(
+	TEXT("LevelSelector.CameraFavorites.Export"),
+	TEXT("Writes the camera favorites of the open level to a file. Usage: LevelSelector.CameraFavorites.Export [Filename.csv|Filename.json]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const FSoftObjectPath LevelPath = LevelSelectorCameraFavoriteTransfer::GetEditorLevelPath();
+		const FCameraFavorite* Favorites = LevelPath.IsValid() ? GetDefault<UBDC_LevelSelectorSettings>()->FindCameraFavorites(LevelPath) : nullptr;
+		if (!Favorites)
+		{
+			UE_LOG(LogBDCLevelSelector, Display, TEXT("The open level has no camera favorites."));
+			return;
+		}
+
+		const FString Filename = Args.Num() > 0
+			? FPaths::ConvertRelativePathToFull(Args[0])
+			: FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("LevelSelector") / (LevelPath.GetAssetName() + TEXT("_CameraFavorites.csv")));
+		if (FLevelSelectorCameraFavoriteTransfer::Export(Filename, *Favorites))
+		{
+			UE_LOG(LogBDCLevelSelector, Display, TEXT("Camera favorites written to %s"), *Filename);
+		}
+	}));
+
+#pragma region Actors
+int32 FLevelSelectorCameraFavoriteTransfer::CollectFromActors(UWorld* World, const FLevelSelectorActorQuery& Query, TMap<FName, FTransform>& OutFavorites)
+{
+	if (!World)
+	{
+		return 0;
+	}
+
+	// Actors of unloaded World Partition cells only exist as descriptors without labels or data layer assets, they are left out.
+	if (World->IsPartitionedWorld())
+	{
+		UE_LOG(LogBDCLevelSelector, Display, TEXT("%s is a World Partition level, only actors of its loaded regions become camera favorites."), *World->GetName());
+	}
+
+	TArray<AActor*> Actors;
+	for (TActorIterator<AActor> It(World, Query.ActorClass ? *Query.ActorClass : AActor::StaticClass()); It; ++It)
+	{
+		if (MatchesQuery(**It, Query))
+		{
+			Actors.Add(*It);
+		}
+	}
+	return CollectFromActors(Actors, Query.ViewDistance, OutFavorites);
+}
+
+int32 FLevelSelectorCameraFavoriteTransfer::CollectFromActors(TConstArrayView<AActor*> Actors, double ViewDistance, TMap<FName, FTransform>& OutFavorites)
+{
+	int32 NumAdded = 0;
+	for (const AActor* Actor : Actors)
+	{
+		if (Actor)
+		{
+			OutFavorites.Add(MakeUniqueName(Actor->GetActorLabel(), OutFavorites), GetViewTransform(*Actor, ViewDistance));
+			++NumAdded;
+		}
+	}
+	return NumAdded;
+}
+
+bool FLevelSelectorCameraFavoriteTransfer::MatchesQuery(const AActor& Actor, const FLevelSelectorActorQuery& Query)
+{
+	if (Actor.IsTemplate() || (Query.ActorClass && !Actor.IsA(Query.ActorClass)))
+	{
+		return false;
+	}
+	if (!Query.ActorTag.IsNone() && !Actor.ActorHasTag(Query.ActorTag))
+	{
+		return false;
+	}
+	if (!Query.DataLayerName.IsNone())
+	{
+		const FString DataLayerName = Query.DataLayerName.ToString();
+		return Actor.GetDataLayerInstances().ContainsByPredicate([&DataLayerName](const UDataLayerInstance* Instance)
+		{
+			return Instance && Instance->GetDataLayerShortName() == DataLayerName;
+		});
+	}
+	return true;
+}
+
+FTransform FLevelSelectorCameraFavoriteTransfer::GetViewTransform(const AActor& Actor, double ViewDistance)
+{
+	if (ViewDistance <= 0.0)
+	{
+		return FTransform(Actor.GetActorRotation(), Actor.GetActorLocation());
+	}
+
+	const FVector Target = Actor.GetActorLocation();
+	const FVector Location = Target - Actor.GetActorForwardVector() * ViewDistance + FVector::UpVector * (ViewDistance * 0.5);
+	return FTransform((Target - Location).Rotation(), Location);
+}
+
+UClass* FLevelSelectorCameraFavoriteTransfer::FindActorClass(const FString& ClassName)
+{
+	UClass* Class = FindFirstObject<UClass>(*ClassName, EFindFirstObjectOptions::NativeFirst);
+	return Class && Class->IsChildOf(AActor::StaticClass()) ? Class : nullptr;
+}
+
+FName FLevelSelectorCameraFavoriteTransfer::MakeUniqueName(const FString& BaseName, const TMap<FName, FTransform>& Favorites)
+{
+	// Room is left for the suffix, a name at the length limit would not fit an FName with it.
+	const FString Base = BaseName.IsEmpty() ? FString(TEXT("Favorite")) : BaseName.Left(NAME_SIZE - 16);
+	FName Name(*Base);
+	for (int32 Suffix = 2; Favorites.Contains(Name); ++Suffix)
+	{
+		Name = FName(*FString::Printf(TEXT("%s_%d"), *Base, Suffix));
+	}
+	return Name;
+}
+#pragma endregion
+
+#pragma region Import
+bool FLevelSelectorCameraFavoriteTransfer::IsJsonFile(const FString& Filename)
+{
+	return FPaths::GetExtension(Filename).Equals(TEXT("json"), ESearchCase::IgnoreCase);
+}
+
+bool FLevelSelectorCameraFavoriteTransfer::Import(const FString& Filename, TMap<FName, FTransform>& OutFavorites)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	const int32 NumBefore = OutFavorites.Num();
+	const bool bRead = IsJsonFile(Filename) ? ImportJson(Filename, OutFavorites) : ImportCsv(Filename, OutFavorites);
+	if (!bRead)
+	{
+		UE_LOG(LogBDCLevelSelector, Error, TEXT("Could not read camera favorites from %s."), *Filename);
+		return false;
+	}
+
+	UE_LOG(LogBDCLevelSelector, Log, TEXT("Read %d camera favorites from %s in %.1f ms."), OutFavorites.Num() - NumBefore, *Filename,
+		(FPlatformTime::Seconds() - StartTime) * 1000.0);
+	return true;
+}
+
+bool FLevelSelectorCameraFavoriteTransfer::ImportCsv(const FString& Filename, TMap<FName, FTransform>& OutFavorites)
+{
+	FLevelSelectorLineReader Reader(Filename);
+	if (!Reader.IsOpen())
+	{
+		return false;
+	}
+
+	FString Line;
+	int32 NumSkipped = 0;
+	bool bFirstLine = true;
+	while (Reader.ReadLine(Line))
+	{
+		// The header row is optional, a first row that does not parse is taken for one.
+		FName Name;
+		FTransform Transform;
+		if (ParseCsvLine(Line, Name, Transform))
+		{
+			OutFavorites.Add(Name, Transform);
+		}
+		else if (!bFirstLine && !Line.TrimStartAndEnd().IsEmpty())
+		{
+			++NumSkipped;
+		}
+		bFirstLine = false;
+	}
+
+	if (NumSkipped > 0)
+	{
+		UE_LOG(LogBDCLevelSelector, Warning, TEXT("Skipped %d rows of %s that are not \"%s\"."), NumSkipped, *Filename, LevelSelectorCameraFavoriteTransfer::CsvHeader);
+	}
+	return true;
+}
+
+bool FLevelSelectorCameraFavoriteTransfer::ParseCsvLine(const FString& Line, FName& OutName, FTransform& OutTransform)
+{
+	// Only the name can be quoted, the six numbers follow it.
+	FString Name;
+	int32 NumbersStart = 0;
+	if (Line.StartsWith(TEXT("\"")))
+	{
+		int32 Index = 1;
+		for (; Index < Line.Len(); ++Index)
+		{
+			if (Line[Index] == TEXT('"'))
+			{
+				if (Index + 1 < Line.Len() && Line[Index + 1] == TEXT('"'))
+				{
+					Name.AppendChar(TEXT('"'));
+					++Index;
+					continue;
+				}
+				break;
+			}
+			Name.AppendChar(Line[Index]);
+		}
+		NumbersStart = Index + 1;
+	}
+	else
+	{
+		const int32 Comma = Line.Find(TEXT(","));
+		Name = Comma == INDEX_NONE ? Line : Line.Left(Comma);
+		NumbersStart = Comma == INDEX_NONE ? Line.Len() : Comma;
+	}
+
+	if (NumbersStart >= Line.Len() || Line[NumbersStart] != TEXT(','))
+	{
+		return false;
+	}
+
+	TArray<FString> Fields;
+	Line.Mid(NumbersStart + 1).ParseIntoArray(Fields, TEXT(","), false);
+	Name.TrimStartAndEndInline();
+	if (Fields.Num() != 6 || !FLevelSelectorCameraFavoriteStore::IsValidFavoriteName(Name))
+	{
+		return false;
+	}
+
+	double Values[6];
+	for (int32 Index = 0; Index < 6; ++Index)
+	{
+		const FString Field = Fields[Index].TrimStartAndEnd();
+		if (!Field.IsNumeric())
+		{
+			return false;
+		}
+		LexFromString(Values[Index], *Field);
+	}
+
+	OutName = FName(*Name);
+	OutTransform = FTransform(FRotator(Values[3], Values[4], Values[5]), FVector(Values[0], Values[1], Values[2]));
+	return true;
+}
+
+bool FLevelSelectorCameraFavoriteTransfer::ImportJson(const FString& Filename, TMap<FName, FTransform>& OutFavorites)
+{
+	FLevelSelectorLineReader Reader(Filename);
+	if (!Reader.IsOpen())
+	{
+		return false;
+	}
+
+	// Favorites are the innermost objects of the file, {"Name": "A", "Location": [X, Y, Z], "Rotation": [Pitch, Yaw, Roll]}.
+	// Each one is cut out and parsed on its own, only one favorite is held as text at a time whatever wraps them.
+	FString Line;
+	FString ObjectText;
+	bool bInObject = false;
+	bool bInString = false;
+	bool bEscaped = false;
+	int32 NumSkipped = 0;
+	while (Reader.ReadLine(Line))
+	{
+		for (const TCHAR Char : Line)
+		{
+			if (bInString)
+			{
+				bInString = bEscaped || Char != TEXT('"');
+				bEscaped = !bEscaped && Char == TEXT('\\');
+			}
+			else if (Char == TEXT('"'))
+			{
+				bInString = true;
+			}
+			else if (Char == TEXT('{'))
+			{
+				ObjectText.Reset();
+				bInObject = true;
+			}
+
+			if (bInObject)
+			{
+				ObjectText.AppendChar(Char);
+			}
+
+			if (!bInString && Char == TEXT('}') && bInObject)
+			{
+				bInObject = false;
+				FName Name;
+				FTransform Transform;
+				if (ParseJsonObject(ObjectText, Name, Transform))
+				{
+					OutFavorites.Add(Name, Transform);
+				}
+				else
+				{
+					++NumSkipped;
+				}
+			}
+		}
+		if (bInObject)
+		{
+			ObjectText.AppendChar(TEXT('\n'));
+		}
+	}
+
+	if (NumSkipped > 0)
+	{
+		UE_LOG(LogBDCLevelSelector, Warning, TEXT("Skipped %d objects of %s without a name, location and rotation."), NumSkipped, *Filename);
+	}
+	return true;
+}
+
+bool FLevelSelectorCameraFavoriteTransfer::ParseJsonObject(const FString& ObjectText, FName& OutName, FTransform& OutTransform)
+{
+	TSharedPtr<FJsonObject> Object;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(ObjectText), Object) || !Object.IsValid())
+	{
+		return false;
+	}
+
+	FString Name;
+	const TArray<TSharedPtr<FJsonValue>>* Location = nullptr;
+	const TArray<TSharedPtr<FJsonValue>>* Rotation = nullptr;
+	if (!Object->TryGetStringField(TEXT("Name"), Name) || !FLevelSelectorCameraFavoriteStore::IsValidFavoriteName(Name)
+		|| !Object->TryGetArrayField(TEXT("Location"), Location) || Location->Num() != 3
+		|| !Object->TryGetArrayField(TEXT("Rotation"), Rotation) || Rotation->Num() != 3)
+	{
+		return false;
+	}
+
+	OutName = FName(*Name);
+	OutTransform = FTransform(
+		FRotator((*Rotation)[0]->AsNumber(), (*Rotation)[1]->AsNumber(), (*Rotation)[2]->AsNumber()),
+		FVector((*Location)[0]->AsNumber(), (*Location)[1]->AsNumber(), (*Location)[2]->AsNumber()));
+	return true;
+}
+#pragma endregion
+
+#pragma region Export
+bool FLevelSelectorCameraFavoriteTransfer::Export(const FString& Filename, const FCameraFavorite& Favorites)
+{
+	TArray<FName> Names;
+	Favorites.HoldFavorites.GetKeys(Names);
+	Names.Sort(FNameLexicalLess());
+
+	const bool bJson = IsJsonFile(Filename);
+	FLevelSelectorLineWriter Writer(Filename);
+	Writer.WriteLine(bJson ? TEXT("{") LINE_TERMINATOR TEXT("\t\"Favorites\": [") : LevelSelectorCameraFavoriteTransfer::CsvHeader);
+
+	TStringBuilder<256> Line;
+	for (int32 Index = 0; Index < Names.Num(); ++Index)
+	{
+		const FTransform& Transform = Favorites.HoldFavorites[Names[Index]];
+		const FVector Location = Transform.GetLocation();
+		const FRotator Rotation = Transform.Rotator();
+		const FString Name = Names[Index].ToString();
+
+		Line.Reset();
+		if (bJson)
+		{
+			Line.Appendf(TEXT("\t\t{ \"Name\": \"%s\", \"Location\": [%.3f, %.3f, %.3f], \"Rotation\": [%.3f, %.3f, %.3f] }%s"),
+				*LevelSelectorCameraFavoriteTransfer::EscapeJson(Name), Location.X, Location.Y, Location.Z,
+				Rotation.Pitch, Rotation.Yaw, Rotation.Roll, Index + 1 < Names.Num() ? TEXT(",") : TEXT(""));
+		}
+		else
+		{
+			Line.Appendf(TEXT("%s,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f"), *LevelSelectorCameraFavoriteTransfer::EscapeCsv(Name),
+				Location.X, Location.Y, Location.Z, Rotation.Pitch, Rotation.Yaw, Rotation.Roll);
+		}
+		Writer.WriteLine(Line);
+	}
+
+	if (bJson)
+	{
+		Writer.WriteLine(TEXT("\t]") LINE_TERMINATOR TEXT("}"));
+	}
+
+	if (!Writer.Close())
+	{
+		UE_LOG(LogBDCLevelSelector, Error, TEXT("Could not write camera favorites to %s."), *Filename);
+		return false;
+	}
+	return true;
+}
+#pragma endregion
@@ -0,0 +1,290 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "LevelSelectorCameraSpatialIndex.h"
+#include "Algo/Sort.h"
+
+FLevelSelectorCameraSpatialIndex::FLevelSelectorCameraSpatialIndex(double InCellSize)
+	: CellSize(FMath::Max(InCellSize, 1.0))
+{
+}
+
+#pragma region Maintenance
+void FLevelSelectorCameraSpatialIndex::Add(FName Name, const FVector& Location)
+{
+	if (const int32* Existing = EntryByName.Find(Name))
+	{
+		FEntry& Entry = Entries[*Existing];
+		const FIntVector NewCell = GetCell(Location);
+		Entry.Location = Location;
+		if (NewCell == Entry.Cell)
+		{
+			return;
+		}
+		RemoveFromCell(*Existing);
+		Entry.Cell = NewCell;
+		Cells.FindOrAdd(NewCell).Add(*Existing);
+	}
+	else
+	{
+		const int32 EntryIndex = Entries.Add({ Name, Location, GetCell(Location) });
+		EntryByName.Add(Name, EntryIndex);
+		Cells.FindOrAdd(Entries[EntryIndex].Cell).Add(EntryIndex);
+	}
+
+	const FIntVector& Cell = Entries[EntryByName[Name]].Cell;
+	if (Entries.Num() == 1)
+	{
+		MinCell = MaxCell = Cell;
+	}
+	else
+	{
+		MinCell = FIntVector(FMath::Min(MinCell.X, Cell.X), FMath::Min(MinCell.Y, Cell.Y), FMath::Min(MinCell.Z, Cell.Z));
+		MaxCell = FIntVector(FMath::Max(MaxCell.X, Cell.X), FMath::Max(MaxCell.Y, Cell.Y), FMath::Max(MaxCell.Z, Cell.Z));
+	}
+}
+
+bool FLevelSelectorCameraSpatialIndex::Remove(FName Name)
+{
+	int32 EntryIndex = INDEX_NONE;
+	if (!EntryByName.RemoveAndCopyValue(Name, EntryIndex))
+	{
+		return false;
+	}
+	RemoveFromCell(EntryIndex);
+
+	// The last entry takes the free slot, its cell has to point to the new index.
+	const int32 LastIndex = Entries.Num() - 1;
+	if (EntryIndex != LastIndex)
+	{
+		const FEntry& Moved = Entries[LastIndex];
+		Cells.FindChecked(Moved.Cell).Remove(LastIndex);
+		Cells.FindChecked(Moved.Cell).Add(EntryIndex);
+		EntryByName[Moved.Name] = EntryIndex;
+	}
+	Entries.RemoveAtSwap(EntryIndex);
+	return true;
+}
+
+bool FLevelSelectorCameraSpatialIndex::Rename(FName OldName, FName NewName)
+{
+	int32 EntryIndex = INDEX_NONE;
+	if (OldName == NewName || EntryByName.Contains(NewName) || !EntryByName.RemoveAndCopyValue(OldName, EntryIndex))
+	{
+		return false;
+	}
+	Entries[EntryIndex].Name = NewName;
+	EntryByName.Add(NewName, EntryIndex);
+	return true;
+}
+
+void FLevelSelectorCameraSpatialIndex::Reset()
+{
+	Entries.Reset();
+	EntryByName.Reset();
+	Cells.Reset();
+	MinCell = MaxCell = FIntVector::ZeroValue;
+}
+
+FIntVector FLevelSelectorCameraSpatialIndex::GetCell(const FVector& Location) const
+{
+	return FIntVector(
+		FMath::FloorToInt32(Location.X / CellSize),
+		FMath::FloorToInt32(Location.Y / CellSize),
+		FMath::FloorToInt32(Location.Z / CellSize));
+}
+
+void FLevelSelectorCameraSpatialIndex::RemoveFromCell(int32 EntryIndex)
+{
+	const FIntVector Cell = Entries[EntryIndex].Cell;
+	FCellEntries& CellEntries = Cells.FindChecked(Cell);
+	CellEntries.RemoveSingleSwap(EntryIndex);
+	if (CellEntries.IsEmpty())
+	{
+		Cells.Remove(Cell);
+	}
+}
+#pragma endregion
+
+#pragma region Queries
+int32 FLevelSelectorCameraSpatialIndex::GetMaxRing(const FIntVector& Center) const
+{
+	const FIntVector ToMin = MinCell - Center;
+	const FIntVector ToMax = MaxCell - Center;
+	return FMath::Max3(
+		FMath::Max(FMath::Abs(ToMin.X), FMath::Abs(ToMax.X)),
+		FMath::Max(FMath::Abs(ToMin.Y), FMath::Abs(ToMax.Y)),
+		FMath::Max(FMath::Abs(ToMin.Z), FMath::Abs(ToMax.Z)));
+}
+
+int32 FLevelSelectorCameraSpatialIndex::GetLastRingWithin(const FIntVector& Center, double Distance) const
+{
+	// Everything in ring r is at least (r - 1) * CellSize away.
+	const int32 MaxRing = GetMaxRing(Center);
+	const double Rings = Distance / CellSize + 1.0;
+	return Rings >= MaxRing ? MaxRing : FMath::FloorToInt32(Rings);
+}
+
+template <typename VisitorType>
+void FLevelSelectorCameraSpatialIndex::FRingWalker::Visit(int32 Ring, VisitorType&& Visitor)
+{
+	const auto VisitEntries = [this, &Visitor](const FCellEntries& CellEntries)
+	{
+		for (const int32 EntryIndex : CellEntries)
+		{
+			Visitor(Index.Entries[EntryIndex]);
+		}
+	};
+
+	// A wide ring around sparse favorites has more cells than the grid has occupied, from there on the occupied cells are read instead.
+	const int64 Side = 2 * static_cast<int64>(Ring) + 1;
+	const int64 NumRingCells = Ring == 0 ? 1 : Side * Side * Side - (Side - 2) * (Side - 2) * (Side - 2);
+	if (!bBucketed && NumRingCells > Index.Cells.Num())
+	{
+		bBucketed = true;
+		BucketedCells.Reserve(Index.Cells.Num());
+		for (const auto& Pair : Index.Cells)
+		{
+			const FIntVector Offset = Pair.Key - Center;
+			const int32 CellRing = FMath::Max3(FMath::Abs(Offset.X), FMath::Abs(Offset.Y), FMath::Abs(Offset.Z));
+			if (CellRing >= Ring)
+			{
+				BucketedCells.Emplace(CellRing, &Pair.Value);
+			}
+		}
+		Algo::SortBy(BucketedCells, [](const TPair<int32, const FCellEntries*>& Bucketed) { return Bucketed.Key; });
+	}
+
+	if (bBucketed)
+	{
+		for (; NextBucketedCell < BucketedCells.Num() && BucketedCells[NextBucketedCell].Key <= Ring; ++NextBucketedCell)
+		{
+			if (BucketedCells[NextBucketedCell].Key == Ring)
+			{
+				VisitEntries(*BucketedCells[NextBucketedCell].Value);
+			}
+		}
+		return;
+	}
+
+	for (int32 X = -Ring; X <= Ring; ++X)
+	{
+		for (int32 Y = -Ring; Y <= Ring; ++Y)
+		{
+			// Inside the ring's side walls only the top and bottom cells belong to it.
+			const bool bOnSide = FMath::Abs(X) == Ring || FMath::Abs(Y) == Ring;
+			for (int32 Z = -Ring; Z <= Ring; Z += bOnSide || Ring == 0 ? 1 : 2 * Ring)
+			{
+				if (const FCellEntries* CellEntries = Index.Cells.Find(Center + FIntVector(X, Y, Z)))
+				{
+					VisitEntries(*CellEntries);
+				}
+			}
+		}
+	}
+}
+
+bool FLevelSelectorCameraSpatialIndex::FindNearest(const FVector& Origin, FHit& OutHit) const
+{
+	return FindNext(Origin, -1.0, NAME_None, OutHit);
+}
+
+bool FLevelSelectorCameraSpatialIndex::FindNext(const FVector& Origin, double Distance, FName Name, FHit& OutHit) const
+{
+	if (Entries.IsEmpty())
+	{
+		return false;
+	}
+
+	const FIntVector Center = GetCell(Origin);
+	const int32 MaxRing = GetMaxRing(Center);
+
+	// Every cell of ring r is within (r + 1) * CellSize * sqrt(3) of the origin, rings entirely closer than Distance are skipped.
+	const double SkippedRings = Distance / (CellSize * UE_SQRT_3) - 1.0;
+	const int32 FirstRing = SkippedRings >= MaxRing ? MaxRing : FMath::Max(0, FMath::FloorToInt32(SkippedRings));
+
+	FRingWalker Walker(*this, Center);
+	bool bFound = false;
+	for (int32 Ring = FirstRing; Ring <= MaxRing; ++Ring)
+	{
+		// Everything from this ring outwards is at least (Ring - 1) * CellSize away.
+		if (bFound && (Ring - 1) * CellSize > OutHit.Distance)
+		{
+			break;
+		}
+
+		Walker.Visit(Ring, [&](const FEntry& Entry)
+		{
+			const double EntryDistance = FVector::Dist(Origin, Entry.Location);
+			if (IsLess(Distance, Name, EntryDistance, Entry.Name) && (!bFound || IsLess(EntryDistance, Entry.Name, OutHit.Distance, OutHit.Name)))
+			{
+				OutHit = { Entry.Name, Entry.Location, EntryDistance };
+				bFound = true;
+			}
+		});
+	}
+	return bFound;
+}
+
+bool FLevelSelectorCameraSpatialIndex::FindPrevious(const FVector& Origin, double Distance, FName Name, FHit& OutHit) const
+{
+	if (Entries.IsEmpty())
+	{
+		return false;
+	}
+
+	// Rings starting further out than Distance hold nothing before it.
+	const FIntVector Center = GetCell(Origin);
+	const int32 LastRing = GetLastRingWithin(Center, Distance);
+
+	FRingWalker Walker(*this, Center);
+	bool bFound = false;
+	for (int32 Ring = 0; Ring <= LastRing; ++Ring)
+	{
+		Walker.Visit(Ring, [&](const FEntry& Entry)
+		{
+			const double EntryDistance = FVector::Dist(Origin, Entry.Location);
+			if (IsLess(EntryDistance, Entry.Name, Distance, Name) && (!bFound || IsLess(OutHit.Distance, OutHit.Name, EntryDistance, Entry.Name)))
+			{
+				OutHit = { Entry.Name, Entry.Location, EntryDistance };
+				bFound = true;
+			}
+		});
+	}
+	return bFound;
+}
+
+void FLevelSelectorCameraSpatialIndex::FindInRadius(const FVector& Origin, double Radius, TArray<FHit>& OutHits) const
+{
+	if (Entries.IsEmpty() || Radius < 0.0)
+	{
+		return;
+	}
+
+	const FIntVector Center = GetCell(Origin);
+	const int32 LastRing = GetLastRingWithin(Center, Radius);
+	const int32 FirstHit = OutHits.Num();
+	FRingWalker Walker(*this, Center);
+	for (int32 Ring = 0; Ring <= LastRing; ++Ring)
+	{
+		Walker.Visit(Ring, [&](const FEntry& Entry)
+		{
+			const double EntryDistance = FVector::Dist(Origin, Entry.Location);
+			if (EntryDistance <= Radius)
+			{
+				OutHits.Add({ Entry.Name, Entry.Location, EntryDistance });
+			}
+		});
+	}
+
+	Algo::Sort(MakeArrayView(OutHits).Slice(FirstHit, OutHits.Num() - FirstHit), [](const FHit& A, const FHit& B)
+	{
+		return IsLess(A.Distance, A.Name, B.Distance, B.Name);
+	});
+}
+#pragma endregion
@@ -0,0 +1,108 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "LevelSelectorConfigWriter.h"
+#include "BDC_LevelSelector.h"
+#include "LevelSelectorStats.h"
+
+FLevelSelectorConfigWriter::FLevelSelectorConfigWriter(UObject* InConfigObject)
+	: ConfigObject(InConfigObject)
+{
+}
+
+FLevelSelectorConfigWriter::~FLevelSelectorConfigWriter()
+{
+	if (QuietPeriodTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(QuietPeriodTickerHandle);
+	}
+}
+
+void FLevelSelectorConfigWriter::RequestSave(float QuietPeriodSeconds)
+{
+	++Stats.RequestedSaves;
+	if (bDirty)
+	{
+		++Stats.CoalescedSaves;
+	}
+
+	bDirty = true;
+	LastRequestTime = FPlatformTime::Seconds();
+	QuietPeriod = FMath::Max(QuietPeriodSeconds, 0.0f);
+
+	if (QuietPeriod <= 0.0f)
+	{
+		Flush();
+		return;
+	}
+
+	if (!QuietPeriodTickerHandle.IsValid())
+	{
+		QuietPeriodTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FLevelSelectorConfigWriter::OnQuietPeriodTick), QuietPeriod);
+	}
+}
+
+bool FLevelSelectorConfigWriter::OnQuietPeriodTick(float DeltaTime)
+{
+	if (FPlatformTime::Seconds() - LastRequestTime < QuietPeriod)
+	{
+		return true;
+	}
+
+	QuietPeriodTickerHandle.Reset();
+	Flush();
+	return false;
+}
+
+void FLevelSelectorConfigWriter::Cancel()
+{
+	if (QuietPeriodTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(QuietPeriodTickerHandle);
+		QuietPeriodTickerHandle.Reset();
+	}
+	bDirty = false;
+}
+
+void FLevelSelectorConfigWriter::Flush()
+{
+	if (QuietPeriodTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(QuietPeriodTickerHandle);
+		QuietPeriodTickerHandle.Reset();
+	}
+
+	if (!bDirty)
+	{
+		return;
+	}
+	bDirty = false;
+
+	UObject* Object = ConfigObject.Get();
+	if (!Object)
+	{
+		return;
+	}
+
+	LEVELSELECTOR_SCOPE_CYCLE_COUNTER(STAT_LevelSelector_SettingsWrite);
+	++Stats.IssuedWrites;
+	INC_DWORD_STAT(STAT_LevelSelector_ConfigWrites);
+	UE_LOG(LogBDCLevelSelector, Verbose, TEXT("Writing %s (%d save requests, %d coalesced, %d writes)"),
+		*Object->GetClass()->GetName(), Stats.RequestedSaves, Stats.CoalescedSaves, Stats.IssuedWrites);
+
+	// Goes through the engine so GConfig stays in sync and only the diff against the base config is written.
+	// Per user classes have no default config file and are written to their own config instead.
+	if (!Object->GetClass()->HasAnyClassFlags(CLASS_DefaultConfig))
+	{
+		Object->SaveConfig();
+	}
+	else if (!Object->TryUpdateDefaultConfigFile())
+	{
+		UE_LOG(LogBDCLevelSelector, Warning, TEXT("Can't save level selector settings, %s is not writable."), *Object->GetDefaultConfigFilename());
+	}
+}
@@ -0,0 +1,747 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "LevelSelectorIndex.h"
+#include "BDC_LevelSelectorSettings.h"
+#include "BDC_LevelSelectorUserSettings.h"
+#include "BDC_LevelSelector.h"
+#include "LevelSelectorIndexCache.h"
+#include "LevelSelectorStats.h"
+#include "Algo/IsSorted.h"
+#include "Algo/Sort.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/ARFilter.h"
+#include "Engine/World.h"
+#include "Misc/PackageName.h"
+#include "Misc/StringBuilder.h"
+#include "Modules/ModuleManager.h"
+
+FLevelSelectorItem::FLevelSelectorItem(const FAssetData& InAssetData) : AssetData(InAssetData)
+{
+	DisplayName = AssetData.AssetName.ToString();
+	PackagePath = InAssetData.GetSoftObjectPath().GetLongPackageName();
+	PackageName = InAssetData.PackageName;
+	RefreshCachedState(GetDefault<UBDC_LevelSelectorSettings>());
+}
+
+void FLevelSelectorItem::RefreshCachedState(const UBDC_LevelSelectorSettings* Settings)
+{
+	bIsFavorite = Settings && Settings->IsFavorite(PackageName);
+	Tags = Settings ? Settings->GetLevelTags(PackageName) : FGameplayTagContainer();
+	bHasCameraFavorites = Settings && Settings->HasCameraFavorites(PackageName);
+	FrecencyKey = GetDefault<UBDC_LevelSelectorUserSettings>()->GetFrecencyKey(PackageName);
+}
+
+void FLevelSelectorIndexDelta::Reset()
+{
+	Removed.Reset();
+	Updated.Reset();
+	Added.Reset();
+	bFullRefresh = false;
+}
+
+#pragma region Lifecycle
+FLevelSelectorIndex::FLevelSelectorIndex()
+{
+	// Indexes that are only fed through Reconcile, like the benchmark's, need the content roots too.
+	CompileContentRootFilter();
+}
+
+FLevelSelectorIndex::~FLevelSelectorIndex()
+{
+	Shutdown();
+}
+
+void FLevelSelectorIndex::Initialize()
+{
+	if (bInitialized)
+	{
+		return;
+	}
+	bInitialized = true;
+	CompileContentRootFilter();
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	AssetRegistry.OnAssetAdded().AddRaw(this, &FLevelSelectorIndex::OnAssetAdded);
+	AssetRegistry.OnAssetRemoved().AddRaw(this, &FLevelSelectorIndex::OnAssetRemoved);
+	AssetRegistry.OnAssetRenamed().AddRaw(this, &FLevelSelectorIndex::OnAssetRenamed);
+	GetMutableDefault<UBDC_LevelSelectorSettings>()->OnSettingChanged().AddRaw(this, &FLevelSelectorIndex::OnSettingsChanged);
+	GetMutableDefault<UBDC_LevelSelectorSettings>()->OnCameraFavoritesChanged().AddRaw(this, &FLevelSelectorIndex::OnCameraFavoritesChanged);
+	FPackageName::OnContentPathMounted().AddRaw(this, &FLevelSelectorIndex::OnContentPathMounted);
+	FPackageName::OnContentPathDismounted().AddRaw(this, &FLevelSelectorIndex::OnContentPathDismounted);
+
+	if (AssetRegistry.IsLoadingAssets())
+	{
+		// Individual add events of the initial scan are ignored, OnFilesLoaded reconciles them in one pass.
+		AssetRegistry.OnFilesLoaded().AddRaw(this, &FLevelSelectorIndex::OnAssetRegistryFilesLoaded);
+		if (!LoadFromCache())
+		{
+			Rescan();
+		}
+	}
+	else
+	{
+		OnAssetRegistryFilesLoaded();
+	}
+}
+
+void FLevelSelectorIndex::Shutdown()
+{
+	if (!bInitialized)
+	{
+		return;
+	}
+	bInitialized = false;
+
+	if (FlushTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(FlushTickerHandle);
+		FlushTickerHandle.Reset();
+	}
+
+	if (FModuleManager::Get().IsModuleLoaded("AssetRegistry"))
+	{
+		IAssetRegistry& AssetRegistry = FModuleManager::GetModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+		AssetRegistry.OnAssetAdded().RemoveAll(this);
+		AssetRegistry.OnAssetRemoved().RemoveAll(this);
+		AssetRegistry.OnAssetRenamed().RemoveAll(this);
+		AssetRegistry.OnFilesLoaded().RemoveAll(this);
+	}
+	FPackageName::OnContentPathMounted().RemoveAll(this);
+	FPackageName::OnContentPathDismounted().RemoveAll(this);
+
+	if (UObjectInitialized())
+	{
+		GetMutableDefault<UBDC_LevelSelectorSettings>()->OnSettingChanged().RemoveAll(this);
+		GetMutableDefault<UBDC_LevelSelectorSettings>()->OnCameraFavoritesChanged().RemoveAll(this);
+	}
+
+	// An index that never saw the finished registry is no better than the cache it may have come from.
+	if (bFilesLoaded)
+	{
+		SaveCache(true);
+	}
+	CacheWriteTask.Wait();
+}
+#pragma endregion
+
+#pragma region Asset Registry Events
+void FLevelSelectorIndex::OnAssetRegistryFilesLoaded()
+{
+	LEVELSELECTOR_SCOPE_CYCLE_COUNTER(STAT_LevelSelector_FilesLoaded);
+	bFilesLoaded = true;
+
+	if (UBDC_LevelSelectorSettings* MutableSettings = GetMutableDefault<UBDC_LevelSelectorSettings>())
+	{
+		const IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+		TArray<TSoftObjectPtr<UWorld>> FavoriteLevelsToRemove;
+		for (const auto& FavoritePath : MutableSettings->FavoriteLevels)
+		{
+			if (FavoritePath.IsValid())
+			{
+				const FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(FavoritePath.ToSoftObjectPath());
+				if (!AssetData.IsValid())
+				{
+					FavoriteLevelsToRemove.Add(FavoritePath);
+				}
+			}
+		}
+
+		TArray<TSoftObjectPtr<UWorld>> HoldKeys;
+		MutableSettings->LevelTagContainers.GetKeys(HoldKeys);
+		for (const auto& KeyPath : HoldKeys)
+		{
+			if (KeyPath.IsValid())
+			{
+				const FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(KeyPath.ToSoftObjectPath());
+				if (!AssetData.IsValid())
+				{
+					MutableSettings->LevelTagContainers.Remove(KeyPath);
+				}
+			}
+		}
+
+		for (const auto& LevelToRemove : FavoriteLevelsToRemove)
+		{
+			MutableSettings->FavoriteLevels.Remove(LevelToRemove);
+		}
+		MutableSettings->RebuildLevelLookups();
+
+		MutableSettings->CollectCameraFavoriteGarbage([&AssetRegistry](FName PackageName)
+		{
+			TArray<FAssetData> PackageAssets;
+			AssetRegistry.GetAssetsByPackageName(PackageName, PackageAssets, true);
+			return !PackageAssets.IsEmpty();
+		});
+	}
+
+	Rescan();
+	SaveCache(false);
+
+	if (FModuleManager::Get().IsModuleLoaded("AssetRegistry"))
+	{
+		FModuleManager::GetModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get().OnFilesLoaded().RemoveAll(this);
+	}
+}
+
+void FLevelSelectorIndex::OnAssetAdded(const FAssetData& AssetData)
+{
+	if (!bFilesLoaded || !ShouldIndex(AssetData))
+	{
+		return;
+	}
+	AddItem(AssetData);
+	ScheduleFlush();
+}
+
+void FLevelSelectorIndex::OnAssetRemoved(const FAssetData& AssetData)
+{
+	if (!bFilesLoaded || !ItemsByPackage.Contains(AssetData.PackageName))
+	{
+		return;
+	}
+	RemoveItem(AssetData.PackageName);
+	ScheduleFlush();
+}
+
+void FLevelSelectorIndex::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	if (!bFilesLoaded)
+	{
+		return;
+	}
+
+	const FName OldPackageName(*FPackageName::ObjectPathToPackageName(OldObjectPath));
+	if (AssetData.AssetClassPath == UWorld::StaticClass()->GetClassPathName() && OldPackageName != AssetData.PackageName)
+	{
+		GetMutableDefault<UBDC_LevelSelectorSettings>()->MoveCameraFavorites(OldPackageName, AssetData.PackageName);
+	}
+	if (ItemsByPackage.Contains(OldPackageName))
+	{
+		RemoveItem(OldPackageName);
+		ScheduleFlush();
+	}
+	if (ShouldIndex(AssetData))
+	{
+		AddItem(AssetData);
+		ScheduleFlush();
+	}
+}
+
+void FLevelSelectorIndex::OnContentPathMounted(const FString& AssetPath, const FString& ContentPath)
+{
+	// Before the registry finished, OnFilesLoaded reconciles everything anyway.
+	if (!bFilesLoaded || !ContentRootFilter.CouldMatchBelow(AssetPath))
+	{
+		return;
+	}
+	RescanRoot(AssetPath);
+}
+
+void FLevelSelectorIndex::OnContentPathDismounted(const FString& AssetPath, const FString& ContentPath)
+{
+	TArray<FName> DismountedPackages;
+	for (const auto& Pair : ItemsByPackage)
+	{
+		if (Pair.Value->PackagePath.StartsWith(AssetPath, ESearchCase::IgnoreCase))
+		{
+			DismountedPackages.Add(Pair.Key);
+		}
+	}
+	if (DismountedPackages.IsEmpty())
+	{
+		return;
+	}
+
+	for (const FName& PackageName : DismountedPackages)
+	{
+		RemoveItem(PackageName);
+	}
+	FlushPendingChanges();
+}
+#pragma endregion
+
+#pragma region Index Maintenance
+void FLevelSelectorIndex::Rescan()
+{
+	const IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	TArray<FAssetData> AssetDataList;
+	AssetRegistry.GetAssetsByClass(UWorld::StaticClass()->GetClassPathName(), AssetDataList);
+	Reconcile(AssetDataList);
+}
+
+void FLevelSelectorIndex::RescanRoot(FStringView RootPath)
+{
+	FStringView PackagePath = RootPath;
+	PackagePath.TrimEndInline();
+	while (PackagePath.Len() > 1 && PackagePath.EndsWith(TEXT('/')))
+	{
+		PackagePath.LeftChopInline(1);
+	}
+
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UWorld::StaticClass()->GetClassPathName());
+	Filter.PackagePaths.Add(FName(PackagePath));
+	Filter.bRecursivePaths = true;
+
+	const IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	TArray<FAssetData> AssetDataList;
+	AssetRegistry.GetAssets(Filter, AssetDataList);
+	Reconcile(AssetDataList, RootPath);
+}
+
+void FLevelSelectorIndex::Reconcile(TConstArrayView<FAssetData> AssetDataList, FStringView RootPath)
+{
+	LEVELSELECTOR_SCOPE_CYCLE_COUNTER(STAT_LevelSelector_PopulateLevelList);
+	TSet<FName> SeenPackages;
+	SeenPackages.Reserve(AssetDataList.Num());
+
+	TArray<TSharedPtr<FLevelSelectorItem>> NewItems;
+	for (const FAssetData& Data : AssetDataList)
+	{
+		if (!ShouldIndex(Data))
+		{
+			continue;
+		}
+
+		bool bAlreadySeen = false;
+		SeenPackages.Add(Data.PackageName, &bAlreadySeen);
+		if (bAlreadySeen)
+		{
+			continue;
+		}
+		if (const TSharedPtr<FLevelSelectorItem>* ExistingItem = ItemsByPackage.Find(Data.PackageName))
+		{
+			// Items seeded from the cache carry a minimal asset data, the registry's one replaces it.
+			(*ExistingItem)->AssetData = Data;
+			continue;
+		}
+
+		NewItems.Add(CreateItem(Data));
+	}
+
+	TArray<FName> StalePackages;
+	for (const auto& Pair : ItemsByPackage)
+	{
+		if (!SeenPackages.Contains(Pair.Key) && Pair.Value->PackagePath.StartsWith(RootPath, ESearchCase::IgnoreCase))
+		{
+			StalePackages.Add(Pair.Key);
+		}
+	}
+	for (const FName& PackageName : StalePackages)
+	{
+		RemoveItem(PackageName);
+	}
+
+	// Small and bulk additions alike are sorted and merged once, by the first read of the index.
+	for (const TSharedPtr<FLevelSelectorItem>& Item : NewItems)
+	{
+		InsertSorted(Item);
+	}
+	PendingDelta.Added.Append(NewItems);
+	SET_DWORD_STAT(STAT_LevelSelector_ItemsIndexed, ItemsByPackage.Num());
+
+	FlushPendingChanges();
+}
+
+void FLevelSelectorIndex::UpdateItem(const TSharedPtr<FLevelSelectorItem>& Item, TFunctionRef<void()> Mutation)
+{
+	if (!Item.IsValid() || ItemsByPackage.FindRef(Item->PackageName) != Item)
+	{
+		Mutation();
+		if (Item.IsValid())
+		{
+			Item->RefreshCachedState(GetDefault<UBDC_LevelSelectorSettings>());
+		}
+		return;
+	}
+
+	RemoveSorted(Item);
+	Mutation();
+	RefreshItem(Item);
+
+	if (!ShouldIndex(Item->AssetData))
+	{
+		ItemsByPackage.Remove(Item->PackageName);
+		SearchIndex.Remove(Item->SearchId);
+		TagIndex.Remove(Item->SearchId);
+		ItemsBySearchId[Item->SearchId].Reset();
+		Item->SearchId = INDEX_NONE;
+		if (PendingDelta.Added.Remove(Item) == 0)
+		{
+			PendingDelta.Updated.Remove(Item);
+			PendingDelta.Removed.Add(Item);
+		}
+	}
+	else
+	{
+		InsertSorted(Item);
+		if (!PendingDelta.Added.Contains(Item))
+		{
+			PendingDelta.Updated.AddUnique(Item);
+		}
+	}
+
+	FlushPendingChanges();
+}
+
+TSharedPtr<FLevelSelectorItem> FLevelSelectorIndex::FindItem(FName PackageName) const
+{
+	return ItemsByPackage.FindRef(PackageName);
+}
+
+void FLevelSelectorIndex::FindMatches(FStringView FoldedQuery, TArray<TSharedPtr<FLevelSelectorItem>>& OutItems) const
+{
+	TArray<int32> MatchingIds;
+	SearchIndex.Find(FoldedQuery, MatchingIds);
+
+	OutItems.Reserve(OutItems.Num() + MatchingIds.Num());
+	for (const int32 Id : MatchingIds)
+	{
+		OutItems.Add(ItemsBySearchId[Id]);
+	}
+}
+
+void FLevelSelectorIndex::GetFilteredItems(FStringView FoldedQuery, const FLevelSelectorTagIndex::FQuery& TagQuery, TArray<TSharedPtr<FLevelSelectorItem>>& OutItems) const
+{
+	LEVELSELECTOR_SCOPE_CYCLE_COUNTER(STAT_LevelSelector_FilterIndex);
+	const auto PassesTags = [this, &TagQuery](const TSharedPtr<FLevelSelectorItem>& Item)
+	{
+		return TagIndex.Matches(Item->SearchId, TagQuery);
+	};
+
+	CompactSortedItems();
+	if (FoldedQuery.IsEmpty())
+	{
+		if (TagQuery.IsEmpty())
+		{
+			OutItems.Append(SortedItems);
+			return;
+		}
+		for (const TSharedPtr<FLevelSelectorItem>& Item : SortedItems)
+		{
+			if (PassesTags(Item))
+			{
+				OutItems.Add(Item);
+			}
+		}
+		return;
+	}
+
+	TArray<TSharedPtr<FLevelSelectorItem>> Matches;
+	FindMatches(FoldedQuery, Matches);
+
+	// Few matches are sorted on their own, many matches are picked from the already sorted index.
+	if (Matches.Num() * 8 < SortedItems.Num())
+	{
+		Matches.RemoveAllSwap([&PassesTags](const TSharedPtr<FLevelSelectorItem>& Item) { return !PassesTags(Item); });
+		Algo::Sort(Matches, &FLevelSelectorIndex::CompareItems);
+		OutItems.Append(Matches);
+		return;
+	}
+
+	TBitArray<> MatchingIds(false, SearchIndex.GetMaxId());
+	for (const TSharedPtr<FLevelSelectorItem>& Item : Matches)
+	{
+		MatchingIds[Item->SearchId] = true;
+	}
+	for (const TSharedPtr<FLevelSelectorItem>& Item : SortedItems)
+	{
+		if (MatchingIds.IsValidIndex(Item->SearchId) && MatchingIds[Item->SearchId] && PassesTags(Item))
+		{
+			OutItems.Add(Item);
+		}
+	}
+}
+
+bool FLevelSelectorIndex::MatchesSearch(const FLevelSelectorItem& Item, FStringView FoldedQuery) const
+{
+	return FoldedQuery.IsEmpty() || SearchIndex.Matches(Item.SearchId, FoldedQuery);
+}
+
+bool FLevelSelectorIndex::CompareItems(const TSharedPtr<FLevelSelectorItem>& A, const TSharedPtr<FLevelSelectorItem>& B)
+{
+	if (A->bIsFavorite != B->bIsFavorite)
+	{
+		return A->bIsFavorite;
+	}
+	return A->PackagePath < B->PackagePath;
+}
+
+void FLevelSelectorIndex::OnSettingsChanged(UObject* Settings, FPropertyChangedEvent& PropertyChangedEvent)
+{
+	const FName PropertyName = PropertyChangedEvent.GetMemberPropertyName();
+	if (PropertyName == GET_MEMBER_NAME_CHECKED(UBDC_LevelSelectorSettings, FavoriteLevels)
+		|| PropertyName == GET_MEMBER_NAME_CHECKED(UBDC_LevelSelectorSettings, LevelTagContainers))
+	{
+		RefreshAllItems();
+	}
+	else if (PropertyName == GET_MEMBER_NAME_CHECKED(UBDC_LevelSelectorSettings, IncludedContentRoots)
+		|| PropertyName == GET_MEMBER_NAME_CHECKED(UBDC_LevelSelectorSettings, ExcludedContentRoots))
+	{
+		CompileContentRootFilter();
+		Rescan();
+	}
+}
+
+void FLevelSelectorIndex::OnCameraFavoritesChanged(const FSoftObjectPath& LevelPath)
+{
+	// The flag does not take part in sorting, rows read it on their next paint without a delta.
+	const UBDC_LevelSelectorSettings* Settings = GetDefault<UBDC_LevelSelectorSettings>();
+	if (!LevelPath.IsValid())
+	{
+		// Several levels may have changed, e.g. after a move or a config reload.
+		for (const TPair<FName, TSharedPtr<FLevelSelectorItem>>& Pair : ItemsByPackage)
+		{
+			Pair.Value->bHasCameraFavorites = Settings->HasCameraFavorites(Pair.Key);
+		}
+	}
+	else if (const TSharedPtr<FLevelSelectorItem>* Item = ItemsByPackage.Find(LevelPath.GetLongPackageFName()))
+	{
+		(*Item)->bHasCameraFavorites = Settings->HasCameraFavorites((*Item)->PackageName);
+	}
+}
+
+void FLevelSelectorIndex::CompileContentRootFilter()
+{
+	const UBDC_LevelSelectorSettings* Settings = GetDefault<UBDC_LevelSelectorSettings>();
+	ContentRootFilter.Compile(Settings->IncludedContentRoots, Settings->ExcludedContentRoots);
+}
+
+void FLevelSelectorIndex::RefreshAllItems()
+{
+	// Tags may have been removed from every level, rebuilding drops the bits nobody uses anymore.
+	const UBDC_LevelSelectorSettings* Settings = GetDefault<UBDC_LevelSelectorSettings>();
+	TagIndex.Reset();
+	CompactSortedItems();
+	for (const TSharedPtr<FLevelSelectorItem>& Item : SortedItems)
+	{
+		Item->RefreshCachedState(Settings);
+		TagIndex.SetTags(Item->SearchId, Item->Tags);
+	}
+	{
+		LEVELSELECTOR_SCOPE_CYCLE_COUNTER(STAT_LevelSelector_SortLevelList);
+		Algo::Sort(SortedItems, &FLevelSelectorIndex::CompareItems);
+		RebuildSortedPositions();
+	}
+
+	PendingDelta.bFullRefresh = true;
+	FlushPendingChanges();
+}
+
+bool FLevelSelectorIndex::ShouldIndex(const FAssetData& AssetData) const
+{
+	if (AssetData.AssetClassPath != UWorld::StaticClass()->GetClassPathName())
+	{
+		return false;
+	}
+
+	const FNameBuilder PackageName(AssetData.PackageName);
+	if (ContentRootFilter.Matches(PackageName.ToView()))
+	{
+		return true;
+	}
+
+	// Favorites outside of the content roots stay listed, as they always have been.
+	const UBDC_LevelSelectorSettings* Settings = GetDefault<UBDC_LevelSelectorSettings>();
+	return Settings && Settings->IsFavorite(AssetData.PackageName);
+}
+
+TSharedPtr<FLevelSelectorItem> FLevelSelectorIndex::CreateItem(const FAssetData& AssetData)
+{
+	TSharedPtr<FLevelSelectorItem> NewItem = FLevelSelectorItem::Create(AssetData);
+	ItemsByPackage.Add(AssetData.PackageName, NewItem);
+
+	NewItem->SearchId = SearchIndex.Add({ FStringView(NewItem->DisplayName), FStringView(NewItem->PackagePath) });
+	if (NewItem->SearchId >= ItemsBySearchId.Num())
+	{
+		ItemsBySearchId.SetNum(NewItem->SearchId + 1);
+	}
+	ItemsBySearchId[NewItem->SearchId] = NewItem;
+	TagIndex.SetTags(NewItem->SearchId, NewItem->Tags);
+	return NewItem;
+}
+
+void FLevelSelectorIndex::RefreshItem(const TSharedPtr<FLevelSelectorItem>& Item)
+{
+	Item->RefreshCachedState(GetDefault<UBDC_LevelSelectorSettings>());
+	TagIndex.SetTags(Item->SearchId, Item->Tags);
+}
+
+void FLevelSelectorIndex::AddItem(const FAssetData& AssetData)
+{
+	if (ItemsByPackage.Contains(AssetData.PackageName))
+	{
+		return;
+	}
+
+	TSharedPtr<FLevelSelectorItem> NewItem = CreateItem(AssetData);
+	InsertSorted(NewItem);
+	PendingDelta.Added.Add(NewItem);
+	SET_DWORD_STAT(STAT_LevelSelector_ItemsIndexed, ItemsByPackage.Num());
+}
+
+void FLevelSelectorIndex::RemoveItem(FName PackageName)
+{
+	TSharedPtr<FLevelSelectorItem> Item;
+	if (!ItemsByPackage.RemoveAndCopyValue(PackageName, Item))
+	{
+		return;
+	}
+	SET_DWORD_STAT(STAT_LevelSelector_ItemsIndexed, ItemsByPackage.Num());
+
+	RemoveSorted(Item);
+	SearchIndex.Remove(Item->SearchId);
+	TagIndex.Remove(Item->SearchId);
+	ItemsBySearchId[Item->SearchId].Reset();
+	Item->SearchId = INDEX_NONE;
+
+	// An item added and removed within the same tick was never seen by any listener.
+	if (PendingDelta.Added.Remove(Item) == 0)
+	{
+		PendingDelta.Updated.Remove(Item);
+		PendingDelta.Removed.Add(Item);
+	}
+}
+
+void FLevelSelectorIndex::InsertSorted(const TSharedPtr<FLevelSelectorItem>& Item)
+{
+	PendingSortedInserts.Add(Item);
+}
+
+void FLevelSelectorIndex::RemoveSorted(const TSharedPtr<FLevelSelectorItem>& Item)
+{
+	int32 Index = INDEX_NONE;
+	if (SortedPositions.RemoveAndCopyValue(Item.Get(), Index))
+	{
+		SortedItems[Index].Reset();
+		++NumSortedHoles;
+	}
+	else
+	{
+		// Only items changed since the last read are queued, e.g. an item re-sorted twice within one tick.
+		PendingSortedInserts.RemoveSingleSwap(Item);
+	}
+}
+
+void FLevelSelectorIndex::CompactSortedItems() const
+{
+	if (NumSortedHoles == 0 && PendingSortedInserts.IsEmpty())
+	{
+		return;
+	}
+	LEVELSELECTOR_SCOPE_CYCLE_COUNTER(STAT_LevelSelector_SortLevelList);
+
+	if (NumSortedHoles > 0)
+	{
+		SortedItems.RemoveAll([](const TSharedPtr<FLevelSelectorItem>& Item) { return !Item.IsValid(); });
+		NumSortedHoles = 0;
+	}
+	Algo::Sort(PendingSortedInserts, &FLevelSelectorIndex::CompareItems);
+	MergeSorted(SortedItems, PendingSortedInserts, &FLevelSelectorIndex::CompareItems);
+	RebuildSortedPositions();
+}
+
+void FLevelSelectorIndex::RebuildSortedPositions() const
+{
+	SortedPositions.Reset();
+	SortedPositions.Reserve(SortedItems.Num());
+	for (int32 Index = 0; Index < SortedItems.Num(); ++Index)
+	{
+		SortedPositions.Add(SortedItems[Index].Get(), Index);
+	}
+}
+#pragma endregion
+
+#pragma region Index Cache
+bool FLevelSelectorIndex::LoadFromCache()
+{
+	const double LoadStart = FPlatformTime::Seconds();
+	TArray<FLevelSelectorIndexCache::FEntry> Entries;
+	if (!FLevelSelectorIndexCache::Load(Entries))
+	{
+		return false;
+	}
+
+	const FTopLevelAssetPath WorldClassPath = UWorld::StaticClass()->GetClassPathName();
+	TArray<TSharedPtr<FLevelSelectorItem>> NewItems;
+	NewItems.Reserve(Entries.Num());
+	for (const FLevelSelectorIndexCache::FEntry& Entry : Entries)
+	{
+		const FAssetData AssetData(Entry.PackageName, FName(*FPackageName::GetLongPackagePath(Entry.PackageName.ToString())), Entry.AssetName, WorldClassPath);
+		if (ItemsByPackage.Contains(Entry.PackageName) || !ShouldIndex(AssetData))
+		{
+			continue;
+		}
+		NewItems.Add(CreateItem(AssetData));
+	}
+
+	// The cache is written in index order, it only needs sorting if favorites changed since.
+	if (SortedItems.IsEmpty() && PendingSortedInserts.IsEmpty() && Algo::IsSorted(NewItems, &FLevelSelectorIndex::CompareItems))
+	{
+		SortedItems = NewItems;
+		RebuildSortedPositions();
+	}
+	else
+	{
+		PendingSortedInserts.Append(NewItems);
+	}
+	PendingDelta.Added.Append(NewItems);
+	SET_DWORD_STAT(STAT_LevelSelector_ItemsIndexed, ItemsByPackage.Num());
+	FlushPendingChanges();
+
+	UE_LOG(LogBDCLevelSelector, Log, TEXT("Loaded %d levels from the index cache in %.2f ms"), NewItems.Num(), (FPlatformTime::Seconds() - LoadStart) * 1000.0);
+	return true;
+}
+
+void FLevelSelectorIndex::SaveCache(bool bWait)
+{
+	TArray<uint8> CacheData = FLevelSelectorIndexCache::Serialize(GetSortedItems());
+	CacheWriteTask = UE::Tasks::Launch(UE_SOURCE_LOCATION,
+		[CacheData = MoveTemp(CacheData)]()
+		{
+			FLevelSelectorIndexCache::Save(CacheData);
+		},
+		UE::Tasks::Prerequisites(CacheWriteTask));
+
+	if (bWait)
+	{
+		CacheWriteTask.Wait();
+	}
+}
+#pragma endregion
+
+#pragma region Change Broadcast
+void FLevelSelectorIndex::ScheduleFlush()
+{
+	if (!FlushTickerHandle.IsValid())
+	{
+		FlushTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FLevelSelectorIndex::OnFlushTick));
+	}
+}
+
+bool FLevelSelectorIndex::OnFlushTick(float DeltaTime)
+{
+	FlushTickerHandle.Reset();
+	FlushPendingChanges();
+	return false;
+}
+
+void FLevelSelectorIndex::FlushPendingChanges()
+{
+	if (PendingDelta.IsEmpty())
+	{
+		return;
+	}
+
+	const FLevelSelectorIndexDelta Delta = MoveTemp(PendingDelta);
+	PendingDelta.Reset();
+	OnChangedDelegate.Broadcast(Delta);
+}
+#pragma endregion
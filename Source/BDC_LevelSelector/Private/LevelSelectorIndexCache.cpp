@@ -0,0 +1,238 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "LevelSelectorIndexCache.h"
+#include "BDC_LevelSelector.h"
+#include "LevelSelectorIndex.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+namespace LevelSelectorIndexCache
+{
+	static constexpr uint32 Magic = 0x4C534943; // "LSIC"
+	/** Bump whenever the layout of FHeader, FRecord or the string blob changes. */
+	static constexpr uint32 Version = 2;
+
+	enum ERecordFlags : uint16
+	{
+		Favorite = 1 << 0,
+	};
+
+	struct FHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		uint32 NumRecords;
+		uint32 StringBytes;
+	};
+
+	/** Offsets are relative to the start of the string blob, lengths are in UTF-8 code units. */
+	struct FRecord
+	{
+		uint32 PackageNameOffset;
+		uint32 AssetNameOffset;
+		uint32 TagOffset;
+		uint16 PackageNameLength;
+		uint16 AssetNameLength;
+		uint16 TagLength;
+		uint16 Flags;
+	};
+
+	static_assert(sizeof(FHeader) == 16, "The cache header is written as is and must not change silently.");
+	static_assert(sizeof(FRecord) == 20, "Cache records are written as is and must not change silently.");
+
+	static bool AppendString(TArray<uint8>& Blob, const FString& Text, uint32& OutOffset, uint16& OutLength)
+	{
+		const FTCHARToUTF8 Converted(*Text);
+		if (Converted.Length() > MAX_uint16)
+		{
+			return false;
+		}
+		OutOffset = Blob.Num();
+		OutLength = static_cast<uint16>(Converted.Length());
+		Blob.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+		return true;
+	}
+
+	static FName ReadName(const uint8* Blob, uint32 Offset, uint16 Length)
+	{
+		if (Length == 0)
+		{
+			return NAME_None;
+		}
+		const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Blob + Offset), Length);
+		return FName(Converted.Length(), Converted.Get());
+	}
+
+	static FString ReadString(const uint8* Blob, uint32 Offset, uint16 Length)
+	{
+		const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Blob + Offset), Length);
+		return FString(Converted.Length(), Converted.Get());
+	}
+
+	static FString JoinTags(const FGameplayTagContainer& Tags)
+	{
+		FString Joined;
+		for (const FGameplayTag& Tag : Tags)
+		{
+			if (!Joined.IsEmpty())
+			{
+				Joined += TEXT(',');
+			}
+			Joined += Tag.ToString();
+		}
+		return Joined;
+	}
+}
+
+FString FLevelSelectorIndexCache::GetCacheFilename()
+{
+	return FPaths::ProjectSavedDir() / TEXT("LevelSelector") / TEXT("LevelIndex.bin");
+}
+
+bool FLevelSelectorIndexCache::Load(TArray<FEntry>& OutEntries)
+{
+	const FString Filename = GetCacheFilename();
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!PlatformFile.FileExists(*Filename))
+	{
+		return false;
+	}
+
+	TUniquePtr<IMappedFileHandle> MappedFile;
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3)
+	FOpenMappedResult MappedResult = PlatformFile.OpenMappedEx(*Filename);
+	if (MappedResult.HasValue())
+	{
+		MappedFile = MappedResult.StealValue();
+	}
+#else
+	MappedFile.Reset(PlatformFile.OpenMapped(*Filename));
+#endif
+
+	if (MappedFile.IsValid())
+	{
+		const TUniquePtr<IMappedFileRegion> Region(MappedFile->MapRegion(0, MappedFile->GetFileSize()));
+		if (Region.IsValid())
+		{
+			return Parse(Region->GetMappedPtr(), Region->GetMappedSize(), OutEntries);
+		}
+	}
+
+	// Platforms without memory mapping read the file instead, the cache is small either way.
+	TArray<uint8> FileData;
+	return FFileHelper::LoadFileToArray(FileData, *Filename) && Parse(FileData.GetData(), FileData.Num(), OutEntries);
+}
+
+bool FLevelSelectorIndexCache::Parse(const uint8* Data, int64 Size, TArray<FEntry>& OutEntries)
+{
+	using namespace LevelSelectorIndexCache;
+
+	if (!Data || Size < static_cast<int64>(sizeof(FHeader)))
+	{
+		return false;
+	}
+
+	FHeader Header;
+	FMemory::Memcpy(&Header, Data, sizeof(FHeader));
+	if (Header.Magic != Magic || Header.Version != Version)
+	{
+		UE_LOG(LogBDCLevelSelector, Log, TEXT("Ignoring level index cache with version %u, expected %u."), Header.Version, Version);
+		return false;
+	}
+
+	const int64 RecordsSize = static_cast<int64>(Header.NumRecords) * sizeof(FRecord);
+	if (Size != static_cast<int64>(sizeof(FHeader)) + RecordsSize + Header.StringBytes)
+	{
+		UE_LOG(LogBDCLevelSelector, Warning, TEXT("Ignoring truncated level index cache %s."), *GetCacheFilename());
+		return false;
+	}
+
+	const uint8* RecordData = Data + sizeof(FHeader);
+	const uint8* Blob = RecordData + RecordsSize;
+	const auto IsInBlob = [&Header](uint32 Offset, uint16 Length)
+	{
+		return static_cast<uint64>(Offset) + Length <= Header.StringBytes;
+	};
+
+	OutEntries.Reset(Header.NumRecords);
+	for (uint32 Index = 0; Index < Header.NumRecords; ++Index)
+	{
+		FRecord Record;
+		FMemory::Memcpy(&Record, RecordData + Index * sizeof(FRecord), sizeof(FRecord));
+		if (!IsInBlob(Record.PackageNameOffset, Record.PackageNameLength)
+			|| !IsInBlob(Record.AssetNameOffset, Record.AssetNameLength)
+			|| !IsInBlob(Record.TagOffset, Record.TagLength))
+		{
+			UE_LOG(LogBDCLevelSelector, Warning, TEXT("Ignoring corrupt level index cache %s."), *GetCacheFilename());
+			OutEntries.Reset();
+			return false;
+		}
+
+		FEntry& Entry = OutEntries.AddDefaulted_GetRef();
+		Entry.PackageName = ReadName(Blob, Record.PackageNameOffset, Record.PackageNameLength);
+		Entry.AssetName = ReadName(Blob, Record.AssetNameOffset, Record.AssetNameLength);
+		Entry.Tags = ReadString(Blob, Record.TagOffset, Record.TagLength);
+		Entry.bIsFavorite = (Record.Flags & Favorite) != 0;
+	}
+	return true;
+}
+
+TArray<uint8> FLevelSelectorIndexCache::Serialize(TConstArrayView<TSharedPtr<FLevelSelectorItem>> SortedItems)
+{
+	using namespace LevelSelectorIndexCache;
+
+	TArray<FRecord> Records;
+	Records.Reserve(SortedItems.Num());
+	TArray<uint8> Blob;
+
+	for (const TSharedPtr<FLevelSelectorItem>& Item : SortedItems)
+	{
+		FRecord Record = {};
+		Record.Flags = Item->bIsFavorite ? Favorite : 0;
+		if (AppendString(Blob, Item->PackageName.ToString(), Record.PackageNameOffset, Record.PackageNameLength)
+			&& AppendString(Blob, Item->AssetData.AssetName.ToString(), Record.AssetNameOffset, Record.AssetNameLength)
+			&& AppendString(Blob, JoinTags(Item->Tags), Record.TagOffset, Record.TagLength))
+		{
+			Records.Add(Record);
+		}
+	}
+
+	const FHeader Header = { Magic, Version, static_cast<uint32>(Records.Num()), static_cast<uint32>(Blob.Num()) };
+
+	TArray<uint8> Data;
+	Data.Reserve(sizeof(FHeader) + Records.Num() * sizeof(FRecord) + Blob.Num());
+	Data.Append(reinterpret_cast<const uint8*>(&Header), sizeof(FHeader));
+	Data.Append(reinterpret_cast<const uint8*>(Records.GetData()), Records.Num() * sizeof(FRecord));
+	Data.Append(Blob);
+	return Data;
+}
+
+bool FLevelSelectorIndexCache::Save(const TArray<uint8>& Data)
+{
+	const FString Filename = GetCacheFilename();
+	const FString TempFilename = Filename + TEXT(".tmp");
+
+	// Written next to the cache and moved over it, so a crash mid-write never leaves a half written cache behind.
+	if (!FFileHelper::SaveArrayToFile(Data, *TempFilename))
+	{
+		UE_LOG(LogBDCLevelSelector, Warning, TEXT("Failed to write level index cache %s."), *TempFilename);
+		return false;
+	}
+	if (!IFileManager::Get().Move(*Filename, *TempFilename, true, true))
+	{
+		UE_LOG(LogBDCLevelSelector, Warning, TEXT("Failed to replace level index cache %s."), *Filename);
+		IFileManager::Get().Delete(*TempFilename);
+		return false;
+	}
+	return true;
+}
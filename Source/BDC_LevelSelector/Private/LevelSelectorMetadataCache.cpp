@@ -0,0 +1,304 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "LevelSelectorMetadataCache.h"
+#include "LevelSelectorStats.h"
+#include "Engine/Level.h"
+#include "HAL/FileManager.h"
+#include "Misc/PackageName.h"
+#include "Misc/PackagePath.h"
+#include "Misc/PathViews.h"
+#include "String/Find.h"
+#include "UObject/Package.h"
+
+namespace LevelSelectorMetadataCache
+{
+	/** Levels stat'ed by one worker task. */
+	static constexpr int32 BatchSize = 128;
+	/** Batches running at once, the rest waits in the request queue. */
+	static constexpr int32 MaxBatchesInFlight = 2;
+}
+
+#pragma region Lifecycle
+void FLevelSelectorMetadataCache::Initialize()
+{
+	if (bInitialized)
+	{
+		return;
+	}
+	bInitialized = true;
+
+	UPackage::PackageSavedWithContextEvent.AddSP(this, &FLevelSelectorMetadataCache::OnPackageSaved);
+}
+
+void FLevelSelectorMetadataCache::Shutdown()
+{
+	if (!bInitialized)
+	{
+		return;
+	}
+	bInitialized = false;
+
+	UPackage::PackageSavedWithContextEvent.RemoveAll(this);
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	UE::Tasks::Wait(BatchTasks);
+	BatchTasks.Reset();
+	PendingRequests.Reset();
+	QueuedPackages.Reset();
+	ChangedWhileQueued.Reset();
+}
+
+void FLevelSelectorMetadataCache::EnsureTicker()
+{
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FLevelSelectorMetadataCache::OnTick), 0.1f);
+	}
+}
+#pragma endregion
+
+#pragma region Requests
+void FLevelSelectorMetadataCache::Request(FName PackageName)
+{
+	if (!bInitialized || PackageName.IsNone())
+	{
+		return;
+	}
+
+	const FCacheEntry* Entry = Cache.Find(PackageName);
+	if (Entry && Entry->bValidated)
+	{
+		return;
+	}
+
+	bool bAlreadyQueued = false;
+	QueuedPackages.Add(PackageName, &bAlreadyQueued);
+	if (!bAlreadyQueued)
+	{
+		PendingRequests.Add(PackageName);
+		EnsureTicker();
+	}
+}
+
+const FLevelPackageMetadata* FLevelSelectorMetadataCache::Find(FName PackageName) const
+{
+	const FCacheEntry* Entry = Cache.Find(PackageName);
+	return Entry ? &Entry->Metadata : nullptr;
+}
+
+void FLevelSelectorMetadataCache::OnPackageSaved(const FString& PackageFilename, UPackage* Package, FObjectPostSaveContext ObjectSaveContext)
+{
+	if (!Package)
+	{
+		return;
+	}
+
+	if (Cache.Contains(Package->GetFName()) || QueuedPackages.Contains(Package->GetFName()))
+	{
+		Invalidate(Package->GetFName(), false);
+		return;
+	}
+
+	// Actor packages of world partition levels live a few folders below the level's external actors path,
+	// so the folders above the package are looked up from the deepest one up.
+	const FString PackageName = Package->GetName();
+	if (LevelsByExternalActorsPath.IsEmpty() || UE::String::FindFirst(PackageName, FPackagePath::GetExternalActorsFolderName(), ESearchCase::IgnoreCase) == INDEX_NONE)
+	{
+		return;
+	}
+	FStringView Folder = PackageName;
+	int32 SlashIndex = INDEX_NONE;
+	while (Folder.FindLastChar(TEXT('/'), SlashIndex) && SlashIndex > 0)
+	{
+		Folder.LeftInline(SlashIndex);
+		const FName FolderName(Folder, FNAME_Find);
+		if (const FName* LevelName = FolderName.IsNone() ? nullptr : LevelsByExternalActorsPath.Find(FolderName))
+		{
+			Invalidate(*LevelName, true);
+			return;
+		}
+	}
+}
+
+void FLevelSelectorMetadataCache::Invalidate(FName PackageName, bool bExternalActorsChanged)
+{
+	if (FCacheEntry* Entry = Cache.Find(PackageName))
+	{
+		Entry->bValidated = false;
+		Entry->bExternalActorsChanged |= bExternalActorsChanged;
+	}
+
+	// A batch may be stat'ing the level right now. Levels still waiting for dispatch lose the mark again in DispatchBatch.
+	if (QueuedPackages.Contains(PackageName))
+	{
+		ChangedWhileQueued.Add(PackageName);
+	}
+	Request(PackageName);
+}
+#pragma endregion
+
+#pragma region Collection
+bool FLevelSelectorMetadataCache::OnTick(float DeltaTime)
+{
+	bool bApplied = false;
+	for (int32 TaskIndex = BatchTasks.Num() - 1; TaskIndex >= 0; --TaskIndex)
+	{
+		if (BatchTasks[TaskIndex].IsCompleted())
+		{
+			ApplyBatch(BatchTasks[TaskIndex].GetResult());
+			BatchTasks.RemoveAtSwap(TaskIndex);
+			bApplied = true;
+		}
+	}
+
+	while (BatchTasks.Num() < LevelSelectorMetadataCache::MaxBatchesInFlight && !PendingRequests.IsEmpty())
+	{
+		DispatchBatch();
+	}
+
+	if (bApplied)
+	{
+		++Revision;
+		UpdatedDelegate.Broadcast();
+	}
+
+	// Nothing left to do, Request adds the ticker again.
+	if (BatchTasks.IsEmpty() && PendingRequests.IsEmpty())
+	{
+		TickerHandle.Reset();
+		return false;
+	}
+	return true;
+}
+
+void FLevelSelectorMetadataCache::DispatchBatch()
+{
+	const int32 NumEntries = FMath::Min(PendingRequests.Num(), LevelSelectorMetadataCache::BatchSize);
+	TArray<FBatchEntry> Batch;
+	Batch.Reserve(NumEntries);
+
+	// Mount points are resolved here, the worker only touches the file system.
+	for (int32 RequestIndex = 0; RequestIndex < NumEntries; ++RequestIndex)
+	{
+		const FName PackageName = PendingRequests[RequestIndex];
+		const FString PackageNameString = PackageName.ToString();
+
+		// The batch reads the current cache state, only saves from here on are missed by it.
+		ChangedWhileQueued.Remove(PackageName);
+
+		FBatchEntry& Entry = Batch.AddDefaulted_GetRef();
+		Entry.PackageName = PackageName;
+		if (!FPackageName::TryConvertLongPackageNameToFilename(PackageNameString, Entry.MapFilename, FPackageName::GetMapPackageExtension()))
+		{
+			Batch.Pop();
+			QueuedPackages.Remove(PackageName);
+			continue;
+		}
+		const FString ExternalActorsPath = ULevel::GetExternalActorsPath(PackageNameString);
+		FPackageName::TryConvertLongPackageNameToFilename(ExternalActorsPath, Entry.ExternalActorsDirectory);
+
+		// Registered before the first result arrives, so actor saves during the first collection are noticed.
+		LevelsByExternalActorsPath.Add(FName(*ExternalActorsPath), PackageName);
+
+		if (const FCacheEntry* Cached = Cache.Find(PackageName))
+		{
+			Entry.CachedMapTimestamp = Cached->Metadata.LastModified;
+			Entry.bExternalActorsChanged = Cached->bExternalActorsChanged;
+			Entry.Metadata = Cached->Metadata;
+		}
+	}
+	PendingRequests.RemoveAt(0, NumEntries);
+
+	if (!Batch.IsEmpty())
+	{
+		BatchTasks.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION,
+			[Batch = MoveTemp(Batch)]() mutable
+			{
+				CollectBatch(Batch);
+				return MoveTemp(Batch);
+			},
+			UE::Tasks::ETaskPriority::BackgroundNormal));
+	}
+}
+
+void FLevelSelectorMetadataCache::CollectBatch(TArray<FBatchEntry>& Batch)
+{
+	LEVELSELECTOR_SCOPE_CYCLE_COUNTER(STAT_LevelSelector_CollectMetadata);
+
+	IFileManager& FileManager = IFileManager::Get();
+	for (FBatchEntry& Entry : Batch)
+	{
+		const FFileStatData MapStat = FileManager.GetStatData(*Entry.MapFilename);
+		if (!MapStat.bIsValid)
+		{
+			continue;
+		}
+		Entry.bFound = true;
+
+		if (MapStat.ModificationTime == Entry.CachedMapTimestamp && !Entry.bExternalActorsChanged)
+		{
+			Entry.bUnchanged = true;
+			continue;
+		}
+
+		Entry.Metadata = FLevelPackageMetadata();
+		Entry.Metadata.MapFileSize = MapStat.FileSize;
+		Entry.Metadata.LastModified = MapStat.ModificationTime;
+		if (!Entry.ExternalActorsDirectory.IsEmpty() && FileManager.DirectoryExists(*Entry.ExternalActorsDirectory))
+		{
+			FileManager.IterateDirectoryStatRecursively(*Entry.ExternalActorsDirectory, [&Entry](const TCHAR* Filename, const FFileStatData& Stat)
+			{
+				if (!Stat.bIsDirectory && FPathViews::GetExtension(Filename) == TEXT("uasset"))
+				{
+					++Entry.Metadata.ExternalActorCount;
+					Entry.Metadata.ExternalActorBytes += Stat.FileSize;
+				}
+				return true;
+			});
+		}
+	}
+}
+
+void FLevelSelectorMetadataCache::ApplyBatch(TArray<FBatchEntry>& Batch)
+{
+	for (FBatchEntry& Entry : Batch)
+	{
+		QueuedPackages.Remove(Entry.PackageName);
+		const bool bChangedMeanwhile = ChangedWhileQueued.Remove(Entry.PackageName) > 0;
+		if (!Entry.bFound)
+		{
+			Cache.Remove(Entry.PackageName);
+			LevelsByExternalActorsPath.Remove(FName(*ULevel::GetExternalActorsPath(Entry.PackageName.ToString())));
+			if (bChangedMeanwhile)
+			{
+				Request(Entry.PackageName);
+			}
+			continue;
+		}
+
+		FCacheEntry& Cached = Cache.FindOrAdd(Entry.PackageName);
+		if (!Entry.bUnchanged)
+		{
+			Cached.Metadata = Entry.Metadata;
+		}
+
+		// The result is shown until the next one arrives, but it predates a save and is collected again, actor folder included.
+		Cached.bValidated = !bChangedMeanwhile;
+		Cached.bExternalActorsChanged = bChangedMeanwhile;
+		if (bChangedMeanwhile)
+		{
+			Request(Entry.PackageName);
+		}
+	}
+}
+#pragma endregion
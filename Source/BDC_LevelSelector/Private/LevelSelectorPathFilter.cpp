@@ -0,0 +1,145 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "LevelSelectorPathFilter.h"
+
+FLevelSelectorPathFilter::FLevelSelectorPathFilter()
+{
+	Nodes.AddDefaulted();
+}
+
+void FLevelSelectorPathFilter::Compile(TConstArrayView<FString> IncludePatterns, TConstArrayView<FString> ExcludePatterns)
+{
+	Nodes.Reset();
+	Nodes.AddDefaulted();
+
+	for (const FString& Pattern : IncludePatterns)
+	{
+		AddRule(Pattern, ERule::Include);
+	}
+	for (const FString& Pattern : ExcludePatterns)
+	{
+		AddRule(Pattern, ERule::Exclude);
+	}
+}
+
+void FLevelSelectorPathFilter::AddRule(FStringView Pattern, ERule Rule)
+{
+	Pattern.TrimStartAndEndInline();
+	if (Pattern.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<int32, TInlineAllocator<8>> Path;
+	Path.Add(0);
+	int32 NodeIndex = 0;
+	while (!Pattern.IsEmpty())
+	{
+		int32 SlashIndex = INDEX_NONE;
+		Pattern.FindChar(TEXT('/'), SlashIndex);
+		const FStringView Segment = SlashIndex == INDEX_NONE ? Pattern : Pattern.Left(SlashIndex);
+		Pattern.RightChopInline(SlashIndex == INDEX_NONE ? Pattern.Len() : SlashIndex + 1);
+		if (Segment.IsEmpty())
+		{
+			continue;
+		}
+
+		int32 ChildIndex = FindChild(NodeIndex, Segment);
+		if (ChildIndex == INDEX_NONE)
+		{
+			ChildIndex = Nodes.AddDefaulted();
+			Nodes[ChildIndex].Segment = FString(Segment);
+			Nodes[NodeIndex].Children.Add(ChildIndex);
+		}
+		NodeIndex = ChildIndex;
+		Path.Add(NodeIndex);
+	}
+
+	FNode& Node = Nodes[NodeIndex];
+	if (Node.Rule != ERule::Exclude)
+	{
+		Node.Rule = Rule;
+	}
+	if (Rule == ERule::Include)
+	{
+		for (const int32 PathIndex : Path)
+		{
+			Nodes[PathIndex].bHasIncludeBelow = true;
+		}
+	}
+}
+
+int32 FLevelSelectorPathFilter::FindChild(int32 NodeIndex, FStringView Segment) const
+{
+	for (const int32 ChildIndex : Nodes[NodeIndex].Children)
+	{
+		if (Segment.Equals(Nodes[ChildIndex].Segment, ESearchCase::IgnoreCase))
+		{
+			return ChildIndex;
+		}
+	}
+	return INDEX_NONE;
+}
+
+template <typename VisitorType>
+bool FLevelSelectorPathFilter::Walk(FStringView Path, VisitorType&& Visitor) const
+{
+	int32 NodeIndex = 0;
+	Visitor(Nodes[0]);
+	while (!Path.IsEmpty())
+	{
+		int32 SlashIndex = INDEX_NONE;
+		Path.FindChar(TEXT('/'), SlashIndex);
+		const FStringView Segment = SlashIndex == INDEX_NONE ? Path : Path.Left(SlashIndex);
+		Path.RightChopInline(SlashIndex == INDEX_NONE ? Path.Len() : SlashIndex + 1);
+		if (Segment.IsEmpty())
+		{
+			continue;
+		}
+
+		const int32 ChildIndex = FindChild(NodeIndex, Segment);
+		if (ChildIndex == INDEX_NONE)
+		{
+			return false;
+		}
+		NodeIndex = ChildIndex;
+		Visitor(Nodes[NodeIndex]);
+	}
+	return true;
+}
+
+bool FLevelSelectorPathFilter::Matches(FStringView PackageName) const
+{
+	ERule Decision = ERule::None;
+	Walk(PackageName, [&Decision](const FNode& Node)
+	{
+		if (Node.Rule != ERule::None)
+		{
+			Decision = Node.Rule;
+		}
+	});
+	return Decision == ERule::Include;
+}
+
+bool FLevelSelectorPathFilter::CouldMatchBelow(FStringView RootPath) const
+{
+	ERule Decision = ERule::None;
+	const FNode* Deepest = nullptr;
+	const bool bReachedRoot = Walk(RootPath, [&Decision, &Deepest](const FNode& Node)
+	{
+		if (Node.Rule != ERule::None)
+		{
+			Decision = Node.Rule;
+		}
+		Deepest = &Node;
+	});
+
+	// If the trie ends above the root, the last rule on the way covers all of it.
+	return Decision == ERule::Include || (bReachedRoot && Deepest->bHasIncludeBelow);
+}
@@ -0,0 +1,286 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "LevelSelectorPathTrie.h"
+#include "LevelSelectorIndex.h"
+#include "LevelSelectorSearchIndex.h"
+#include "Algo/BinarySearch.h"
+#include "Misc/PackageName.h"
+#include "String/Find.h"
+
+namespace LevelSelectorPathTrie
+{
+	static bool CompareFolders(const TSharedPtr<FLevelSelectorTreeNode>& A, const TSharedPtr<FLevelSelectorTreeNode>& B)
+	{
+		return A->FoldedName < B->FoldedName;
+	}
+
+	static bool CompareLevels(const TSharedPtr<FLevelSelectorTreeNode>& A, const TSharedPtr<FLevelSelectorTreeNode>& B)
+	{
+		return FLevelSelectorIndex::CompareItems(A->Level, B->Level);
+	}
+}
+
+#pragma region Tree Filter
+void FLevelSelectorTreeFilter::Reset()
+{
+	bActive = false;
+	MatchedFolders.Reset();
+	VisibleFolders.Reset();
+	VisibleLevels.Reset();
+}
+
+bool FLevelSelectorTreeFilter::IsInMatchedFolder(const FLevelSelectorTreeNode& Node) const
+{
+	for (const FLevelSelectorTreeNode* Folder = Node.IsFolder() ? &Node : Node.Parent; Folder; Folder = Folder->Parent)
+	{
+		if (MatchedFolders.Contains(Folder))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void FLevelSelectorTreeFilter::GetVisibleChildren(const FLevelSelectorTreeNode& Folder, TArray<TSharedPtr<FLevelSelectorTreeNode>>& OutChildren) const
+{
+	if (!bActive || IsInMatchedFolder(Folder))
+	{
+		OutChildren.Append(Folder.Folders);
+		OutChildren.Append(Folder.Levels);
+		return;
+	}
+
+	for (const TSharedPtr<FLevelSelectorTreeNode>& Child : Folder.Folders)
+	{
+		if (VisibleFolders.Contains(Child.Get()) || MatchedFolders.Contains(Child.Get()))
+		{
+			OutChildren.Add(Child);
+		}
+	}
+	for (const TSharedPtr<FLevelSelectorTreeNode>& Child : Folder.Levels)
+	{
+		if (VisibleLevels.Contains(Child->Level.Get()))
+		{
+			OutChildren.Add(Child);
+		}
+	}
+}
+#pragma endregion
+
+#pragma region Maintenance
+FLevelSelectorPathTrie::FLevelSelectorPathTrie()
+	: Root(MakeShared<FLevelSelectorTreeNode>())
+{
+}
+
+void FLevelSelectorPathTrie::Build(TConstArrayView<TSharedPtr<FLevelSelectorItem>> SortedItems)
+{
+	Root = MakeShared<FLevelSelectorTreeNode>();
+	FoldersByPath.Reset();
+	for (const TSharedPtr<FLevelSelectorItem>& Item : SortedItems)
+	{
+		Add(Item);
+	}
+}
+
+void FLevelSelectorPathTrie::Add(const TSharedPtr<FLevelSelectorItem>& Item)
+{
+	FLevelSelectorTreeNode* Folder = FindOrAddFolder(GetFolderPath(*Item));
+
+	TSharedPtr<FLevelSelectorTreeNode> LevelNode = MakeShared<FLevelSelectorTreeNode>();
+	LevelNode->Level = Item;
+	LevelNode->Parent = Folder;
+	InsertLevelNode(*Folder, LevelNode);
+
+	for (FLevelSelectorTreeNode* Node = Folder; Node; Node = Node->Parent)
+	{
+		++Node->NumLevels;
+	}
+}
+
+void FLevelSelectorPathTrie::Remove(const TSharedPtr<FLevelSelectorItem>& Item)
+{
+	FLevelSelectorTreeNode* Folder = FindFolder(*Item);
+	if (!Folder || Folder->Levels.RemoveAll([&Item](const TSharedPtr<FLevelSelectorTreeNode>& Node) { return Node->Level == Item; }) == 0)
+	{
+		return;
+	}
+
+	// Folders left without levels go away bottom-up, the parent pointer is read before the node is released.
+	for (FLevelSelectorTreeNode* Node = Folder; Node; )
+	{
+		FLevelSelectorTreeNode* Parent = Node->Parent;
+		--Node->NumLevels;
+		if (Node->NumLevels == 0 && Parent)
+		{
+			FoldersByPath.Remove(Node->Path);
+			Parent->Folders.RemoveAll([Node](const TSharedPtr<FLevelSelectorTreeNode>& Child) { return Child.Get() == Node; });
+		}
+		Node = Parent;
+	}
+}
+
+void FLevelSelectorPathTrie::Update(const TSharedPtr<FLevelSelectorItem>& Item)
+{
+	FLevelSelectorTreeNode* Folder = FindFolder(*Item);
+	if (!Folder)
+	{
+		return;
+	}
+
+	const int32 Index = Folder->Levels.IndexOfByPredicate([&Item](const TSharedPtr<FLevelSelectorTreeNode>& Node) { return Node->Level == Item; });
+	if (Index != INDEX_NONE)
+	{
+		const TSharedPtr<FLevelSelectorTreeNode> LevelNode = Folder->Levels[Index];
+		Folder->Levels.RemoveAt(Index);
+		InsertLevelNode(*Folder, LevelNode);
+	}
+}
+
+TSharedPtr<FLevelSelectorTreeNode> FLevelSelectorPathTrie::FindLevelNode(const FLevelSelectorItem& Item) const
+{
+	if (const FLevelSelectorTreeNode* Folder = FindFolder(Item))
+	{
+		for (const TSharedPtr<FLevelSelectorTreeNode>& Node : Folder->Levels)
+		{
+			if (Node->Level.Get() == &Item)
+			{
+				return Node;
+			}
+		}
+	}
+	return nullptr;
+}
+
+FLevelSelectorTreeNode* FLevelSelectorPathTrie::FindOrAddFolder(const FString& FolderPath)
+{
+	if (FLevelSelectorTreeNode* const* Existing = FoldersByPath.Find(FolderPath))
+	{
+		return *Existing;
+	}
+
+	int32 SlashIndex = INDEX_NONE;
+	FolderPath.FindLastChar(TEXT('/'), SlashIndex);
+	FLevelSelectorTreeNode* Parent = SlashIndex > 0 ? FindOrAddFolder(FolderPath.Left(SlashIndex)) : Root.Get();
+
+	TSharedPtr<FLevelSelectorTreeNode> Folder = MakeShared<FLevelSelectorTreeNode>();
+	Folder->Name = FolderPath.Mid(SlashIndex + 1);
+	Folder->FoldedName = FLevelSelectorSearchIndex::Fold(Folder->Name);
+	Folder->Path = FolderPath;
+	Folder->Parent = Parent;
+
+	const int32 InsertIndex = Algo::LowerBound(Parent->Folders, Folder, &LevelSelectorPathTrie::CompareFolders);
+	Parent->Folders.Insert(Folder, InsertIndex);
+	FoldersByPath.Add(FolderPath, Folder.Get());
+	return Folder.Get();
+}
+
+FLevelSelectorTreeNode* FLevelSelectorPathTrie::FindFolder(const FLevelSelectorItem& Item) const
+{
+	return FoldersByPath.FindRef(GetFolderPath(Item));
+}
+
+void FLevelSelectorPathTrie::InsertLevelNode(FLevelSelectorTreeNode& Folder, const TSharedPtr<FLevelSelectorTreeNode>& LevelNode)
+{
+	const int32 InsertIndex = Algo::LowerBound(Folder.Levels, LevelNode, &LevelSelectorPathTrie::CompareLevels);
+	Folder.Levels.Insert(LevelNode, InsertIndex);
+}
+
+FString FLevelSelectorPathTrie::GetFolderPath(const FLevelSelectorItem& Item)
+{
+	return FPackageName::GetLongPackagePath(Item.PackagePath);
+}
+#pragma endregion
+
+#pragma region Search
+void FLevelSelectorPathTrie::Filter(FStringView FoldedQuery, TConstArrayView<TSharedPtr<FLevelSelectorItem>> MatchingLevels,
+	const TFunction<bool(const FLevelSelectorItem&)>& LevelFilter, FLevelSelectorTreeFilter& OutFilter) const
+{
+	OutFilter.Reset();
+	OutFilter.bActive = true;
+
+	// Walking up stops at the first folder already marked, so every folder is marked at most once.
+	const auto MarkPathVisible = [&OutFilter, this](FLevelSelectorTreeNode* Folder)
+	{
+		for (; Folder && Folder != Root.Get(); Folder = Folder->Parent)
+		{
+			bool bAlreadyVisible = false;
+			OutFilter.VisibleFolders.Add(Folder, &bAlreadyVisible);
+			if (bAlreadyVisible)
+			{
+				break;
+			}
+		}
+	};
+
+	for (const TSharedPtr<FLevelSelectorItem>& Item : MatchingLevels)
+	{
+		OutFilter.VisibleLevels.Add(Item.Get());
+		MarkPathVisible(FindFolder(*Item));
+	}
+
+	if (FoldedQuery.IsEmpty())
+	{
+		return;
+	}
+
+	FString FoldedPath;
+	const bool bMatchPath = UE::String::FindFirstChar(FoldedQuery, TEXT('/')) != INDEX_NONE;
+	TArray<FLevelSelectorTreeNode*, TInlineAllocator<64>> Stack;
+	for (const TSharedPtr<FLevelSelectorTreeNode>& Folder : Root->Folders)
+	{
+		Stack.Add(Folder.Get());
+	}
+
+	while (Stack.Num() > 0)
+	{
+		FLevelSelectorTreeNode* Folder = Stack.Pop();
+		if (bMatchPath)
+		{
+			FoldedPath = FLevelSelectorSearchIndex::Fold(Folder->Path);
+		}
+		const FStringView Text = bMatchPath ? FStringView(FoldedPath) : FStringView(Folder->FoldedName);
+		if (UE::String::FindFirst(Text, FoldedQuery, ESearchCase::CaseSensitive) == INDEX_NONE)
+		{
+			for (const TSharedPtr<FLevelSelectorTreeNode>& Child : Folder->Folders)
+			{
+				Stack.Add(Child.Get());
+			}
+			continue;
+		}
+
+		// The whole subtree matches, without a level filter nothing below it has to be visited.
+		if (!LevelFilter)
+		{
+			OutFilter.MatchedFolders.Add(Folder);
+			MarkPathVisible(Folder->Parent);
+			continue;
+		}
+
+		TArray<FLevelSelectorTreeNode*, TInlineAllocator<64>> SubtreeStack;
+		SubtreeStack.Add(Folder);
+		while (SubtreeStack.Num() > 0)
+		{
+			FLevelSelectorTreeNode* SubFolder = SubtreeStack.Pop();
+			for (const TSharedPtr<FLevelSelectorTreeNode>& LevelNode : SubFolder->Levels)
+			{
+				if (LevelFilter(*LevelNode->Level))
+				{
+					OutFilter.VisibleLevels.Add(LevelNode->Level.Get());
+					MarkPathVisible(SubFolder);
+				}
+			}
+			for (const TSharedPtr<FLevelSelectorTreeNode>& Child : SubFolder->Folders)
+			{
+				SubtreeStack.Add(Child.Get());
+			}
+		}
+	}
+}
+#pragma endregion
@@ -0,0 +1,450 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "LevelSelectorPrefetcher.h"
+#include "BDC_LevelSelector.h"
+#include "BDC_LevelSelectorUserSettings.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Editor.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/PackageName.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+
+namespace LevelSelectorPrefetcher
+{
+	/** Async package loads issued at once over all prefetches, so prefetching never floods the loader. */
+	static constexpr int32 MaxLoadsInFlight = 4;
+
+	static FName ToPackageName(const FString& MapPath)
+	{
+		FString PackageName = FPackageName::ObjectPathToPackageName(MapPath);
+		if (!FPackageName::IsValidLongPackageName(PackageName))
+		{
+			FPackageName::TryConvertFilenameToLongPackageName(MapPath, PackageName);
+		}
+		return FName(*PackageName);
+	}
+}
+
+static FAutoConsoleCommand CmdLevelSelectorPrefetchStats(
+	TEXT("LevelSelector.Prefetch.Stats"),
+	TEXT("Prints how many level prefetches were requested, completed, cancelled and evicted, and their hit rate."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		const FBDC_LevelSelectorModule* Module = FModuleManager::GetModulePtr<FBDC_LevelSelectorModule>(TEXT("BDC_LevelSelector"));
+		const TSharedPtr<FLevelSelectorPrefetcher> Prefetcher = Module ? Module->GetPrefetcher() : nullptr;
+		if (!Prefetcher.IsValid())
+		{
+			UE_LOG(LogBDCLevelSelector, Display, TEXT("Level prefetching is not running."));
+			return;
+		}
+
+		const FLevelSelectorPrefetchStats& Stats = Prefetcher->GetStats();
+		UE_LOG(LogBDCLevelSelector, Display, TEXT("Level prefetch: %d requested, %d completed, %d cancelled, %d evicted."),
+			Stats.Requested, Stats.Completed, Stats.Cancelled, Stats.Evicted);
+		UE_LOG(LogBDCLevelSelector, Display, TEXT("Level prefetch: %d hits, %d partial hits, %d misses, hit rate %.1f%%."),
+			Stats.Hits, Stats.PartialHits, Stats.Misses, Stats.GetHitRate() * 100.0);
+	}));
+
+#pragma region Lifecycle
+FLevelSelectorPrefetcher::~FLevelSelectorPrefetcher()
+{
+	Shutdown();
+}
+
+void FLevelSelectorPrefetcher::Initialize()
+{
+	if (bInitialized)
+	{
+		return;
+	}
+	bInitialized = true;
+
+	FEditorDelegates::OnMapOpened.AddSP(this, &FLevelSelectorPrefetcher::OnMapOpened);
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FLevelSelectorPrefetcher::OnTick), 0.05f);
+}
+
+void FLevelSelectorPrefetcher::Shutdown()
+{
+	if (!bInitialized)
+	{
+		return;
+	}
+	bInitialized = false;
+
+	FEditorDelegates::OnMapOpened.RemoveAll(this);
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+	CancelAll();
+	ReapCancelledReads(true);
+}
+
+void FLevelSelectorPrefetcher::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	for (TPair<FName, FPrefetch>& Pair : Prefetches)
+	{
+		Collector.AddReferencedObjects(Pair.Value.LoadedAssets);
+	}
+}
+
+FString FLevelSelectorPrefetcher::GetReferencerName() const
+{
+	return TEXT("FLevelSelectorPrefetcher");
+}
+#pragma endregion
+
+#pragma region Requests
+void FLevelSelectorPrefetcher::Prefetch(FName PackageName, ELevelPrefetchReason Reason)
+{
+	const UBDC_LevelSelectorUserSettings* UserSettings = GetDefault<UBDC_LevelSelectorUserSettings>();
+	if (!bInitialized || PackageName.IsNone() || !UserSettings->bEnablePrefetch || Prefetches.Contains(PackageName))
+	{
+		return;
+	}
+
+	// The open level, or one that is loaded anyway, has nothing left to warm.
+	if (FindObjectFast<UPackage>(nullptr, PackageName))
+	{
+		return;
+	}
+
+	FString Filename;
+	if (!FPackageName::DoesPackageExist(PackageName.ToString(), &Filename))
+	{
+		return;
+	}
+
+	FPrefetch& Entry = Prefetches.Add(PackageName);
+	Entry.Reason = Reason;
+	Entry.Serial = NextSerial++;
+	Entry.StartTime = FPlatformTime::Seconds();
+	++Stats.Requested;
+
+	// Reading the map file once puts it into the OS file cache, without creating the world before it is opened.
+	const int64 FileSize = IFileManager::Get().FileSize(*Filename);
+	if (FileSize > 0 && FileSize <= GetMemoryCapBytes())
+	{
+		Entry.MapFileHandle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenAsyncRead(*Filename));
+		if (Entry.MapFileHandle.IsValid())
+		{
+			Entry.MapFileRead.Reset(Entry.MapFileHandle->ReadRequest(0, FileSize, AIOP_Low));
+		}
+	}
+
+	const IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	TArray<FName> Dependencies;
+	AssetRegistry.GetDependencies(PackageName, Dependencies, UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
+	for (const FName& Dependency : Dependencies)
+	{
+		if (!FPackageName::IsScriptPackage(FNameBuilder(Dependency).ToView()))
+		{
+			Entry.QueuedDependencies.Add(Dependency);
+		}
+	}
+
+	UE_LOG(LogBDCLevelSelector, Verbose, TEXT("Prefetching %s (%d hard dependencies, %s)"), *PackageName.ToString(),
+		Entry.QueuedDependencies.Num(), Reason == ELevelPrefetchReason::Hover ? TEXT("hover") : TEXT("predicted"));
+	DispatchLoads();
+}
+
+void FLevelSelectorPrefetcher::Cancel(FName PackageName)
+{
+	if (const FPrefetch* Entry = Prefetches.Find(PackageName))
+	{
+		if (!Entry->bCompleted)
+		{
+			++Stats.Cancelled;
+		}
+		Release(PackageName);
+	}
+}
+
+void FLevelSelectorPrefetcher::CancelAll()
+{
+	TArray<FName> PackageNames;
+	Prefetches.GetKeys(PackageNames);
+	for (const FName& PackageName : PackageNames)
+	{
+		Cancel(PackageName);
+	}
+	HoverCandidate = NAME_None;
+	ActiveHoverPrefetch = NAME_None;
+}
+
+void FLevelSelectorPrefetcher::BeginHover(FName PackageName)
+{
+	if (PackageName != HoverCandidate)
+	{
+		HoverCandidate = PackageName;
+		HoverStartTime = FPlatformTime::Seconds();
+	}
+}
+
+void FLevelSelectorPrefetcher::EndHover()
+{
+	HoverCandidate = NAME_None;
+}
+
+bool FLevelSelectorPrefetcher::IsPrefetched(FName PackageName) const
+{
+	const FPrefetch* Entry = Prefetches.Find(PackageName);
+	return Entry && Entry->bCompleted;
+}
+#pragma endregion
+
+#pragma region Loading
+bool FLevelSelectorPrefetcher::OnTick(float DeltaTime)
+{
+	const UBDC_LevelSelectorUserSettings* UserSettings = GetDefault<UBDC_LevelSelectorUserSettings>();
+	if (!HoverCandidate.IsNone() && FPlatformTime::Seconds() - HoverStartTime >= UserSettings->PrefetchHoverDelaySeconds)
+	{
+		// Only the level hovered last is worth the bandwidth, an unfinished hover prefetch of another one is dropped.
+		if (ActiveHoverPrefetch != HoverCandidate)
+		{
+			const FPrefetch* ActiveEntry = Prefetches.Find(ActiveHoverPrefetch);
+			if (ActiveEntry && ActiveEntry->Reason == ELevelPrefetchReason::Hover && !ActiveEntry->bCompleted)
+			{
+				Cancel(ActiveHoverPrefetch);
+			}
+		}
+		Prefetch(HoverCandidate, ELevelPrefetchReason::Hover);
+		ActiveHoverPrefetch = HoverCandidate;
+		HoverCandidate = NAME_None;
+	}
+
+	for (TPair<FName, FPrefetch>& Pair : Prefetches)
+	{
+		FPrefetch& Entry = Pair.Value;
+		if (Entry.MapFileRead.IsValid() && Entry.MapFileRead->PollCompletion())
+		{
+			Entry.MapFileRead.Reset();
+			Entry.MapFileHandle.Reset();
+			UpdateCompletion(Pair.Key, Entry);
+		}
+	}
+
+	ReapCancelledReads(false);
+	DispatchLoads();
+	return true;
+}
+
+void FLevelSelectorPrefetcher::DispatchLoads()
+{
+	// MakeRoom may evict other prefetches, so this walks over a copy of the keys.
+	TArray<FName> LevelPackages;
+	Prefetches.GetKeys(LevelPackages);
+	for (const FName& LevelPackage : LevelPackages)
+	{
+		FPrefetch* Found = Prefetches.Find(LevelPackage);
+		if (!Found)
+		{
+			continue;
+		}
+
+		FPrefetch& Entry = *Found;
+		while (LoadsInFlight < LevelSelectorPrefetcher::MaxLoadsInFlight && !Entry.QueuedDependencies.IsEmpty())
+		{
+			const FName Dependency = Entry.QueuedDependencies.Pop();
+			if (FindObjectFast<UPackage>(nullptr, Dependency))
+			{
+				continue;
+			}
+
+			const IAssetRegistry& AssetRegistry = FModuleManager::GetModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+			const TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(Dependency);
+			const int64 DependencyBytes = PackageData.IsSet() ? FMath::Max<int64>(PackageData->DiskSize, 0) : 0;
+			if (!MakeRoom(DependencyBytes, LevelPackage))
+			{
+				UE_LOG(LogBDCLevelSelector, Verbose, TEXT("Prefetch of %s stops at the memory cap, %d dependencies are left cold."),
+					*LevelPackage.ToString(), Entry.QueuedDependencies.Num() + 1);
+				Entry.QueuedDependencies.Reset();
+				break;
+			}
+
+			TotalBytes += DependencyBytes;
+			Entry.Bytes += DependencyBytes;
+			++Entry.LoadsInFlight;
+			++LoadsInFlight;
+			LoadPackageAsync(Dependency.ToString(),
+				FLoadPackageAsyncDelegate::CreateSP(this, &FLevelSelectorPrefetcher::OnDependencyLoaded, LevelPackage, Entry.Serial));
+		}
+		UpdateCompletion(LevelPackage, Entry);
+	}
+}
+
+void FLevelSelectorPrefetcher::OnDependencyLoaded(const FName& DependencyName, UPackage* Package, EAsyncLoadingResult::Type Result, FName LevelPackage, uint32 Serial)
+{
+	--LoadsInFlight;
+
+	// A cancelled prefetch just lets go of its package, nothing references it and the next GC collects it.
+	FPrefetch* Entry = Prefetches.Find(LevelPackage);
+	if (!Entry || Entry->Serial != Serial)
+	{
+		return;
+	}
+
+	--Entry->LoadsInFlight;
+	if (Result == EAsyncLoadingResult::Succeeded && Package)
+	{
+		ForEachObjectWithPackage(Package, [Entry](UObject* Object)
+		{
+			if (Object->IsAsset())
+			{
+				Entry->LoadedAssets.Add(Object);
+			}
+			return true;
+		}, false);
+	}
+	UpdateCompletion(LevelPackage, *Entry);
+}
+
+void FLevelSelectorPrefetcher::UpdateCompletion(FName LevelPackage, FPrefetch& Entry)
+{
+	if (Entry.bCompleted || !Entry.QueuedDependencies.IsEmpty() || Entry.LoadsInFlight > 0 || Entry.MapFileRead.IsValid())
+	{
+		return;
+	}
+
+	Entry.bCompleted = true;
+	++Stats.Completed;
+	UE_LOG(LogBDCLevelSelector, Verbose, TEXT("Prefetched %s in %.1f ms (%.1f MB, %d assets)"), *LevelPackage.ToString(),
+		(FPlatformTime::Seconds() - Entry.StartTime) * 1000.0, Entry.Bytes / (1024.0 * 1024.0), Entry.LoadedAssets.Num());
+}
+
+void FLevelSelectorPrefetcher::Release(FName PackageName)
+{
+	FPrefetch* Found = Prefetches.Find(PackageName);
+	if (!Found)
+	{
+		return;
+	}
+	FPrefetch Entry = MoveTemp(*Found);
+	Prefetches.Remove(PackageName);
+
+	// The request can't be destroyed before it finished, it is parked instead of blocking the map open on it.
+	if (Entry.MapFileRead.IsValid())
+	{
+		Entry.MapFileRead->Cancel();
+		FCancelledRead& CancelledRead = CancelledReads.AddDefaulted_GetRef();
+		CancelledRead.MapFileRead = MoveTemp(Entry.MapFileRead);
+		CancelledRead.MapFileHandle = MoveTemp(Entry.MapFileHandle);
+	}
+	Entry.MapFileHandle.Reset();
+	TotalBytes -= Entry.Bytes;
+}
+
+void FLevelSelectorPrefetcher::ReapCancelledReads(bool bWait)
+{
+	for (int32 Index = CancelledReads.Num() - 1; Index >= 0; --Index)
+	{
+		FCancelledRead& CancelledRead = CancelledReads[Index];
+		if (bWait)
+		{
+			CancelledRead.MapFileRead->WaitCompletion();
+		}
+		else if (!CancelledRead.MapFileRead->PollCompletion())
+		{
+			continue;
+		}
+
+		// The request goes before the handle it was issued on.
+		CancelledRead.MapFileRead.Reset();
+		CancelledRead.MapFileHandle.Reset();
+		CancelledReads.RemoveAtSwap(Index);
+	}
+}
+
+bool FLevelSelectorPrefetcher::MakeRoom(int64 Bytes, FName Requester)
+{
+	const int64 MemoryCap = GetMemoryCapBytes();
+	while (TotalBytes + Bytes > MemoryCap)
+	{
+		FName Oldest;
+		double OldestStartTime = TNumericLimits<double>::Max();
+		for (const TPair<FName, FPrefetch>& Pair : Prefetches)
+		{
+			if (Pair.Key != Requester && Pair.Value.bCompleted && Pair.Value.StartTime < OldestStartTime)
+			{
+				Oldest = Pair.Key;
+				OldestStartTime = Pair.Value.StartTime;
+			}
+		}
+
+		if (Oldest.IsNone())
+		{
+			return false;
+		}
+		++Stats.Evicted;
+		Release(Oldest);
+	}
+	return true;
+}
+
+int64 FLevelSelectorPrefetcher::GetMemoryCapBytes() const
+{
+	return static_cast<int64>(GetDefault<UBDC_LevelSelectorUserSettings>()->PrefetchMemoryCapMB) * 1024 * 1024;
+}
+#pragma endregion
+
+#pragma region Switch History
+void FLevelSelectorPrefetcher::OnMapOpened(const FString& Filename, bool bAsTemplate)
+{
+	const FName PackageName = LevelSelectorPrefetcher::ToPackageName(Filename);
+	if (const FPrefetch* Entry = Prefetches.Find(PackageName))
+	{
+		if (Entry->bCompleted)
+		{
+			++Stats.Hits;
+		}
+		else
+		{
+			++Stats.PartialHits;
+		}
+		Release(PackageName);
+	}
+	else
+	{
+		++Stats.Misses;
+	}
+	HoverCandidate = NAME_None;
+
+	PrefetchPredictedLevels(PackageName);
+}
+
+void FLevelSelectorPrefetcher::PrefetchPredictedLevels(FName CurrentPackage)
+{
+	const UBDC_LevelSelectorUserSettings* UserSettings = GetDefault<UBDC_LevelSelectorUserSettings>();
+	TArray<FName> PredictedLevels;
+	if (UserSettings->bEnablePrefetch)
+	{
+		UserSettings->GetPredictedLevels(UserSettings->PredictedPrefetchCount, CurrentPackage, PredictedLevels);
+	}
+
+	TArray<FName> StalePredictions;
+	for (const TPair<FName, FPrefetch>& Pair : Prefetches)
+	{
+		if (Pair.Value.Reason == ELevelPrefetchReason::Predicted && !PredictedLevels.Contains(Pair.Key))
+		{
+			StalePredictions.Add(Pair.Key);
+		}
+	}
+	for (const FName& PackageName : StalePredictions)
+	{
+		Cancel(PackageName);
+	}
+
+	for (const FName& PackageName : PredictedLevels)
+	{
+		Prefetch(PackageName, ELevelPrefetchReason::Predicted);
+	}
+}
+#pragma endregion
@@ -0,0 +1,67 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "LevelSelectorRegionLoader.h"
+#include "BDC_LevelSelector.h"
+#include "LevelSelectorStats.h"
+#include "Engine/World.h"
+#include "WorldPartition/WorldPartition.h"
+#include "WorldPartition/WorldPartitionEditorLoaderAdapter.h"
+#include "WorldPartition/LoaderAdapter/LoaderAdapterShape.h"
+
+bool FLevelSelectorRegionLoader::LoadAround(UWorld* World, const FVector& Center, double Radius)
+{
+	UWorldPartition* WorldPartition = World ? World->GetWorldPartition() : nullptr;
+	if (!WorldPartition || Radius <= 0.0)
+	{
+		return false;
+	}
+
+	// Editor cells are laid out in 2D, the region spans the whole height so nothing above or below the camera is missed.
+	const FBox Region(
+		FVector(Center.X - Radius, Center.Y - Radius, -UE_OLD_HALF_WORLD_MAX),
+		FVector(Center.X + Radius, Center.Y + Radius, UE_OLD_HALF_WORLD_MAX));
+
+	LEVELSELECTOR_SCOPE_CYCLE_COUNTER(STAT_LevelSelector_RegionLoad);
+	UWorldPartitionEditorLoaderAdapter* EditorLoaderAdapter = WorldPartition->CreateEditorLoaderAdapter<FLoaderAdapterShape>(World, Region, TEXT("Level Selector Camera Favorite"));
+	IWorldPartitionActorLoaderInterface::ILoaderAdapter* LoaderAdapter = EditorLoaderAdapter->GetLoaderAdapter();
+	LoaderAdapter->SetUserCreated(true);
+	LoaderAdapter->Load();
+
+	UE_LOG(LogBDCLevelSelector, Verbose, TEXT("Loaded the region within %.0f cm of %s."), Radius, *Center.ToString());
+	return true;
+}
+
+int32 FLevelSelectorRegionLoader::UnloadRegions(UWorld* World)
+{
+	UWorldPartition* WorldPartition = World ? World->GetWorldPartition() : nullptr;
+	if (!WorldPartition)
+	{
+		return 0;
+	}
+
+	// Releasing an adapter removes it from the registered set, so the set is copied first.
+	TArray<UWorldPartitionEditorLoaderAdapter*> EditorLoaderAdapters;
+	for (UWorldPartitionEditorLoaderAdapter* EditorLoaderAdapter : WorldPartition->GetRegisteredEditorLoaderAdapters())
+	{
+		EditorLoaderAdapters.Add(EditorLoaderAdapter);
+	}
+
+	LEVELSELECTOR_SCOPE_CYCLE_COUNTER(STAT_LevelSelector_RegionUnload);
+	for (UWorldPartitionEditorLoaderAdapter* EditorLoaderAdapter : EditorLoaderAdapters)
+	{
+		if (IWorldPartitionActorLoaderInterface::ILoaderAdapter* LoaderAdapter = EditorLoaderAdapter ? EditorLoaderAdapter->GetLoaderAdapter() : nullptr)
+		{
+			LoaderAdapter->Unload();
+		}
+		WorldPartition->ReleaseEditorLoaderAdapter(EditorLoaderAdapter);
+	}
+
+	UE_LOG(LogBDCLevelSelector, Verbose, TEXT("Unloaded %d regions of %s."), EditorLoaderAdapters.Num(), *World->GetName());
+	return EditorLoaderAdapters.Num();
+}
@@ -0,0 +1,296 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "LevelSelectorSearchIndex.h"
+#include "BDC_LevelSelector.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Unique.h"
+#include "HAL/IConsoleManager.h"
+#include "String/Find.h"
+
+static FAutoConsoleCommand CmdLevelSelectorSearchBenchmark(
+	TEXT("LevelSelector.Search.Benchmark"),
+	TEXT("Builds a synthetic search index and times queries against it. Usage: LevelSelector.Search.Benchmark [NumEntries=100000]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 NumEntries = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 100000;
+		const TCHAR* Regions[] = { TEXT("Desert"), TEXT("Forest"), TEXT("Arctic"), TEXT("City"), TEXT("Swamp"), TEXT("Canyon") };
+		const TCHAR* Kinds[] = { TEXT("Gym"), TEXT("Test"), TEXT("Lighting"), TEXT("Gameplay"), TEXT("Art"), TEXT("Audio") };
+
+		// Name and path of every entry, back to back.
+		TArray<FString> Texts;
+		Texts.Reserve(NumEntries * 2);
+		for (int32 Index = 0; Index < NumEntries; ++Index)
+		{
+			const TCHAR* Region = Regions[Index % UE_ARRAY_COUNT(Regions)];
+			const TCHAR* Kind = Kinds[(Index / UE_ARRAY_COUNT(Regions)) % UE_ARRAY_COUNT(Kinds)];
+			const FString Name = FString::Printf(TEXT("L_%s_%s_%06d"), Region, Kind, Index);
+			const FString Path = FString::Printf(TEXT("/Game/Maps/%s/%s/%03d/%s"), Region, Kind, Index % 997, *Name);
+			Texts.Add(Name);
+			Texts.Add(Path);
+		}
+
+		FLevelSelectorSearchIndex SearchIndex;
+		const double BuildStart = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < NumEntries; ++Index)
+		{
+			SearchIndex.Add({ FStringView(Texts[Index * 2]), FStringView(Texts[Index * 2 + 1]) });
+		}
+		const double BuildSeconds = FPlatformTime::Seconds() - BuildStart;
+
+		const TCHAR* Queries[] = { TEXT("d"), TEXT("de"), TEXT("des"), TEXT("dese"), TEXT("desert_gym"), TEXT("004242"), TEXT("city/art/12"), TEXT("nomatch") };
+		constexpr int32 Repetitions = 20;
+		UE_LOG(LogBDCLevelSelector, Display, TEXT("Search index: %d entries built in %.1f ms"), NumEntries, BuildSeconds * 1000.0);
+
+		TArray<int32> Matches;
+		for (const TCHAR* Query : Queries)
+		{
+			const FString Folded = FLevelSelectorSearchIndex::Fold(Query);
+			const double QueryStart = FPlatformTime::Seconds();
+			for (int32 Repetition = 0; Repetition < Repetitions; ++Repetition)
+			{
+				Matches.Reset();
+				SearchIndex.Find(Folded, Matches);
+			}
+			const double AverageMicroseconds = (FPlatformTime::Seconds() - QueryStart) * 1000000.0 / Repetitions;
+			UE_LOG(LogBDCLevelSelector, Display, TEXT("  \"%s\": %d matches, %.1f us per query"), Query, Matches.Num(), AverageMicroseconds);
+		}
+
+		// Removing and re-adding a slice of entries, as a plugin unmount and remount does.
+		const int32 NumChurned = FMath::Min(NumEntries, 1000);
+		const double ChurnStart = FPlatformTime::Seconds();
+		for (int32 Id = 0; Id < NumChurned; ++Id)
+		{
+			SearchIndex.Remove(Id);
+		}
+		const double RemoveSeconds = FPlatformTime::Seconds() - ChurnStart;
+		for (int32 Id = 0; Id < NumChurned; ++Id)
+		{
+			SearchIndex.Add({ FStringView(Texts[Id * 2]), FStringView(Texts[Id * 2 + 1]) });
+		}
+		UE_LOG(LogBDCLevelSelector, Display, TEXT("  %d removals: %.1f us each, %d re-adds: %.1f us each"),
+			NumChurned, RemoveSeconds * 1000000.0 / NumChurned, NumChurned, (FPlatformTime::Seconds() - ChurnStart - RemoveSeconds) * 1000000.0 / NumChurned);
+	}));
+
+int32 FLevelSelectorSearchIndex::Add(TConstArrayView<FStringView> Texts)
+{
+	FEntry NewEntry;
+	for (const FStringView& Text : Texts)
+	{
+		if (!NewEntry.FoldedText.IsEmpty())
+		{
+			NewEntry.FoldedText.AppendChar(TEXT('\n'));
+		}
+		NewEntry.FoldedText.Append(Text);
+	}
+	NewEntry.FoldedText.ToLowerInline();
+
+	TArray<uint64> Grams;
+	CollectGrams(NewEntry.FoldedText, Grams);
+
+	const int32 Id = Entries.Add(MoveTemp(NewEntry));
+	for (const uint64 Gram : Grams)
+	{
+		AddToPosting(Postings.FindOrAdd(Gram), Id);
+	}
+	return Id;
+}
+
+void FLevelSelectorSearchIndex::Remove(int32 Id)
+{
+	if (!Entries.IsValidIndex(Id))
+	{
+		return;
+	}
+
+	TArray<uint64> Grams;
+	CollectGrams(Entries[Id].FoldedText, Grams);
+	for (const uint64 Gram : Grams)
+	{
+		if (FPosting* Posting = Postings.Find(Gram))
+		{
+			RemoveFromPosting(*Posting, Id);
+			if (Posting->Num == 0)
+			{
+				Postings.Remove(Gram);
+			}
+		}
+	}
+	Entries.RemoveAt(Id);
+}
+
+void FLevelSelectorSearchIndex::Reset()
+{
+	Entries.Empty();
+	Postings.Empty();
+}
+
+void FLevelSelectorSearchIndex::Find(FStringView FoldedQuery, TArray<int32>& OutIds) const
+{
+	if (FoldedQuery.IsEmpty())
+	{
+		for (auto It = Entries.CreateConstIterator(); It; ++It)
+		{
+			OutIds.Add(It.GetIndex());
+		}
+		return;
+	}
+
+	if (FoldedQuery.Len() <= MaxGramLength)
+	{
+		if (const FPosting* Posting = Postings.Find(MakeGram(FoldedQuery)))
+		{
+			AppendIds(*Posting, OutIds);
+		}
+		return;
+	}
+
+	const FPosting* Candidates = nullptr;
+	for (int32 Index = 0; Index + MaxGramLength <= FoldedQuery.Len(); ++Index)
+	{
+		const FPosting* Posting = Postings.Find(MakeGram(FoldedQuery.Mid(Index, MaxGramLength)));
+		if (!Posting)
+		{
+			return;
+		}
+		if (!Candidates || Posting->Num < Candidates->Num)
+		{
+			Candidates = Posting;
+		}
+	}
+
+	TArray<int32> CandidateIds;
+	AppendIds(*Candidates, CandidateIds);
+	for (const int32 Id : CandidateIds)
+	{
+		if (Matches(Id, FoldedQuery))
+		{
+			OutIds.Add(Id);
+		}
+	}
+}
+
+bool FLevelSelectorSearchIndex::Matches(int32 Id, FStringView FoldedQuery) const
+{
+	return Entries.IsValidIndex(Id) && UE::String::FindFirst(Entries[Id].FoldedText, FoldedQuery, ESearchCase::CaseSensitive) != INDEX_NONE;
+}
+
+FString FLevelSelectorSearchIndex::Fold(FStringView Text)
+{
+	FString Folded(Text);
+	Folded.ToLowerInline();
+	return Folded;
+}
+
+void FLevelSelectorSearchIndex::AddToPosting(FPosting& Posting, int32 Id) const
+{
+	++Posting.Num;
+	if (Posting.bDense)
+	{
+		if (Id >= Posting.Bits.Num())
+		{
+			Posting.Bits.SetNum(FMath::Max(Id + 1, Entries.GetMaxIndex()), false);
+		}
+		Posting.Bits[Id] = true;
+		return;
+	}
+
+	// Ids are mostly handed out in increasing order, reused ones are inserted in place.
+	if (Posting.SortedIds.IsEmpty() || Posting.SortedIds.Last() < Id)
+	{
+		Posting.SortedIds.Add(Id);
+	}
+	else
+	{
+		Posting.SortedIds.Insert(Id, Algo::LowerBound(Posting.SortedIds, Id));
+	}
+
+	// A bit per id takes less memory than 32 bits per listed id once more than one in 32 entries is listed.
+	const int32 MaxId = Entries.GetMaxIndex();
+	if (MaxId >= 1024 && Posting.Num * 32 >= MaxId)
+	{
+		Posting.Bits.Init(false, MaxId);
+		for (const int32 ListedId : Posting.SortedIds)
+		{
+			Posting.Bits[ListedId] = true;
+		}
+		Posting.SortedIds.Empty();
+		Posting.bDense = true;
+	}
+}
+
+void FLevelSelectorSearchIndex::RemoveFromPosting(FPosting& Posting, int32 Id)
+{
+	if (Posting.bDense)
+	{
+		if (!Posting.Bits.IsValidIndex(Id) || !Posting.Bits[Id])
+		{
+			return;
+		}
+		Posting.Bits[Id] = false;
+		--Posting.Num;
+
+		// Half the density it was converted at, so a posting near the threshold doesn't flip back and forth.
+		if (Posting.Num * 64 < Posting.Bits.Num())
+		{
+			Posting.SortedIds.Reserve(Posting.Num);
+			for (TConstSetBitIterator<> It(Posting.Bits); It; ++It)
+			{
+				Posting.SortedIds.Add(It.GetIndex());
+			}
+			Posting.Bits.Empty();
+			Posting.bDense = false;
+		}
+		return;
+	}
+
+	const int32 Index = Algo::BinarySearch(Posting.SortedIds, Id);
+	if (Index != INDEX_NONE)
+	{
+		Posting.SortedIds.RemoveAt(Index);
+		--Posting.Num;
+	}
+}
+
+void FLevelSelectorSearchIndex::AppendIds(const FPosting& Posting, TArray<int32>& OutIds)
+{
+	if (!Posting.bDense)
+	{
+		OutIds.Append(Posting.SortedIds);
+		return;
+	}
+
+	OutIds.Reserve(OutIds.Num() + Posting.Num);
+	for (TConstSetBitIterator<> It(Posting.Bits); It; ++It)
+	{
+		OutIds.Add(It.GetIndex());
+	}
+}
+
+void FLevelSelectorSearchIndex::CollectGrams(FStringView FoldedText, TArray<uint64>& OutGrams)
+{
+	for (int32 Index = 0; Index < FoldedText.Len(); ++Index)
+	{
+		for (int32 Length = 1; Length <= MaxGramLength && Index + Length <= FoldedText.Len(); ++Length)
+		{
+			OutGrams.Add(MakeGram(FoldedText.Mid(Index, Length)));
+		}
+	}
+	OutGrams.Sort();
+	OutGrams.SetNum(Algo::Unique(OutGrams));
+}
+
+uint64 FLevelSelectorSearchIndex::MakeGram(FStringView Gram)
+{
+	uint64 Key = 0;
+	for (const TCHAR Character : Gram)
+	{
+		Key = (Key << 16) | uint64(uint16(Character));
+	}
+	return Key;
+}
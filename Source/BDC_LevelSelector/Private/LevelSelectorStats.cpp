@@ -0,0 +1,76 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "LevelSelectorStats.h"
+#include "BDC_LevelSelector.h"
+#include "HAL/IConsoleManager.h"
+
+UE_TRACE_CHANNEL_DEFINE(LevelSelectorChannel);
+
+DEFINE_STAT(STAT_LevelSelector_PopulateLevelList);
+DEFINE_STAT(STAT_LevelSelector_SortLevelList);
+DEFINE_STAT(STAT_LevelSelector_ApplyFilters);
+DEFINE_STAT(STAT_LevelSelector_GenerateRow);
+DEFINE_STAT(STAT_LevelSelector_RefreshSelection);
+DEFINE_STAT(STAT_LevelSelector_FilesLoaded);
+DEFINE_STAT(STAT_LevelSelector_SettingsWrite);
+DEFINE_STAT(STAT_LevelSelector_OverlayRefresh);
+DEFINE_STAT(STAT_LevelSelector_CollectMetadata);
+DEFINE_STAT(STAT_LevelSelector_FilterIndex);
+DEFINE_STAT(STAT_LevelSelector_FilterTree);
+DEFINE_STAT(STAT_LevelSelector_OverlayPaint);
+DEFINE_STAT(STAT_LevelSelector_OverlayMenu);
+DEFINE_STAT(STAT_LevelSelector_ToolbarConstruct);
+DEFINE_STAT(STAT_LevelSelector_RegionLoad);
+DEFINE_STAT(STAT_LevelSelector_RegionUnload);
+
+DEFINE_STAT(STAT_LevelSelector_ItemsIndexed);
+DEFINE_STAT(STAT_LevelSelector_RowsGenerated);
+DEFINE_STAT(STAT_LevelSelector_FilterPasses);
+DEFINE_STAT(STAT_LevelSelector_OverlayRefreshes);
+DEFINE_STAT(STAT_LevelSelector_ConfigWrites);
+
+static FAutoConsoleCommand CmdLevelSelectorFilterLatency(
+	TEXT("LevelSelector.Stats.FilterLatency"),
+	TEXT("Prints the filter latency of the last search box keystrokes."),
+	FConsoleCommandDelegate::CreateStatic(&FLevelSelectorFilterLatency::Dump));
+
+TArray<double> FLevelSelectorFilterLatency::Samples;
+int32 FLevelSelectorFilterLatency::NextSample = 0;
+
+void FLevelSelectorFilterLatency::Record(double Milliseconds)
+{
+	if (Samples.Num() < WindowSize)
+	{
+		Samples.Add(Milliseconds);
+	}
+	else
+	{
+		Samples[NextSample] = Milliseconds;
+	}
+	NextSample = (NextSample + 1) % WindowSize;
+}
+
+void FLevelSelectorFilterLatency::Dump()
+{
+	if (Samples.IsEmpty())
+	{
+		UE_LOG(LogBDCLevelSelector, Display, TEXT("No search box keystrokes recorded yet."));
+		return;
+	}
+
+	TArray<double> Sorted = Samples;
+	Sorted.Sort();
+	const auto Percentile = [&Sorted](double Fraction)
+	{
+		return Sorted[FMath::Clamp(FMath::CeilToInt(Fraction * Sorted.Num()) - 1, 0, Sorted.Num() - 1)];
+	};
+
+	UE_LOG(LogBDCLevelSelector, Display, TEXT("Filter latency over the last %d keystrokes: p50 %.3f ms, p90 %.3f ms, max %.3f ms, last %.3f ms"),
+		Sorted.Num(), Percentile(0.5), Percentile(0.9), Sorted.Last(), Samples[(NextSample + WindowSize - 1) % WindowSize]);
+}
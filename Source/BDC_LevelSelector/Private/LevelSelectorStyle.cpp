@@ -0,0 +1,83 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "LevelSelectorStyle.h"
+#include "Interfaces/IPluginManager.h"
+#include "Styling/AppStyle.h"
+#include "Styling/SlateStyleMacros.h"
+#include "Styling/SlateStyleRegistry.h"
+
+#define RootToContentDir Style->RootToContentDir
+
+TSharedPtr<FSlateStyleSet> FLevelSelectorStyle::StyleInstance = nullptr;
+
+void FLevelSelectorStyle::Initialize()
+{
+	if (!StyleInstance.IsValid())
+	{
+		StyleInstance = Create();
+		FSlateStyleRegistry::RegisterSlateStyle(*StyleInstance);
+	}
+}
+
+void FLevelSelectorStyle::Shutdown()
+{
+	if (StyleInstance.IsValid())
+	{
+		FSlateStyleRegistry::UnRegisterSlateStyle(*StyleInstance);
+		ensure(StyleInstance.IsUnique());
+		StyleInstance.Reset();
+	}
+}
+
+const ISlateStyle& FLevelSelectorStyle::Get()
+{
+	return *StyleInstance;
+}
+
+FName FLevelSelectorStyle::GetStyleSetName()
+{
+	static const FName StyleSetName(TEXT("LevelSelectorStyle"));
+	return StyleSetName;
+}
+
+const FSlateBrush* FLevelSelectorStyle::GetBrush(FName PropertyName)
+{
+	if (!StyleInstance.IsValid())
+	{
+		// Same meaning as the plugin icons, good enough when the module runs without its style set.
+		if (PropertyName == TEXT("LevelSelector.Favorite"))
+		{
+			return FAppStyle::GetBrush("Icons.Star");
+		}
+		if (PropertyName == TEXT("LevelSelector.Unfavorite"))
+		{
+			return FAppStyle::GetBrush("Icons.EmptyStar");
+		}
+		return FAppStyle::GetNoBrush();
+	}
+	return StyleInstance->GetBrush(PropertyName);
+}
+
+TSharedRef<FSlateStyleSet> FLevelSelectorStyle::Create()
+{
+	TSharedRef<FSlateStyleSet> Style = MakeShared<FSlateStyleSet>(GetStyleSetName());
+
+	if (const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("BDC_LevelSelector")))
+	{
+		Style->SetContentRoot(Plugin->GetBaseDir() / TEXT("Resources"));
+	}
+
+	const FVector2D Icon24x24(24.0f, 24.0f);
+	Style->Set("LevelSelector.Favorite", new IMAGE_BRUSH("LevelSelector_Favorite_True", Icon24x24));
+	Style->Set("LevelSelector.Unfavorite", new IMAGE_BRUSH("LevelSelector_Favorite_False", Icon24x24));
+
+	return Style;
+}
+
+#undef RootToContentDir
@@ -0,0 +1,407 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "LevelSelectorSwitchTelemetry.h"
+#include "BDC_LevelSelector.h"
+#include "Dom/JsonObject.h"
+#include "Editor.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace LevelSelectorSwitchTelemetry
+{
+	static constexpr uint32 Magic = 0x5453534C; // 'LSST'
+	static constexpr int32 Version = 1;
+	/** Delay before recorded samples are written, so a few switches in a row share one write. */
+	static constexpr float SaveDelaySeconds = 10.0f;
+
+	static FName ToPackageName(const FString& MapPath)
+	{
+		FString PackageName = FPackageName::ObjectPathToPackageName(MapPath);
+		if (!FPackageName::IsValidLongPackageName(PackageName))
+		{
+			FPackageName::TryConvertFilenameToLongPackageName(MapPath, PackageName);
+		}
+		return FName(*PackageName);
+	}
+
+	static bool IsEditorWorld(const UWorld* World)
+	{
+		return World && World->WorldType == EWorldType::Editor;
+	}
+
+	static float ElapsedMs(double From, double To)
+	{
+		return static_cast<float>(FMath::Max(To - From, 0.0) * 1000.0);
+	}
+}
+
+static FAutoConsoleCommand CmdLevelSelectorTelemetryExport(
+	TEXT("LevelSelector.Telemetry.Export"),
+	TEXT("Writes the recorded level switch times to a file. Usage: LevelSelector.Telemetry.Export [Filename.csv|Filename.json]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const FBDC_LevelSelectorModule* Module = FModuleManager::GetModulePtr<FBDC_LevelSelectorModule>(TEXT("BDC_LevelSelector"));
+		const TSharedPtr<FLevelSelectorSwitchTelemetry> Telemetry = Module ? Module->GetSwitchTelemetry() : nullptr;
+		if (!Telemetry.IsValid())
+		{
+			UE_LOG(LogBDCLevelSelector, Display, TEXT("Level switch telemetry is not running."));
+			return;
+		}
+
+		const FString Filename = Args.Num() > 0
+			? FPaths::ConvertRelativePathToFull(Args[0])
+			: FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("LevelSelector") / TEXT("SwitchTelemetry.csv"));
+		if (Telemetry->Export(Filename))
+		{
+			UE_LOG(LogBDCLevelSelector, Display, TEXT("Level switch telemetry written to %s"), *Filename);
+		}
+	}));
+
+#pragma region History
+void FLevelSwitchHistory::Add(const FLevelSwitchSample& Sample)
+{
+	if (Samples.Num() < Capacity)
+	{
+		Samples.Add(Sample);
+	}
+	else
+	{
+		Samples[Head] = Sample;
+		Head = (Head + 1) % Capacity;
+	}
+	UpdatePercentiles();
+}
+
+void FLevelSwitchHistory::UpdatePercentiles()
+{
+	TArray<float, TInlineAllocator<Capacity>> Totals;
+	for (const FLevelSwitchSample& Sample : Samples)
+	{
+		Totals.Add(Sample.GetTotalMs());
+	}
+	if (Totals.IsEmpty())
+	{
+		MedianMs = P95Ms = 0.0f;
+		return;
+	}
+
+	Totals.Sort();
+	const auto Percentile = [&Totals](float Fraction)
+	{
+		return Totals[FMath::Clamp(FMath::CeilToInt(Fraction * Totals.Num()) - 1, 0, Totals.Num() - 1)];
+	};
+	MedianMs = Percentile(0.5f);
+	P95Ms = Percentile(0.95f);
+}
+
+void FLevelSwitchHistory::GetOrderedSamples(TArray<FLevelSwitchSample>& OutSamples) const
+{
+	OutSamples.Reset(Samples.Num());
+	for (int32 Offset = 0; Offset < Samples.Num(); ++Offset)
+	{
+		OutSamples.Add(Samples[(Head + Offset) % Samples.Num()]);
+	}
+}
+#pragma endregion
+
+#pragma region Lifecycle
+void FLevelSelectorSwitchTelemetry::Initialize()
+{
+	if (bInitialized)
+	{
+		return;
+	}
+	bInitialized = true;
+
+	Load();
+	FWorldDelegates::OnWorldCleanup.AddSP(this, &FLevelSelectorSwitchTelemetry::OnWorldCleanup);
+	FWorldDelegates::OnPostWorldCleanup.AddSP(this, &FLevelSelectorSwitchTelemetry::OnPostWorldCleanup);
+	FWorldDelegates::OnPreWorldInitialization.AddSP(this, &FLevelSelectorSwitchTelemetry::OnPreWorldInitialization);
+	FEditorDelegates::OnMapOpened.AddSP(this, &FLevelSelectorSwitchTelemetry::OnMapOpened);
+}
+
+void FLevelSelectorSwitchTelemetry::Shutdown()
+{
+	if (!bInitialized)
+	{
+		return;
+	}
+	bInitialized = false;
+
+	FWorldDelegates::OnWorldCleanup.RemoveAll(this);
+	FWorldDelegates::OnPostWorldCleanup.RemoveAll(this);
+	FWorldDelegates::OnPreWorldInitialization.RemoveAll(this);
+	FEditorDelegates::OnMapOpened.RemoveAll(this);
+	PendingSwitch.Reset();
+	FlushSave();
+}
+#pragma endregion
+
+#pragma region Switch Timing
+void FLevelSelectorSwitchTelemetry::BeginSwitch(FName PackageName)
+{
+	FPendingSwitch& Switch = PendingSwitch.Emplace();
+	Switch.PackageName = PackageName;
+	Switch.StartTime = FDateTime::UtcNow();
+	Switch.Start = FPlatformTime::Seconds();
+}
+
+void FLevelSelectorSwitchTelemetry::EndSwitch()
+{
+	if (!PendingSwitch.IsSet())
+	{
+		return;
+	}
+
+	const FPendingSwitch Switch = PendingSwitch.GetValue();
+	PendingSwitch.Reset();
+	if (Switch.MapOpened == 0.0)
+	{
+		UE_LOG(LogBDCLevelSelector, Verbose, TEXT("Switch to %s was cancelled, not recording it."), *Switch.PackageName.ToString());
+		return;
+	}
+
+	// A phase whose boundary was not seen is folded into the next one instead of producing negative times.
+	const double WorldCleanup = Switch.WorldCleanup > 0.0 ? Switch.WorldCleanup : Switch.Start;
+	const double PostWorldCleanup = Switch.PostWorldCleanup > 0.0 ? Switch.PostWorldCleanup : WorldCleanup;
+	const double PreWorldInitialization = Switch.PreWorldInitialization > 0.0 ? Switch.PreWorldInitialization : PostWorldCleanup;
+
+	FLevelSwitchSample Sample;
+	Sample.Timestamp = Switch.StartTime.GetTicks();
+	Sample.SavePromptMs = LevelSelectorSwitchTelemetry::ElapsedMs(Switch.Start, WorldCleanup);
+	Sample.UnloadMs = LevelSelectorSwitchTelemetry::ElapsedMs(WorldCleanup, PostWorldCleanup);
+	Sample.LoadMs = LevelSelectorSwitchTelemetry::ElapsedMs(PostWorldCleanup, PreWorldInitialization);
+	Sample.PostLoadMs = LevelSelectorSwitchTelemetry::ElapsedMs(PreWorldInitialization, Switch.MapOpened);
+
+	Histories.FindOrAdd(Switch.PackageName).Add(Sample);
+	++Revision;
+	RequestSave();
+
+	UE_LOG(LogBDCLevelSelector, Log, TEXT("Opened %s in %.0f ms (save prompt %.0f, unload %.0f, load %.0f, post-load %.0f)"),
+		*Switch.PackageName.ToString(), Sample.GetTotalMs(), Sample.SavePromptMs, Sample.UnloadMs, Sample.LoadMs, Sample.PostLoadMs);
+	SwitchRecordedDelegate.Broadcast(Switch.PackageName);
+}
+
+float FLevelSelectorSwitchTelemetry::GetMedianMs(FName PackageName) const
+{
+	const FLevelSwitchHistory* History = Histories.Find(PackageName);
+	return History && !History->Samples.IsEmpty() ? History->MedianMs : -1.0f;
+}
+
+void FLevelSelectorSwitchTelemetry::OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	if (PendingSwitch.IsSet() && PendingSwitch->WorldCleanup == 0.0 && LevelSelectorSwitchTelemetry::IsEditorWorld(World))
+	{
+		PendingSwitch->WorldCleanup = FPlatformTime::Seconds();
+	}
+}
+
+void FLevelSelectorSwitchTelemetry::OnPostWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	// World partition maps clean up several worlds, the unload ends with the last one before the new world is created.
+	if (PendingSwitch.IsSet() && PendingSwitch->PreWorldInitialization == 0.0 && LevelSelectorSwitchTelemetry::IsEditorWorld(World))
+	{
+		PendingSwitch->PostWorldCleanup = FPlatformTime::Seconds();
+	}
+}
+
+void FLevelSelectorSwitchTelemetry::OnPreWorldInitialization(UWorld* World, const UWorld::InitializationValues IVS)
+{
+	if (PendingSwitch.IsSet() && PendingSwitch->PreWorldInitialization == 0.0 && LevelSelectorSwitchTelemetry::IsEditorWorld(World))
+	{
+		PendingSwitch->PreWorldInitialization = FPlatformTime::Seconds();
+	}
+}
+
+void FLevelSelectorSwitchTelemetry::OnMapOpened(const FString& Filename, bool bAsTemplate)
+{
+	if (PendingSwitch.IsSet() && LevelSelectorSwitchTelemetry::ToPackageName(Filename) == PendingSwitch->PackageName)
+	{
+		PendingSwitch->MapOpened = FPlatformTime::Seconds();
+	}
+}
+#pragma endregion
+
+#pragma region Persistence
+FString FLevelSelectorSwitchTelemetry::GetHistoryFilename()
+{
+	return FPaths::ProjectSavedDir() / TEXT("LevelSelector") / TEXT("SwitchTelemetry.bin");
+}
+
+bool FLevelSelectorSwitchTelemetry::Load()
+{
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *GetHistoryFilename(), FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Data);
+	uint32 FileMagic = 0;
+	int32 FileVersion = 0;
+	int32 NumLevels = 0;
+	Reader << FileMagic << FileVersion << NumLevels;
+	if (Reader.IsError() || FileMagic != LevelSelectorSwitchTelemetry::Magic || FileVersion != LevelSelectorSwitchTelemetry::Version)
+	{
+		UE_LOG(LogBDCLevelSelector, Warning, TEXT("Ignoring incompatible level switch history %s."), *GetHistoryFilename());
+		return false;
+	}
+
+	Histories.Reset();
+	Histories.Reserve(NumLevels);
+	for (int32 LevelIndex = 0; LevelIndex < NumLevels && !Reader.IsError(); ++LevelIndex)
+	{
+		FString PackageName;
+		FLevelSwitchHistory History;
+		Reader << PackageName << History.Head << History.Samples;
+		if (Reader.IsError() || History.Samples.Num() > FLevelSwitchHistory::Capacity || !History.Samples.IsValidIndex(History.Head))
+		{
+			break;
+		}
+		History.UpdatePercentiles();
+		Histories.Add(FName(*PackageName), MoveTemp(History));
+	}
+
+	if (Reader.IsError())
+	{
+		UE_LOG(LogBDCLevelSelector, Warning, TEXT("Ignoring truncated level switch history %s."), *GetHistoryFilename());
+		Histories.Reset();
+		return false;
+	}
+	++Revision;
+	return true;
+}
+
+void FLevelSelectorSwitchTelemetry::RequestSave()
+{
+	bSavePending = true;
+	if (!SaveTickerHandle.IsValid())
+	{
+		SaveTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FLevelSelectorSwitchTelemetry::OnSaveTick),
+			LevelSelectorSwitchTelemetry::SaveDelaySeconds);
+	}
+}
+
+bool FLevelSelectorSwitchTelemetry::OnSaveTick(float DeltaTime)
+{
+	SaveTickerHandle.Reset();
+	FlushSave();
+	return false;
+}
+
+void FLevelSelectorSwitchTelemetry::FlushSave()
+{
+	if (SaveTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(SaveTickerHandle);
+		SaveTickerHandle.Reset();
+	}
+	if (bSavePending)
+	{
+		bSavePending = false;
+		Save();
+	}
+}
+
+void FLevelSelectorSwitchTelemetry::Save()
+{
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+	uint32 FileMagic = LevelSelectorSwitchTelemetry::Magic;
+	int32 FileVersion = LevelSelectorSwitchTelemetry::Version;
+	int32 NumLevels = Histories.Num();
+	Writer << FileMagic << FileVersion << NumLevels;
+	for (TPair<FName, FLevelSwitchHistory>& Pair : Histories)
+	{
+		FString PackageName = Pair.Key.ToString();
+		Writer << PackageName << Pair.Value.Head << Pair.Value.Samples;
+	}
+
+	if (!FFileHelper::SaveArrayToFile(Data, *GetHistoryFilename()))
+	{
+		UE_LOG(LogBDCLevelSelector, Warning, TEXT("Could not write the level switch history to %s."), *GetHistoryFilename());
+	}
+}
+#pragma endregion
+
+#pragma region Export
+bool FLevelSelectorSwitchTelemetry::Export(const FString& Filename) const
+{
+	const FString Contents = FPaths::GetExtension(Filename).Equals(TEXT("json"), ESearchCase::IgnoreCase) ? ExportJson() : ExportCsv();
+	if (!FFileHelper::SaveStringToFile(Contents, *Filename, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogBDCLevelSelector, Error, TEXT("Could not write level switch telemetry to %s."), *Filename);
+		return false;
+	}
+	return true;
+}
+
+FString FLevelSelectorSwitchTelemetry::ExportCsv() const
+{
+	TStringBuilder<4096> Csv;
+	Csv << TEXT("Package,Timestamp,SavePromptMs,UnloadMs,LoadMs,PostLoadMs,TotalMs\n");
+
+	TArray<FLevelSwitchSample> Samples;
+	for (const TPair<FName, FLevelSwitchHistory>& Pair : Histories)
+	{
+		Pair.Value.GetOrderedSamples(Samples);
+		for (const FLevelSwitchSample& Sample : Samples)
+		{
+			Csv.Appendf(TEXT("%s,%s,%.1f,%.1f,%.1f,%.1f,%.1f\n"), *Pair.Key.ToString(), *FDateTime(Sample.Timestamp).ToIso8601(),
+				Sample.SavePromptMs, Sample.UnloadMs, Sample.LoadMs, Sample.PostLoadMs, Sample.GetTotalMs());
+		}
+	}
+	return FString(Csv.ToView());
+}
+
+FString FLevelSelectorSwitchTelemetry::ExportJson() const
+{
+	TArray<TSharedPtr<FJsonValue>> Levels;
+	TArray<FLevelSwitchSample> Samples;
+	for (const TPair<FName, FLevelSwitchHistory>& Pair : Histories)
+	{
+		TArray<TSharedPtr<FJsonValue>> SampleValues;
+		Pair.Value.GetOrderedSamples(Samples);
+		for (const FLevelSwitchSample& Sample : Samples)
+		{
+			TSharedRef<FJsonObject> SampleObject = MakeShared<FJsonObject>();
+			SampleObject->SetStringField(TEXT("Timestamp"), FDateTime(Sample.Timestamp).ToIso8601());
+			SampleObject->SetNumberField(TEXT("SavePromptMs"), Sample.SavePromptMs);
+			SampleObject->SetNumberField(TEXT("UnloadMs"), Sample.UnloadMs);
+			SampleObject->SetNumberField(TEXT("LoadMs"), Sample.LoadMs);
+			SampleObject->SetNumberField(TEXT("PostLoadMs"), Sample.PostLoadMs);
+			SampleObject->SetNumberField(TEXT("TotalMs"), Sample.GetTotalMs());
+			SampleValues.Add(MakeShared<FJsonValueObject>(SampleObject));
+		}
+
+		TSharedRef<FJsonObject> LevelObject = MakeShared<FJsonObject>();
+		LevelObject->SetStringField(TEXT("Package"), Pair.Key.ToString());
+		LevelObject->SetNumberField(TEXT("MedianMs"), Pair.Value.MedianMs);
+		LevelObject->SetNumberField(TEXT("P95Ms"), Pair.Value.P95Ms);
+		LevelObject->SetArrayField(TEXT("Samples"), SampleValues);
+		Levels.Add(MakeShared<FJsonValueObject>(LevelObject));
+	}
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetStringField(TEXT("Exported"), FDateTime::UtcNow().ToIso8601());
+	Root->SetArrayField(TEXT("Levels"), Levels);
+
+	FString Json;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	FJsonSerializer::Serialize(Root, Writer);
+	return Json;
+}
+#pragma endregion
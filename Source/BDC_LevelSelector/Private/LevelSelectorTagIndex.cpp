@@ -0,0 +1,153 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "LevelSelectorTagIndex.h"
+
+void FLevelSelectorTagIndex::SetTags(int32 Id, const FGameplayTagContainer& Tags)
+{
+	if (Id < 0)
+	{
+		return;
+	}
+
+	// Bits are assigned before the row is touched, a new bit may widen every row.
+	TArray<int32, TInlineAllocator<16>> Bits;
+	for (const FGameplayTag& Tag : Tags)
+	{
+		if (!Tag.IsValid())
+		{
+			continue;
+		}
+		for (const FGameplayTag& ParentOrSelf : Tag.GetGameplayTagParents())
+		{
+			Bits.AddUnique(FindOrAddBit(ParentOrSelf));
+		}
+	}
+
+	if (Id >= NumIds)
+	{
+		NumIds = Id + 1;
+		Words.SetNumZeroed(NumIds * WordsPerId);
+	}
+
+	uint64* Row = Words.GetData() + Id * WordsPerId;
+	FMemory::Memzero(Row, WordsPerId * sizeof(uint64));
+	for (const int32 Bit : Bits)
+	{
+		Row[Bit / 64] |= uint64(1) << (Bit % 64);
+	}
+}
+
+void FLevelSelectorTagIndex::Remove(int32 Id)
+{
+	if (Id >= 0 && Id < NumIds)
+	{
+		FMemory::Memzero(Words.GetData() + Id * WordsPerId, WordsPerId * sizeof(uint64));
+	}
+}
+
+void FLevelSelectorTagIndex::Reset()
+{
+	BitsByTag.Reset();
+	Words.Reset();
+	WordsPerId = 0;
+	NumIds = 0;
+	++Generation;
+}
+
+FLevelSelectorTagIndex::FQuery FLevelSelectorTagIndex::MakeQuery(const FGameplayTagContainer& FilterTags, ELevelSelectorTagMatch Match)
+{
+	FQuery Query;
+	Query.Match = Match;
+	Query.Generation = Generation;
+
+	TArray<int32, TInlineAllocator<8>> Bits;
+	for (const FGameplayTag& Tag : FilterTags)
+	{
+		if (Tag.IsValid())
+		{
+			Bits.Add(FindOrAddBit(Tag));
+		}
+	}
+	if (Bits.IsEmpty())
+	{
+		return Query;
+	}
+
+	Query.Mask.SetNumZeroed(WordsPerId);
+	for (const int32 Bit : Bits)
+	{
+		Query.Mask[Bit / 64] |= uint64(1) << (Bit % 64);
+	}
+	return Query;
+}
+
+bool FLevelSelectorTagIndex::Matches(int32 Id, const FQuery& Query) const
+{
+	if (Query.IsEmpty())
+	{
+		return true;
+	}
+	if (Id < 0 || Id >= NumIds)
+	{
+		return false;
+	}
+
+	// Rows only ever grow, a query compiled before a new bit was handed out simply has no words for it.
+	const uint64* Row = Words.GetData() + Id * WordsPerId;
+	const uint64* Mask = Query.Mask.GetData();
+	const int32 NumWords = FMath::Min(Query.Mask.Num(), WordsPerId);
+	if (Query.Match == ELevelSelectorTagMatch::All)
+	{
+		for (int32 Word = 0; Word < NumWords; ++Word)
+		{
+			if ((Row[Word] & Mask[Word]) != Mask[Word])
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	for (int32 Word = 0; Word < NumWords; ++Word)
+	{
+		if (Row[Word] & Mask[Word])
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+int32 FLevelSelectorTagIndex::FindOrAddBit(const FGameplayTag& Tag)
+{
+	if (const int32* ExistingBit = BitsByTag.Find(Tag))
+	{
+		return *ExistingBit;
+	}
+
+	const int32 Bit = BitsByTag.Add(Tag, BitsByTag.Num());
+	if (Bit / 64 >= WordsPerId)
+	{
+		// Doubling keeps the number of row re-layouts logarithmic in the number of tags.
+		SetWordsPerId(FMath::Max(Bit / 64 + 1, WordsPerId * 2));
+	}
+	return Bit;
+}
+
+void FLevelSelectorTagIndex::SetWordsPerId(int32 NewWordsPerId)
+{
+	TArray<uint64> NewWords;
+	NewWords.SetNumZeroed(NumIds * NewWordsPerId);
+	for (int32 Id = 0; Id < NumIds; ++Id)
+	{
+		FMemory::Memcpy(NewWords.GetData() + Id * NewWordsPerId, Words.GetData() + Id * WordsPerId, WordsPerId * sizeof(uint64));
+	}
+	Words = MoveTemp(NewWords);
+	WordsPerId = NewWordsPerId;
+}
@@ -0,0 +1,155 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "LevelSelectorTextStream.h"
+#include "HAL/FileManager.h"
+
+namespace LevelSelectorTextStream
+{
+	static constexpr int32 BufferSize = 64 * 1024;
+}
+
+#pragma region Reader
+FLevelSelectorLineReader::FLevelSelectorLineReader(const FString& Filename)
+	: Archive(IFileManager::Get().CreateFileReader(*Filename, FILEREAD_Silent))
+{
+	Buffer.SetNumUninitialized(LevelSelectorTextStream::BufferSize);
+}
+
+FLevelSelectorLineReader::~FLevelSelectorLineReader() = default;
+
+bool FLevelSelectorLineReader::FillBuffer()
+{
+	const int64 Remaining = Archive->TotalSize() - Archive->Tell();
+	BufferPos = 0;
+	BufferEnd = static_cast<int32>(FMath::Min<int64>(Remaining, Buffer.Num()));
+	if (BufferEnd <= 0)
+	{
+		return false;
+	}
+	Archive->Serialize(Buffer.GetData(), BufferEnd);
+	if (Archive->IsError())
+	{
+		BufferEnd = 0;
+		return false;
+	}
+
+	if (bAtStart)
+	{
+		bAtStart = false;
+		if (BufferEnd >= 3 && Buffer[0] == 0xEF && Buffer[1] == 0xBB && Buffer[2] == 0xBF)
+		{
+			BufferPos = 3;
+		}
+	}
+	return true;
+}
+
+bool FLevelSelectorLineReader::ReadLine(FString& OutLine)
+{
+	OutLine.Reset();
+	if (!Archive.IsValid())
+	{
+		return false;
+	}
+
+	LineBytes.Reset();
+	bool bReadAnything = false;
+	for (;;)
+	{
+		if (BufferPos >= BufferEnd && !FillBuffer())
+		{
+			break;
+		}
+		bReadAnything = true;
+
+		const uint8* Start = Buffer.GetData() + BufferPos;
+		const uint8* NewLine = static_cast<const uint8*>(FMemory::Memchr(Start, '\n', BufferEnd - BufferPos));
+		const int32 Count = NewLine ? static_cast<int32>(NewLine - Start) : BufferEnd - BufferPos;
+		LineBytes.Append(Start, Count);
+		BufferPos += Count;
+		if (NewLine)
+		{
+			++BufferPos;
+			break;
+		}
+	}
+
+	if (!bReadAnything)
+	{
+		return false;
+	}
+	if (LineBytes.Num() > 0 && LineBytes.Last() == '\r')
+	{
+		LineBytes.Pop(false);
+	}
+	if (LineBytes.Num() > 0)
+	{
+		const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(LineBytes.GetData()), LineBytes.Num());
+		OutLine.AppendChars(Converted.Get(), Converted.Length());
+	}
+	return true;
+}
+#pragma endregion
+
+#pragma region Writer
+FLevelSelectorLineWriter::FLevelSelectorLineWriter(const FString& Filename)
+	: Archive(IFileManager::Get().CreateFileWriter(*Filename, FILEWRITE_Silent))
+{
+	Buffer.Reserve(LevelSelectorTextStream::BufferSize);
+}
+
+FLevelSelectorLineWriter::~FLevelSelectorLineWriter()
+{
+	Close();
+}
+
+void FLevelSelectorLineWriter::Write(FStringView Text)
+{
+	if (!Archive.IsValid() || Text.IsEmpty())
+	{
+		return;
+	}
+
+	const FTCHARToUTF8 Converted(Text.GetData(), Text.Len());
+	Buffer.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+	if (Buffer.Num() >= LevelSelectorTextStream::BufferSize)
+	{
+		FlushBuffer();
+	}
+}
+
+void FLevelSelectorLineWriter::WriteLine(FStringView Line)
+{
+	Write(Line);
+	Write(LINE_TERMINATOR);
+}
+
+void FLevelSelectorLineWriter::FlushBuffer()
+{
+	if (Buffer.Num() > 0)
+	{
+		Archive->Serialize(Buffer.GetData(), Buffer.Num());
+		bError |= Archive->IsError();
+		Buffer.Reset();
+	}
+}
+
+bool FLevelSelectorLineWriter::Close()
+{
+	if (!Archive.IsValid())
+	{
+		return false;
+	}
+
+	FlushBuffer();
+	bError |= !Archive->Close();
+	Archive.Reset();
+	return !bError;
+}
+#pragma endregion
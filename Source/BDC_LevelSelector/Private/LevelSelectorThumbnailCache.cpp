@@ -0,0 +1,353 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "LevelSelectorThumbnailCache.h"
+#include "BDC_LevelSelector.h"
+#include "BDC_LevelSelectorUserSettings.h"
+#include "HAL/FileManager.h"
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include "ImageUtils.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ObjectThumbnail.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+#include "ObjectTools.h"
+#include "Brushes/SlateDynamicImageBrush.h"
+#include "UObject/Package.h"
+
+namespace LevelSelectorThumbnailCache
+{
+	/** Decodes running at once, the rest waits in the request queue. */
+	static constexpr int32 MaxDecodesInFlight = 4;
+	/** Requests beyond this are dropped oldest first, their rows have long been scrolled away. */
+	static constexpr int32 MaxPendingRequests = 64;
+	/** Upper bound of cached brushes, the memory budget is usually reached well before. */
+	static constexpr int32 MaxEntries = 4096;
+
+	/** Loaded on the game thread in Initialize, workers must not load modules. */
+	static IImageWrapperModule* ImageWrapperModule = nullptr;
+}
+
+#pragma region Lifecycle
+void FLevelSelectorThumbnailCache::Initialize()
+{
+	if (bInitialized)
+	{
+		return;
+	}
+	bInitialized = true;
+
+	LevelSelectorThumbnailCache::ImageWrapperModule = &FModuleManager::LoadModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper"));
+	Entries.Empty(LevelSelectorThumbnailCache::MaxEntries);
+	IFileManager::Get().MakeDirectory(*GetThumbnailDirectory(), true);
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FLevelSelectorThumbnailCache::OnTick), 0.0f);
+	UPackage::PackageSavedWithContextEvent.AddSP(this, &FLevelSelectorThumbnailCache::OnPackageSaved);
+}
+
+void FLevelSelectorThumbnailCache::Shutdown()
+{
+	if (!bInitialized)
+	{
+		return;
+	}
+	bInitialized = false;
+
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+	UPackage::PackageSavedWithContextEvent.RemoveAll(this);
+
+	UE::Tasks::Wait(DecodeTasks);
+	DecodeTasks.Reset();
+	PendingRequests.Reset();
+	InFlight.Reset();
+	Entries.Empty(LevelSelectorThumbnailCache::MaxEntries);
+	TotalBytes = 0;
+}
+#pragma endregion
+
+#pragma region Requests
+const FSlateBrush* FLevelSelectorThumbnailCache::GetThumbnail(FName PackageName)
+{
+	if (const FEntry* Entry = Entries.FindAndTouch(PackageName))
+	{
+		return Entry->Brush.Get();
+	}
+
+	if (!bInitialized || GetMemoryBudgetBytes() <= 0 || MissingThumbnails.Contains(PackageName) || InFlight.Contains(PackageName))
+	{
+		return nullptr;
+	}
+
+	PendingRequests.Remove(PackageName);
+	PendingRequests.Add(PackageName);
+	if (PendingRequests.Num() > LevelSelectorThumbnailCache::MaxPendingRequests)
+	{
+		PendingRequests.RemoveAt(0, PendingRequests.Num() - LevelSelectorThumbnailCache::MaxPendingRequests);
+	}
+	return nullptr;
+}
+
+void FLevelSelectorThumbnailCache::StoreCapture(FName PackageName, TArray<FColor>&& Pixels, FIntPoint Size)
+{
+	if (!bInitialized || Pixels.Num() != Size.X * Size.Y || Pixels.IsEmpty())
+	{
+		return;
+	}
+
+	MissingThumbnails.Remove(PackageName);
+	PendingRequests.Remove(PackageName);
+	InFlight.Add(PackageName);
+
+	const FString CaptureFilename = GetThumbnailBaseFilename(PackageName) + TEXT("_Capture.png");
+	DecodeTasks.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION,
+		[PackageName, Pixels = MoveTemp(Pixels), Size, CaptureFilename]() mutable
+		{
+			// The back buffer alpha is undefined, thumbnails are always opaque.
+			for (FColor& Pixel : Pixels)
+			{
+				Pixel.A = 255;
+			}
+
+			FDecoded Decoded;
+			Decoded.PackageName = PackageName;
+			ScaleAndStore(Pixels, Size, CaptureFilename);
+			ToBrushPixels(Pixels, Size, Decoded);
+			return Decoded;
+		},
+		UE::Tasks::ETaskPriority::BackgroundNormal));
+}
+
+void FLevelSelectorThumbnailCache::OnPackageSaved(const FString& PackageFilename, UPackage* Package, FObjectPostSaveContext ObjectSaveContext)
+{
+	if (Package)
+	{
+		MissingThumbnails.Remove(Package->GetFName());
+	}
+}
+#pragma endregion
+
+#pragma region Decoding
+bool FLevelSelectorThumbnailCache::OnTick(float DeltaTime)
+{
+	for (int32 TaskIndex = DecodeTasks.Num() - 1; TaskIndex >= 0; --TaskIndex)
+	{
+		if (DecodeTasks[TaskIndex].IsCompleted())
+		{
+			AddDecoded(DecodeTasks[TaskIndex].GetResult());
+			DecodeTasks.RemoveAtSwap(TaskIndex);
+		}
+	}
+
+	DispatchRequests();
+	return true;
+}
+
+void FLevelSelectorThumbnailCache::DispatchRequests()
+{
+	while (DecodeTasks.Num() < LevelSelectorThumbnailCache::MaxDecodesInFlight && !PendingRequests.IsEmpty())
+	{
+		// Newest first, that is the row the user is looking at.
+		const FName PackageName = PendingRequests.Pop();
+		const FString PackageNameString = PackageName.ToString();
+
+		FRequest Request;
+		Request.PackageName = PackageName;
+		if (!FPackageName::TryConvertLongPackageNameToFilename(PackageNameString, Request.MapFilename, FPackageName::GetMapPackageExtension()))
+		{
+			MissingThumbnails.Add(PackageName);
+			continue;
+		}
+		Request.WorldFullName = FName(*FString::Printf(TEXT("World %s.%s"), *PackageNameString, *FPackageName::GetShortName(PackageNameString)));
+		Request.CaptureFilename = GetThumbnailBaseFilename(PackageName) + TEXT("_Capture.png");
+		Request.CacheFilename = GetThumbnailBaseFilename(PackageName) + TEXT(".png");
+
+		InFlight.Add(PackageName);
+		DecodeTasks.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION,
+			[Request = MoveTemp(Request)]()
+			{
+				return Decode(Request);
+			},
+			UE::Tasks::ETaskPriority::BackgroundNormal));
+	}
+}
+
+void FLevelSelectorThumbnailCache::AddDecoded(FDecoded& Decoded)
+{
+	InFlight.Remove(Decoded.PackageName);
+	if (Decoded.Pixels.IsEmpty())
+	{
+		MissingThumbnails.Add(Decoded.PackageName);
+		return;
+	}
+
+	if (const FEntry* Existing = Entries.Find(Decoded.PackageName))
+	{
+		TotalBytes -= Existing->Bytes;
+		Entries.Remove(Decoded.PackageName);
+	}
+	if (Entries.Num() >= Entries.Max())
+	{
+		TotalBytes -= Entries.RemoveLeastRecent().Bytes;
+	}
+
+	// Every version gets its own resource name, a replaced capture must not reuse the texture of the old one.
+	++Revision;
+	const FName ResourceName(*FString::Printf(TEXT("LevelSelectorThumbnail_%s_%u"), *Decoded.PackageName.ToString(), Revision));
+
+	FEntry Entry;
+	Entry.Bytes = Decoded.Pixels.Num();
+	Entry.Brush = FSlateDynamicImageBrush::CreateWithImageData(ResourceName, FVector2D(Decoded.Size), Decoded.Pixels);
+	if (!Entry.Brush.IsValid())
+	{
+		MissingThumbnails.Add(Decoded.PackageName);
+		return;
+	}
+
+	TotalBytes += Entry.Bytes;
+	Entries.Add(Decoded.PackageName, MoveTemp(Entry));
+	EvictToBudget();
+}
+
+void FLevelSelectorThumbnailCache::EvictToBudget()
+{
+	const int64 Budget = GetMemoryBudgetBytes();
+	while (TotalBytes > Budget && Entries.Num() > 0)
+	{
+		TotalBytes -= Entries.RemoveLeastRecent().Bytes;
+	}
+}
+
+int64 FLevelSelectorThumbnailCache::GetMemoryBudgetBytes() const
+{
+	return static_cast<int64>(GetDefault<UBDC_LevelSelectorUserSettings>()->ThumbnailMemoryBudgetMB) * 1024 * 1024;
+}
+
+FLevelSelectorThumbnailCache::FDecoded FLevelSelectorThumbnailCache::Decode(const FRequest& Request)
+{
+	FDecoded Decoded;
+	Decoded.PackageName = Request.PackageName;
+	if (DecodePng(Request.CaptureFilename, Decoded))
+	{
+		return Decoded;
+	}
+
+	// The stored copy of the embedded thumbnail is only valid until the map is saved again.
+	IFileManager& FileManager = IFileManager::Get();
+	const FDateTime CacheTimestamp = FileManager.GetTimeStamp(*Request.CacheFilename);
+	if (CacheTimestamp != FDateTime::MinValue() && CacheTimestamp >= FileManager.GetTimeStamp(*Request.MapFilename) && DecodePng(Request.CacheFilename, Decoded))
+	{
+		return Decoded;
+	}
+
+	ReadEmbeddedThumbnail(Request, Decoded);
+	return Decoded;
+}
+
+bool FLevelSelectorThumbnailCache::DecodePng(const FString& Filename, FDecoded& OutDecoded)
+{
+	TArray<uint8> Compressed;
+	if (!FFileHelper::LoadFileToArray(Compressed, *Filename, FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	const TSharedPtr<IImageWrapper> ImageWrapper = LevelSelectorThumbnailCache::ImageWrapperModule->CreateImageWrapper(EImageFormat::PNG);
+	TArray64<uint8> Raw;
+	if (!ImageWrapper.IsValid() || !ImageWrapper->SetCompressed(Compressed.GetData(), Compressed.Num()) || !ImageWrapper->GetRaw(ERGBFormat::BGRA, 8, Raw))
+	{
+		UE_LOG(LogBDCLevelSelector, Warning, TEXT("Ignoring unreadable level thumbnail %s."), *Filename);
+		return false;
+	}
+
+	OutDecoded.Size = FIntPoint(ImageWrapper->GetWidth(), ImageWrapper->GetHeight());
+	OutDecoded.Pixels = TArray<uint8>(Raw.GetData(), static_cast<int32>(Raw.Num()));
+	return true;
+}
+
+bool FLevelSelectorThumbnailCache::ReadEmbeddedThumbnail(const FRequest& Request, FDecoded& OutDecoded)
+{
+	// Reads the thumbnail table of the package file only, the package itself is never loaded.
+	FThumbnailMap Thumbnails;
+	TSet<FName> ObjectFullNames;
+	ObjectFullNames.Add(Request.WorldFullName);
+	if (!ThumbnailTools::LoadThumbnailsFromPackage(Request.MapFilename, ObjectFullNames, Thumbnails))
+	{
+		return false;
+	}
+
+	FObjectThumbnail* Thumbnail = Thumbnails.Find(Request.WorldFullName);
+	if (!Thumbnail || Thumbnail->IsEmpty())
+	{
+		return false;
+	}
+
+	const TArray<uint8>& ImageData = Thumbnail->GetUncompressedImageData();
+	FIntPoint Size(Thumbnail->GetImageWidth(), Thumbnail->GetImageHeight());
+	if (ImageData.Num() != Size.X * Size.Y * static_cast<int32>(sizeof(FColor)))
+	{
+		return false;
+	}
+
+	TArray<FColor> Pixels;
+	Pixels.SetNumUninitialized(Size.X * Size.Y);
+	FMemory::Memcpy(Pixels.GetData(), ImageData.GetData(), ImageData.Num());
+	ScaleAndStore(Pixels, Size, Request.CacheFilename);
+	ToBrushPixels(Pixels, Size, OutDecoded);
+	return true;
+}
+
+void FLevelSelectorThumbnailCache::ScaleAndStore(TArray<FColor>& Pixels, FIntPoint& Size, const FString& Filename)
+{
+	const int32 LongestEdge = FMath::Max(Size.X, Size.Y);
+	if (LongestEdge > ThumbnailSize)
+	{
+		const FIntPoint ScaledSize(
+			FMath::Max(1, Size.X * ThumbnailSize / LongestEdge),
+			FMath::Max(1, Size.Y * ThumbnailSize / LongestEdge));
+		TArray<FColor> Scaled;
+		Scaled.SetNumUninitialized(ScaledSize.X * ScaledSize.Y);
+		FImageUtils::ImageResize(Size.X, Size.Y, Pixels, ScaledSize.X, ScaledSize.Y, Scaled, false);
+		Pixels = MoveTemp(Scaled);
+		Size = ScaledSize;
+	}
+
+	const TSharedPtr<IImageWrapper> ImageWrapper = LevelSelectorThumbnailCache::ImageWrapperModule->CreateImageWrapper(EImageFormat::PNG);
+	if (ImageWrapper.IsValid() && ImageWrapper->SetRaw(Pixels.GetData(), Pixels.Num() * sizeof(FColor), Size.X, Size.Y, ERGBFormat::BGRA, 8))
+	{
+		const TArray64<uint8>& Compressed = ImageWrapper->GetCompressed();
+		if (!FFileHelper::SaveArrayToFile(Compressed, *Filename))
+		{
+			UE_LOG(LogBDCLevelSelector, Warning, TEXT("Could not write level thumbnail %s."), *Filename);
+		}
+	}
+}
+
+void FLevelSelectorThumbnailCache::ToBrushPixels(const TArray<FColor>& Pixels, FIntPoint Size, FDecoded& OutDecoded)
+{
+	OutDecoded.Size = Size;
+	OutDecoded.Pixels.SetNumUninitialized(Pixels.Num() * sizeof(FColor));
+	FMemory::Memcpy(OutDecoded.Pixels.GetData(), Pixels.GetData(), OutDecoded.Pixels.Num());
+}
+#pragma endregion
+
+#pragma region Disk Cache
+FString FLevelSelectorThumbnailCache::GetThumbnailDirectory()
+{
+	return FPaths::ProjectSavedDir() / TEXT("LevelSelector") / TEXT("Thumbnails");
+}
+
+FString FLevelSelectorThumbnailCache::GetThumbnailBaseFilename(FName PackageName)
+{
+	// Package paths may be longer than the file system allows for a name, a hash of it is not.
+	const FString PackageNameString = PackageName.ToString();
+	const uint32 Hash = FCrc::StrCrc32(*PackageNameString.ToLower());
+	return GetThumbnailDirectory() / FString::Printf(TEXT("%s_%08x"), *FPackageName::GetShortName(PackageNameString), Hash);
+}
+#pragma endregion
@@ -7,24 +7,44 @@
 * and are used with permission.
 */
 #include "SLevelSelectorCameraOverlay.h"
+#include "BDC_LevelSelector.h"
 #include "BDC_LevelSelectorSettings.h"
+#include "BDC_LevelSelectorUserSettings.h"
+#include "LevelSelectorCameraFavoriteStore.h"
+#include "LevelSelectorCameraFavoriteTransfer.h"
+#include "LevelSelectorCameraSpatialIndex.h"
+#include "LevelSelectorThumbnailCache.h"
+#include "LevelSelectorStats.h"
 #include "Widgets/Input/SEditableTextBox.h"
 #include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SNumericEntryBox.h"
 #include "Widgets/Text/STextBlock.h"
 #include "Widgets/Layout/SBox.h"
-#include "Widgets/Layout/SScrollBox.h"
+#include "Widgets/Views/STableRow.h"
 #include "Widgets/Images/SImage.h"
+#include "Widgets/SInvalidationPanel.h"
+#include "HAL/IConsoleManager.h"
 #include "LevelEditorViewport.h"
 #include "LevelEditor.h"
 #include "Engine/World.h"
 #include "Editor/EditorEngine.h"
 #include "Editor.h"
 #include "Misc/MessageDialog.h"
+#include "Misc/Paths.h"
+#include "DesktopPlatformModule.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Framework/MultiBox/MultiBoxBuilder.h"
+#include "Selection.h"
 #include "SLevelViewport.h"
 #include "Brushes/SlateRoundedBoxBrush.h"
 
 #define LOCTEXT_NAMESPACE "SLevelSelectorCameraOverlay"
 
+static TAutoConsoleVariable<bool> CVarLevelSelectorOverlayCache(
+	TEXT("LevelSelector.Overlay.Cache"),
+	true,
+	TEXT("Caches the camera favorites overlay in an invalidation panel. Applies to overlays created afterwards, turn it off to compare the Slate cost."));
+
 void SLevelSelectorCameraOverlay::Construct(const FArguments& InArgs)
 {
 	bIsCollapsed = false;
@@ -33,107 +53,160 @@ void SLevelSelectorCameraOverlay::Construct(const FArguments& InArgs)
 
 	ChildSlot
 	[
-		SNew(SOverlay)
-		+ SOverlay::Slot()
-		.HAlign(HAlign_Right)
-		.VAlign(VAlign_Top)
-		.Padding(10.0f)
+		SNew(SInvalidationPanel)
+		.CanCache(CVarLevelSelectorOverlayCache.GetValueOnGameThread())
 		[
-			SNew(SBorder)
-			.BorderImage(BackgroundBrush.Get())
-			.Padding(5.0f)
+			SNew(SOverlay)
+			+ SOverlay::Slot()
+			.HAlign(HAlign_Right)
+			.VAlign(VAlign_Top)
+			.Padding(10.0f)
 			[
-				SNew(SVerticalBox)
-				
-				+ SVerticalBox::Slot()
-				.MaxHeight(28)
+				SNew(SBorder)
+				.BorderImage(BackgroundBrush.Get())
+				.Padding(5.0f)
 				[
-					SNew(SHorizontalBox)
-					+ SHorizontalBox::Slot()
-					.AutoWidth()
-					.VAlign(VAlign_Center)
-					.Padding(5, 0, 5, 0)
-					[
-						SNew(STextBlock)
-						.Text(LOCTEXT("FavLabel", "Camera Favorites"))
-						.Font(FAppStyle::GetFontStyle("NormalFontBold"))
-						.ColorAndOpacity(FSlateColor::UseSubduedForeground())
-					]
+					SNew(SVerticalBox)
 					
-					+ SHorizontalBox::Slot()
-					.FillWidth(1.0f)
-
-					+ SHorizontalBox::Slot()
-					.AutoWidth()
-					.VAlign(VAlign_Center)
-					.Padding(0)
-					[
-						SNew(SButton)
-						.ButtonStyle(FAppStyle::Get(), "HoverHintOnly")
-						.OnClicked(this, &SLevelSelectorCameraOverlay::OnToggleCollapse)
-						.ContentPadding(0)
-						[
-							SNew(SImage)
-							.Image_Lambda([this]()
-							{
-								const FSlateBrush* IconBrush = nullptr;
-								GetCollapseIcon(IconBrush);
-								return IconBrush;
-							})
-							.ColorAndOpacity(FSlateColor::UseForeground())
-						]
-					]
-				]
-
-				+ SVerticalBox::Slot()
-				.AutoHeight()
-				[
-					SNew(SBox)
-					.Visibility_Lambda([this]()
-					{
-						EVisibility Vis = EVisibility::Visible;
-						GetContentVisibility(Vis);
-						return Vis;
-					})
+					+ SVerticalBox::Slot()
+					.MaxHeight(28)
 					[
 						SNew(SHorizontalBox)
 						+ SHorizontalBox::Slot()
 						.AutoWidth()
 						.VAlign(VAlign_Center)
-						.Padding(0, 0, 2, 0)
+						.Padding(5, 0, 5, 0)
 						[
-							SNew(SBox)
-							.WidthOverride(100.0f)
-							[
-								SAssignNew(NameInputBox, SEditableTextBox)
-								.HintText(LOCTEXT("NameHint", "New Name..."))
-							]
+							SNew(STextBlock)
+							.Text(LOCTEXT("FavLabel", "Camera Favorites"))
+							.Font(FAppStyle::GetFontStyle("NormalFontBold"))
+							.ColorAndOpacity(FSlateColor::UseSubduedForeground())
 						]
+						
+						+ SHorizontalBox::Slot()
+						.FillWidth(1.0f)
+
 						+ SHorizontalBox::Slot()
 						.AutoWidth()
 						.VAlign(VAlign_Center)
-						.Padding(0, 0, 5, 0)
+						.Padding(0)
 						[
 							SNew(SButton)
-							.Text(LOCTEXT("AddBtn", "+"))
-							.OnClicked(this, &SLevelSelectorCameraOverlay::OnAddClicked)
-							.ToolTipText(LOCTEXT("AddTooltip", "Add current view to favorites"))
-							.ContentPadding(FMargin(5, 0))
+							.ButtonStyle(FAppStyle::Get(), "HoverHintOnly")
+							.OnClicked(this, &SLevelSelectorCameraOverlay::OnToggleCollapse)
+							.ContentPadding(0)
+							[
+								SAssignNew(CollapseImage, SImage)
+								.ColorAndOpacity(FSlateColor::UseForeground())
+							]
 						]
-						+ SHorizontalBox::Slot()
-						.AutoWidth()
-						.VAlign(VAlign_Center)
+					]
+
+					+ SVerticalBox::Slot()
+					.AutoHeight()
+					[
+						SAssignNew(ContentBox, SBox)
 						[
-							SNew(SBox)
-							.WidthOverride(140.0f)
+							SNew(SHorizontalBox)
+							+ SHorizontalBox::Slot()
+							.AutoWidth()
+							.VAlign(VAlign_Center)
+							.Padding(0, 0, 2, 0)
+							[
+								SNew(SBox)
+								.WidthOverride(100.0f)
+								[
+									SAssignNew(NameInputBox, SEditableTextBox)
+									.HintText(LOCTEXT("NameHint", "New Name..."))
+								]
+							]
+							+ SHorizontalBox::Slot()
+							.AutoWidth()
+							.VAlign(VAlign_Center)
+							.Padding(0, 0, 5, 0)
+							[
+								SNew(SButton)
+								.Text(LOCTEXT("AddBtn", "+"))
+								.OnClicked(this, &SLevelSelectorCameraOverlay::OnAddClicked)
+								.ToolTipText(LOCTEXT("AddTooltip", "Add current view to favorites"))
+								.ContentPadding(FMargin(5, 0))
+							]
+							+ SHorizontalBox::Slot()
+							.AutoWidth()
+							.VAlign(VAlign_Center)
+							[
+								SNew(SBox)
+								.WidthOverride(140.0f)
+								[
+									SAssignNew(FavComboButton, SComboButton)
+									.OnGetMenuContent(this, &SLevelSelectorCameraOverlay::OnGetMenuContent)
+									.ButtonContent()
+									[
+										SNew(STextBlock)
+										.Text(LOCTEXT("SelectFav", "Select..."))
+									]
+								]
+							]
+							+ SHorizontalBox::Slot()
+							.AutoWidth()
+							.VAlign(VAlign_Center)
+							.Padding(5, 0, 0, 0)
+							[
+								SAssignNew(NavigationBox, SHorizontalBox)
+								+ SHorizontalBox::Slot()
+								.AutoWidth()
+								[
+									SNew(SButton)
+									.ButtonStyle(FAppStyle::Get(), "SimpleButton")
+									.OnClicked(this, &SLevelSelectorCameraOverlay::OnStepClicked, false)
+									.ToolTipText(LOCTEXT("PrevTooltip", "Previous favorite by distance"))
+									[
+										SNew(STextBlock)
+										.Text(FText::FromString(TEXT("\xF053")))
+										.Font(FAppStyle::GetFontStyle("FontAwesome.10"))
+									]
+								]
+								+ SHorizontalBox::Slot()
+								.AutoWidth()
+								[
+									SNew(SButton)
+									.ButtonStyle(FAppStyle::Get(), "SimpleButton")
+									.OnClicked(this, &SLevelSelectorCameraOverlay::OnNearestClicked)
+									.ToolTipText(LOCTEXT("NearestTooltip", "Jump to the nearest favorite"))
+									[
+										SNew(STextBlock)
+										.Text(FText::FromString(TEXT("\xF05B")))
+										.Font(FAppStyle::GetFontStyle("FontAwesome.10"))
+									]
+								]
+								+ SHorizontalBox::Slot()
+								.AutoWidth()
+								[
+									SNew(SButton)
+									.ButtonStyle(FAppStyle::Get(), "SimpleButton")
+									.OnClicked(this, &SLevelSelectorCameraOverlay::OnStepClicked, true)
+									.ToolTipText(LOCTEXT("NextTooltip", "Next favorite by distance"))
+									[
+										SNew(STextBlock)
+										.Text(FText::FromString(TEXT("\xF054")))
+										.Font(FAppStyle::GetFontStyle("FontAwesome.10"))
+									]
+								]
+							]
+							+ SHorizontalBox::Slot()
+							.AutoWidth()
+							.VAlign(VAlign_Center)
 							[
-								SAssignNew(FavComboButton, SComboButton)
-								.OnGetMenuContent(this, &SLevelSelectorCameraOverlay::OnGetMenuContent)
-								.IsEnabled(this, &SLevelSelectorCameraOverlay::IsFavListEnabled)
+								SNew(SComboButton)
+								.ComboButtonStyle(FAppStyle::Get(), "SimpleComboButton")
+								.HasDownArrow(false)
+								.OnGetMenuContent(this, &SLevelSelectorCameraOverlay::OnGetBulkMenuContent)
+								.ToolTipText(LOCTEXT("BulkTooltip", "Add, import or export many favorites at once"))
 								.ButtonContent()
 								[
 									SNew(STextBlock)
-									.Text(LOCTEXT("SelectFav", "Select..."))
+									.Text(FText::FromString(TEXT("\xF0C9")))
+									.Font(FAppStyle::GetFontStyle("FontAwesome.10"))
 								]
 							]
 						]
@@ -142,58 +215,102 @@ void SLevelSelectorCameraOverlay::Construct(const FArguments& InArgs)
 			]
 		]
 	];
+
+	UpdateCollapseState();
+	RefreshFavoriteState();
+
+	FLevelEditorModule& LevelEditorModule = FModuleManager::LoadModuleChecked<FLevelEditorModule>("LevelEditor");
+	LevelEditorModule.OnMapChanged().AddSP(this, &SLevelSelectorCameraOverlay::HandleMapChanged);
+	GetSettings()->OnCameraFavoritesChanged().AddSP(this, &SLevelSelectorCameraOverlay::HandleCameraFavoritesChanged);
 }
 
-UBDC_LevelSelectorSettings* SLevelSelectorCameraOverlay::GetSettings() const
+SLevelSelectorCameraOverlay::~SLevelSelectorCameraOverlay()
 {
-	return GetMutableDefault<UBDC_LevelSelectorSettings>();
+	if (FLevelEditorModule* LevelEditorModule = FModuleManager::GetModulePtr<FLevelEditorModule>("LevelEditor"))
+	{
+		LevelEditorModule->OnMapChanged().RemoveAll(this);
+	}
+	if (UObjectInitialized())
+	{
+		GetSettings()->OnCameraFavoritesChanged().RemoveAll(this);
+	}
 }
 
-void SLevelSelectorCameraOverlay::GetCurrentLevelSoftPtr(TSoftObjectPtr<UWorld>& OutLevelPtr) const
+int32 SLevelSelectorCameraOverlay::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+	FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
 {
-	OutLevelPtr = nullptr;
-	if (GEditor && !GEditor->GetWorldContexts().IsEmpty())
+	LEVELSELECTOR_SCOPE_CYCLE_COUNTER(STAT_LevelSelector_OverlayPaint);
+	return SCompoundWidget::OnPaint(Args, AllottedGeometry, MyCullingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled);
+}
+
+void SLevelSelectorCameraOverlay::HandleMapChanged(UWorld* World, EMapChangeType MapChangeType)
+{
+	// The editor world still is the old one while it is torn down, the load or new map that follows refreshes.
+	if (MapChangeType != EMapChangeType::TearDownWorld)
 	{
-		if (UWorld* World = GEditor->GetEditorWorldContext().World())
-		{
-			OutLevelPtr = World;
-		}
+		RefreshFavoriteState();
 	}
 }
 
-bool SLevelSelectorCameraOverlay::IsFavListEnabled() const
+void SLevelSelectorCameraOverlay::HandleCameraFavoritesChanged(const FSoftObjectPath& LevelPath)
 {
-	UBDC_LevelSelectorSettings* Settings = GetSettings();
+	if (!LevelPath.IsValid() || LevelPath == CurrentLevelPath)
+	{
+		RefreshFavoriteState();
+	}
+}
+
+void SLevelSelectorCameraOverlay::RefreshFavoriteState()
+{
+	LEVELSELECTOR_SCOPE_CYCLE_COUNTER(STAT_LevelSelector_OverlayRefresh);
+	INC_DWORD_STAT(STAT_LevelSelector_OverlayRefreshes);
+
 	TSoftObjectPtr<UWorld> CurrentLevel;
 	GetCurrentLevelSoftPtr(CurrentLevel);
+	CurrentLevelPath = CurrentLevel.ToSoftObjectPath();
 
-	if (CurrentLevel.IsNull()) return false;
-	if (!Settings->HoldFavorites.Contains(CurrentLevel)) return false;
+	const FCameraFavorite* Favorites = CurrentLevelPath.IsValid() ? GetSettings()->FindCameraFavorites(CurrentLevelPath) : nullptr;
+	bHasFavorites = Favorites && Favorites->HoldFavorites.Num() > 0;
+	bIsStepping = false;
+	bMenuItemsDirty = true;
+	if (FavComboButton.IsValid())
+	{
+		FavComboButton->SetEnabled(bHasFavorites);
+	}
+	if (NavigationBox.IsValid())
+	{
+		NavigationBox->SetEnabled(bHasFavorites);
+	}
+}
 
-	return Settings->HoldFavorites[CurrentLevel].HoldFavorites.Num() > 0;
+void SLevelSelectorCameraOverlay::UpdateCollapseState()
+{
+	CollapseImage->SetImage(FAppStyle::GetBrush(bIsCollapsed ? "TreeArrow_Collapsed" : "TreeArrow_Expanded"));
+	ContentBox->SetVisibility(bIsCollapsed ? EVisibility::Collapsed : EVisibility::Visible);
 }
 
-FReply SLevelSelectorCameraOverlay::OnToggleCollapse()
+UBDC_LevelSelectorSettings* SLevelSelectorCameraOverlay::GetSettings() const
 {
-	bIsCollapsed = !bIsCollapsed;
-	return FReply::Handled();
+	return GetMutableDefault<UBDC_LevelSelectorSettings>();
 }
 
-void SLevelSelectorCameraOverlay::GetCollapseIcon(const FSlateBrush*& OutBrush) const
+void SLevelSelectorCameraOverlay::GetCurrentLevelSoftPtr(TSoftObjectPtr<UWorld>& OutLevelPtr) const
 {
-	if (bIsCollapsed)
-	{
-		OutBrush = FAppStyle::GetBrush("TreeArrow_Collapsed");
-	}
-	else
+	OutLevelPtr = nullptr;
+	if (GEditor && !GEditor->GetWorldContexts().IsEmpty())
 	{
-		OutBrush = FAppStyle::GetBrush("TreeArrow_Expanded");
+		if (UWorld* World = GEditor->GetEditorWorldContext().World())
+		{
+			OutLevelPtr = World;
+		}
 	}
 }
 
-void SLevelSelectorCameraOverlay::GetContentVisibility(EVisibility& OutVisibility) const
+FReply SLevelSelectorCameraOverlay::OnToggleCollapse()
 {
-	OutVisibility = bIsCollapsed ? EVisibility::Collapsed : EVisibility::Visible;
+	bIsCollapsed = !bIsCollapsed;
+	UpdateCollapseState();
+	return FReply::Handled();
 }
 
 FReply SLevelSelectorCameraOverlay::OnAddClicked()
@@ -206,9 +323,16 @@ FReply SLevelSelectorCameraOverlay::OnAddClicked()
 		FMessageDialog::Open(EAppMsgType::Ok, LOCTEXT("ShortNameErr", "Name must be longer than 4 characters."));
 		return FReply::Handled();
 	}
+	if (!FLevelSelectorCameraFavoriteStore::IsValidFavoriteName(InputText.ToString()))
+	{
+		FMessageDialog::Open(EAppMsgType::Ok, FText::Format(LOCTEXT("LongNameErr", "Name must be shorter than {0} characters and fit on one line."), FText::AsNumber(NAME_SIZE)));
+		return FReply::Handled();
+	}
 
 	FTransform CameraTransform = FTransform::Identity;
 	bool bFoundViewport = false;
+	TArray<FColor> CapturePixels;
+	FIntPoint CaptureSize = FIntPoint::ZeroValue;
 
 	if (FModuleManager::Get().IsModuleLoaded("LevelEditor"))
 	{
@@ -221,6 +345,12 @@ FReply SLevelSelectorCameraOverlay::OnAddClicked()
 			const FLevelEditorViewportClient& Client = ActiveViewport->GetLevelViewportClient();
 			CameraTransform = FTransform(Client.GetViewRotation(), Client.GetViewLocation());
 			bFoundViewport = true;
+
+			// The view of the favorite doubles as the level's thumbnail in the dropdown.
+			if (Client.Viewport && Client.Viewport->ReadPixels(CapturePixels))
+			{
+				CaptureSize = Client.Viewport->GetSizeXY();
+			}
 		}
 	}
 
@@ -233,15 +363,14 @@ FReply SLevelSelectorCameraOverlay::OnAddClicked()
 	if (CurrentLevel.IsNull()) return FReply::Handled();
 
 	const FName NewName(*InputText.ToString());
+	Settings->AddCameraFavorite(CurrentLevel.ToSoftObjectPath(), NewName, CameraTransform);
 
-	if (!Settings->HoldFavorites.Contains(CurrentLevel))
+	const FBDC_LevelSelectorModule* Module = FModuleManager::GetModulePtr<FBDC_LevelSelectorModule>(TEXT("BDC_LevelSelector"));
+	if (Module && Module->GetThumbnailCache().IsValid() && !CapturePixels.IsEmpty())
 	{
-		Settings->HoldFavorites.Add(CurrentLevel, FCameraFavorite());
+		Module->GetThumbnailCache()->StoreCapture(CurrentLevel.ToSoftObjectPath().GetLongPackageFName(), MoveTemp(CapturePixels), CaptureSize);
 	}
 
-	Settings->HoldFavorites[CurrentLevel].HoldFavorites.Add(NewName, CameraTransform);
-	Settings->SaveToProjectDefaultConfig();
-
 	NameInputBox->SetText(FText::GetEmpty());
 
 	return FReply::Handled();
@@ -249,107 +378,595 @@ FReply SLevelSelectorCameraOverlay::OnAddClicked()
 
 TSharedRef<SWidget> SLevelSelectorCameraOverlay::OnGetMenuContent()
 {
-	TSharedRef<SVerticalBox> ListContainer = SNew(SVerticalBox);
+	LEVELSELECTOR_SCOPE_CYCLE_COUNTER(STAT_LevelSelector_OverlayMenu);
 
-	UBDC_LevelSelectorSettings* Settings = GetSettings();
-	TSoftObjectPtr<UWorld> CurrentLevel;
-	GetCurrentLevelSoftPtr(CurrentLevel);
-
-	if (!CurrentLevel.IsNull() && Settings->HoldFavorites.Contains(CurrentLevel))
+	if (bMenuItemsDirty)
 	{
-		for (FCameraFavorite& Favs = Settings->HoldFavorites[CurrentLevel]; const auto& Elem : Favs.HoldFavorites)
-		{
-			const FName ItemName = Elem.Key;
-			const FTransform ItemTrans = Elem.Value;
+		RebuildMenuItems();
+	}
+	SortMenuItems();
+	MenuSearchText = FText::GetEmpty();
+	MenuFoldedQuery.Reset();
+	FilterMenuItems();
 
-			ListContainer->AddSlot()
-			             .AutoHeight()
-			             .Padding(2.0f)
+	// The list only creates rows for the favorites in view, so opening costs the same for ten or thousands of them.
+	TSharedRef<SWidget> MenuContent = SNew(SBox)
+		.WidthOverride(220.0f)
+		[
+			SNew(SVerticalBox)
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(2.0f)
 			[
-				SNew(SBorder)
-				.BorderImage(FAppStyle::GetBrush("NoBorder"))
+				SAssignNew(MenuSearchBox, SEditableTextBox)
+				.HintText(LOCTEXT("SearchFavHint", "Search favorites..."))
+				.OnTextChanged(this, &SLevelSelectorCameraOverlay::OnMenuSearchChanged)
+				.OnTextCommitted(this, &SLevelSelectorCameraOverlay::OnMenuSearchCommitted)
+				.OnKeyDownHandler(this, &SLevelSelectorCameraOverlay::OnMenuSearchKeyDown)
+			]
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			[
+				SNew(SBox)
+				.MaxDesiredHeight(300.0f)
 				[
-					SNew(SHorizontalBox)
-					+ SHorizontalBox::Slot()
-					.FillWidth(1.0f)
-					[
-						SNew(SButton)
-						.ButtonStyle(FAppStyle::Get(), "Menu.Button")
-						.OnClicked(this, &SLevelSelectorCameraOverlay::OnTeleportClicked, ItemName, ItemTrans)
-						.ContentPadding(FMargin(5.0f, 2.0f))
-						[
-							SNew(STextBlock)
-							.Text(FText::FromName(ItemName))
-							.Font(FAppStyle::GetFontStyle("NormalFont"))
-						]
-					]
-					+ SHorizontalBox::Slot()
-					.AutoWidth()
-					.Padding(2.0f, 0.0f)
-					[
-						SNew(SButton)
-						.ButtonStyle(FAppStyle::Get(), "SimpleButton")
-						.OnClicked(this, &SLevelSelectorCameraOverlay::OnEditItemClicked, ItemName)
-						.ToolTipText(LOCTEXT("EditItemTip", "Rename Favorite"))
-						[
-							SNew(STextBlock)
-							.Text(FText::FromString(TEXT("\xF040")))
-							.Font(FAppStyle::GetFontStyle("FontAwesome.10"))
-						]
-					]
-					+ SHorizontalBox::Slot()
-					.AutoWidth()
-					.Padding(2.0f, 0.0f)
-					[
-						SNew(SButton)
-						.ButtonStyle(FAppStyle::Get(), "SimpleButton")
-						.OnClicked(this, &SLevelSelectorCameraOverlay::OnDeleteItemClicked, ItemName)
-						.ToolTipText(LOCTEXT("DeleteItemTip", "Delete Favorite"))
-						[
-							SNew(STextBlock)
-							.Text(FText::FromString(TEXT("\xF014")))
-							.Font(FAppStyle::GetFontStyle("FontAwesome.10"))
-							.ColorAndOpacity(FLinearColor::Red)
-						]
-					]
+					SAssignNew(MenuListView, SListView<TSharedPtr<FLevelSelectorCameraMenuItem>>)
+					.ListItemsSource(&FilteredMenuItems)
+					.OnGenerateRow(this, &SLevelSelectorCameraOverlay::OnGenerateMenuRow)
+					.OnMouseButtonClick(this, &SLevelSelectorCameraOverlay::OnMenuItemClicked)
+					.SelectionMode(ESelectionMode::Single)
 				]
-			];
+			]
+		];
+
+	if (FilteredMenuItems.Num() > 0)
+	{
+		MenuListView->SetSelection(FilteredMenuItems[0], ESelectInfo::Direct);
+	}
+	if (FavComboButton.IsValid())
+	{
+		FavComboButton->SetMenuContentWidgetToFocus(MenuSearchBox);
+	}
+	return MenuContent;
+}
+
+void SLevelSelectorCameraOverlay::RebuildMenuItems()
+{
+	bMenuItemsDirty = false;
+	bMenuOrderValid = false;
+	bMenuUnfiltered = false;
+	MenuItems.Reset();
+	MenuItemsByName.Reset();
+	OrderedMenuItems.Reset();
+	FilteredMenuItems.Reset();
+	OutOfRadiusMenuItems.Reset();
+	MenuSearchIndex.Reset();
+
+	const FCameraFavorite* Favorites = CurrentLevelPath.IsValid() ? GetSettings()->FindCameraFavorites(CurrentLevelPath) : nullptr;
+	if (!Favorites)
+	{
+		return;
+	}
+
+	TStringBuilder<128> NameString;
+	for (const auto& Pair : Favorites->HoldFavorites)
+	{
+		TSharedPtr<FLevelSelectorCameraMenuItem> Item = MakeShared<FLevelSelectorCameraMenuItem>();
+		Item->Name = Pair.Key;
+		Item->NameText = FText::FromName(Pair.Key);
+		Item->Transform = Pair.Value;
+
+		NameString.Reset();
+		NameString << Pair.Key;
+		const FStringView Texts[] = { NameString.ToView() };
+		const int32 Id = MenuSearchIndex.Add(Texts);
+		if (MenuItems.Num() <= Id)
+		{
+			MenuItems.SetNum(Id + 1);
+		}
+		MenuItems[Id] = Item;
+		MenuItemsByName.Add(Pair.Key, Item);
+	}
+}
+
+void SLevelSelectorCameraOverlay::SortMenuItems()
+{
+	const FLevelSelectorCameraSpatialIndex* SpatialIndex = CurrentLevelPath.IsValid() ? GetSettings()->FindCameraFavoriteSpatialIndex(CurrentLevelPath) : nullptr;
+	const FLevelEditorViewportClient* Client = GetActiveViewportClient();
+	const bool bByDistance = SpatialIndex && Client;
+	const FVector Origin = bByDistance ? Client->GetViewLocation() : FVector::ZeroVector;
+	const double Radius = GetDefault<UBDC_LevelSelectorUserSettings>()->CameraFavoriteMenuRadius;
+
+	// The order only depends on the favorites, the camera and the radius, reopening the menu without moving reuses it.
+	if (bMenuOrderValid && bByDistance == bMenuOrderByDistance && Origin == MenuOrderOrigin && Radius == MenuOrderRadius)
+	{
+		return;
+	}
+	bMenuOrderValid = true;
+	bMenuOrderByDistance = bByDistance;
+	MenuOrderOrigin = Origin;
+	MenuOrderRadius = Radius;
+	bMenuUnfiltered = false;
+
+	for (const TSharedPtr<FLevelSelectorCameraMenuItem>& Item : OrderedMenuItems)
+	{
+		Item->Order = INDEX_NONE;
+		Item->Distance = -1.0;
+	}
+	for (const TSharedPtr<FLevelSelectorCameraMenuItem>& Item : OutOfRadiusMenuItems)
+	{
+		Item->Distance = -1.0;
+	}
+	OrderedMenuItems.Reset();
+	OutOfRadiusMenuItems.Reset();
+
+	// Nearest first, within the configured radius of the camera. Without a viewport the favorites keep their stored order.
+	if (bByDistance)
+	{
+		TArray<FLevelSelectorCameraSpatialIndex::FHit> Hits;
+		SpatialIndex->FindInRadius(Origin, Radius > 0.0 ? Radius : TNumericLimits<double>::Max(), Hits);
+		for (const FLevelSelectorCameraSpatialIndex::FHit& Hit : Hits)
+		{
+			if (const TSharedPtr<FLevelSelectorCameraMenuItem>* Item = MenuItemsByName.Find(Hit.Name))
+			{
+				(*Item)->Distance = Hit.Distance;
+				(*Item)->Order = OrderedMenuItems.Add(*Item);
+			}
+		}
+		return;
+	}
+
+	for (const TSharedPtr<FLevelSelectorCameraMenuItem>& Item : MenuItems)
+	{
+		Item->Order = OrderedMenuItems.Add(Item);
+	}
+}
+
+void SLevelSelectorCameraOverlay::FilterMenuItems()
+{
+	if (MenuFoldedQuery.IsEmpty())
+	{
+		if (!bMenuUnfiltered)
+		{
+			FilteredMenuItems = OrderedMenuItems;
+			bMenuUnfiltered = true;
 		}
+		return;
 	}
+	bMenuUnfiltered = false;
 
-	return SNew(SBox)
-		.MaxDesiredHeight(300.0f)
-		.WidthOverride(200.0f)
+	// Only the entries sharing the rarest trigram of the query are checked, then put back into menu order.
+	TArray<int32> Ids;
+	MenuSearchIndex.Find(MenuFoldedQuery, Ids);
+	FilteredMenuItems.Reset(Ids.Num());
+	TArray<TSharedPtr<FLevelSelectorCameraMenuItem>> OutOfRadiusMatches;
+	for (const int32 Id : Ids)
+	{
+		if (!MenuItems.IsValidIndex(Id))
+		{
+			continue;
+		}
+
+		const TSharedPtr<FLevelSelectorCameraMenuItem>& Item = MenuItems[Id];
+		if (Item->Order != INDEX_NONE)
+		{
+			FilteredMenuItems.Add(Item);
+			continue;
+		}
+
+		// The radius only limits the unfiltered menu, a search finds every favorite and lists the farther ones last.
+		if (Item->Distance < 0.0)
+		{
+			Item->Distance = FVector::Dist(MenuOrderOrigin, Item->Transform.GetLocation());
+			OutOfRadiusMenuItems.Add(Item);
+		}
+		OutOfRadiusMatches.Add(Item);
+	}
+
+	FilteredMenuItems.Sort([](const TSharedPtr<FLevelSelectorCameraMenuItem>& A, const TSharedPtr<FLevelSelectorCameraMenuItem>& B)
+	{
+		return A->Order < B->Order;
+	});
+	OutOfRadiusMatches.Sort([](const TSharedPtr<FLevelSelectorCameraMenuItem>& A, const TSharedPtr<FLevelSelectorCameraMenuItem>& B)
+	{
+		return A->Distance < B->Distance || (A->Distance == B->Distance && A->Name.LexicalLess(B->Name));
+	});
+	FilteredMenuItems.Append(OutOfRadiusMatches);
+}
+
+TSharedRef<ITableRow> SLevelSelectorCameraOverlay::OnGenerateMenuRow(TSharedPtr<FLevelSelectorCameraMenuItem> Item, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	FNumberFormattingOptions DistanceFormat;
+	DistanceFormat.MaximumFractionalDigits = 0;
+	const FText DistanceText = Item->Distance >= 0.0
+		? FText::Format(LOCTEXT("DistanceFmt", "{0} m"), FText::AsNumber(Item->Distance / 100.0, &DistanceFormat))
+		: FText::GetEmpty();
+
+	return SNew(STableRow<TSharedPtr<FLevelSelectorCameraMenuItem>>, OwnerTable)
+		.Padding(FMargin(5.0f, 2.0f))
 		[
-			SNew(SScrollBox)
-			+ SScrollBox::Slot()
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+				.Text(Item->NameText)
+				.HighlightText_Lambda([this]() { return MenuSearchText; })
+				.Font(FAppStyle::GetFontStyle("NormalFont"))
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(5.0f, 0.0f, 0.0f, 0.0f)
+			[
+				SNew(STextBlock)
+				.Text(DistanceText)
+				.Font(FAppStyle::GetFontStyle("SmallFont"))
+				.ColorAndOpacity(FSlateColor::UseSubduedForeground())
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(2.0f, 0.0f)
+			[
+				SNew(SButton)
+				.ButtonStyle(FAppStyle::Get(), "SimpleButton")
+				.OnClicked(this, &SLevelSelectorCameraOverlay::OnEditItemClicked, Item->Name)
+				.ToolTipText(LOCTEXT("EditItemTip", "Rename Favorite"))
+				[
+					SNew(STextBlock)
+					.Text(FText::FromString(TEXT("\xF040")))
+					.Font(FAppStyle::GetFontStyle("FontAwesome.10"))
+				]
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(2.0f, 0.0f)
 			[
-				ListContainer
+				SNew(SButton)
+				.ButtonStyle(FAppStyle::Get(), "SimpleButton")
+				.OnClicked(this, &SLevelSelectorCameraOverlay::OnDeleteItemClicked, Item->Name)
+				.ToolTipText(LOCTEXT("DeleteItemTip", "Delete Favorite"))
+				[
+					SNew(STextBlock)
+					.Text(FText::FromString(TEXT("\xF014")))
+					.Font(FAppStyle::GetFontStyle("FontAwesome.10"))
+					.ColorAndOpacity(FLinearColor::Red)
+				]
 			]
 		];
 }
 
+void SLevelSelectorCameraOverlay::OnMenuSearchChanged(const FText& Text)
+{
+	MenuSearchText = Text;
+	MenuFoldedQuery = FLevelSelectorSearchIndex::Fold(Text.ToString());
+	FilterMenuItems();
+	if (MenuListView.IsValid())
+	{
+		MenuListView->RequestListRefresh();
+		if (FilteredMenuItems.Num() > 0)
+		{
+			MenuListView->SetSelection(FilteredMenuItems[0], ESelectInfo::Direct);
+			MenuListView->RequestScrollIntoView(FilteredMenuItems[0]);
+		}
+	}
+}
+
+void SLevelSelectorCameraOverlay::OnMenuSearchCommitted(const FText& Text, ETextCommit::Type CommitType)
+{
+	if (CommitType != ETextCommit::OnEnter || !MenuListView.IsValid())
+	{
+		return;
+	}
+
+	const TArray<TSharedPtr<FLevelSelectorCameraMenuItem>> Selected = MenuListView->GetSelectedItems();
+	if (Selected.Num() > 0)
+	{
+		OnMenuItemClicked(Selected[0]);
+	}
+	else if (FilteredMenuItems.Num() > 0)
+	{
+		OnMenuItemClicked(FilteredMenuItems[0]);
+	}
+}
+
+FReply SLevelSelectorCameraOverlay::OnMenuSearchKeyDown(const FGeometry& MyGeometry, const FKeyEvent& KeyEvent)
+{
+	const FKey Key = KeyEvent.GetKey();
+	if ((Key != EKeys::Up && Key != EKeys::Down) || !MenuListView.IsValid() || FilteredMenuItems.IsEmpty())
+	{
+		return FReply::Unhandled();
+	}
+
+	// Arrow keys move the selection while the search field keeps the focus.
+	const TArray<TSharedPtr<FLevelSelectorCameraMenuItem>> Selected = MenuListView->GetSelectedItems();
+	const int32 Current = Selected.Num() > 0 ? FilteredMenuItems.IndexOfByKey(Selected[0]) : INDEX_NONE;
+	const int32 Next = Current == INDEX_NONE ? 0 : FMath::Clamp(Current + (Key == EKeys::Down ? 1 : -1), 0, FilteredMenuItems.Num() - 1);
+	MenuListView->SetSelection(FilteredMenuItems[Next], ESelectInfo::OnNavigation);
+	MenuListView->RequestScrollIntoView(FilteredMenuItems[Next]);
+	return FReply::Handled();
+}
+
+void SLevelSelectorCameraOverlay::OnMenuItemClicked(TSharedPtr<FLevelSelectorCameraMenuItem> Item)
+{
+	if (Item.IsValid())
+	{
+		OnTeleportClicked(Item->Name, Item->Transform);
+	}
+}
+
 FReply SLevelSelectorCameraOverlay::OnTeleportClicked(FName Key, FTransform Transform)
 {
 	if (FavComboButton.IsValid()) FavComboButton->SetIsOpen(false);
 
-	if (FModuleManager::Get().IsModuleLoaded("LevelEditor"))
-	{
-		FLevelEditorModule& LevelEditorModule = FModuleManager::GetModuleChecked<FLevelEditorModule>("LevelEditor");
-		const auto ActiveViewportInterface = LevelEditorModule.GetFirstActiveLevelViewport();
+	TeleportTo(Transform);
 
-		if (const TSharedPtr<SLevelViewport> ActiveViewport = StaticCastSharedPtr<SLevelViewport>(ActiveViewportInterface); ActiveViewport.IsValid())
+	return FReply::Handled();
+}
+
+FReply SLevelSelectorCameraOverlay::OnNearestClicked()
+{
+	bIsStepping = false;
+
+	const FLevelSelectorCameraSpatialIndex* SpatialIndex = GetSettings()->FindCameraFavoriteSpatialIndex(CurrentLevelPath);
+	const FLevelEditorViewportClient* Client = GetActiveViewportClient();
+	const FCameraFavorite* Favorites = GetSettings()->FindCameraFavorites(CurrentLevelPath);
+	FLevelSelectorCameraSpatialIndex::FHit Hit;
+	if (SpatialIndex && Client && Favorites && SpatialIndex->FindNearest(Client->GetViewLocation(), Hit))
+	{
+		if (const FTransform* Transform = Favorites->HoldFavorites.Find(Hit.Name))
 		{
-			FLevelEditorViewportClient& Client = ActiveViewport->GetLevelViewportClient();
-			Client.SetViewLocation(Transform.GetLocation());
-			Client.SetViewRotation(Transform.GetRotation().Rotator());
-			Client.Invalidate();
+			TeleportTo(*Transform);
 		}
 	}
+	return FReply::Handled();
+}
+
+FReply SLevelSelectorCameraOverlay::OnStepClicked(bool bForward)
+{
+	const FLevelSelectorCameraSpatialIndex* SpatialIndex = GetSettings()->FindCameraFavoriteSpatialIndex(CurrentLevelPath);
+	const FLevelEditorViewportClient* Client = GetActiveViewportClient();
+	const FCameraFavorite* Favorites = GetSettings()->FindCameraFavorites(CurrentLevelPath);
+	if (!SpatialIndex || !Client || !Favorites)
+	{
+		return FReply::Handled();
+	}
+
+	// Moving the camera away from the last step starts a new walk from there. Favorites within a centimeter count as
+	// the current position and are skipped going forward.
+	const FVector ViewLocation = Client->GetViewLocation();
+	if (!bIsStepping || !ViewLocation.Equals(LastStepLocation, 1.0))
+	{
+		StepOrigin = ViewLocation;
+		StepDistance = bForward ? 1.0 : TNumericLimits<double>::Max();
+		StepName = NAME_None;
+	}
 
+	// The walk wraps around at either end.
+	FLevelSelectorCameraSpatialIndex::FHit Hit;
+	const bool bFound = bForward
+		? SpatialIndex->FindNext(StepOrigin, StepDistance, StepName, Hit) || SpatialIndex->FindNearest(StepOrigin, Hit)
+		: SpatialIndex->FindPrevious(StepOrigin, StepDistance, StepName, Hit) || SpatialIndex->FindPrevious(StepOrigin, TNumericLimits<double>::Max(), NAME_None, Hit);
+	const FTransform* Transform = bFound ? Favorites->HoldFavorites.Find(Hit.Name) : nullptr;
+	if (!Transform)
+	{
+		return FReply::Handled();
+	}
+
+	TeleportTo(*Transform);
+	StepDistance = Hit.Distance;
+	StepName = Hit.Name;
+	LastStepLocation = Transform->GetLocation();
+	bIsStepping = true;
 	return FReply::Handled();
 }
 
+FLevelEditorViewportClient* SLevelSelectorCameraOverlay::GetActiveViewportClient() const
+{
+	if (!FModuleManager::Get().IsModuleLoaded("LevelEditor"))
+	{
+		return nullptr;
+	}
+
+	FLevelEditorModule& LevelEditorModule = FModuleManager::GetModuleChecked<FLevelEditorModule>("LevelEditor");
+	if (const TSharedPtr<SLevelViewport> ActiveViewport = StaticCastSharedPtr<SLevelViewport>(LevelEditorModule.GetFirstActiveLevelViewport()); ActiveViewport.IsValid())
+	{
+		return &ActiveViewport->GetLevelViewportClient();
+	}
+	return nullptr;
+}
+
+void SLevelSelectorCameraOverlay::TeleportTo(const FTransform& Transform)
+{
+	if (FLevelEditorViewportClient* Client = GetActiveViewportClient())
+	{
+		Client->SetViewLocation(Transform.GetLocation());
+		Client->SetViewRotation(Transform.GetRotation().Rotator());
+		Client->Invalidate();
+	}
+}
+
+TSharedRef<SWidget> SLevelSelectorCameraOverlay::OnGetBulkMenuContent()
+{
+	FMenuBuilder MenuBuilder(true, nullptr);
+	MenuBuilder.AddMenuEntry(
+		LOCTEXT("AddFromSelection", "Add From Selected Actors"),
+		LOCTEXT("AddFromSelectionTip", "Adds a favorite at each selected actor, named after its label."),
+		FSlateIcon(),
+		FUIAction(
+			FExecuteAction::CreateSP(this, &SLevelSelectorCameraOverlay::OnAddFromSelectionClicked),
+			FCanExecuteAction::CreateLambda([]() { return GEditor && GEditor->GetSelectedActorCount() > 0; })));
+	MenuBuilder.AddSubMenu(
+		LOCTEXT("AddFromQuery", "Add From Actor Query"),
+		LOCTEXT("AddFromQueryTip", "Adds a favorite at each loaded actor of this level matching a class, tag and data layer."),
+		FNewMenuDelegate::CreateSP(this, &SLevelSelectorCameraOverlay::MakeActorQueryMenu));
+	MenuBuilder.AddMenuEntry(
+		LOCTEXT("Import", "Import..."),
+		LOCTEXT("ImportTip", "Adds the favorites of a CSV or JSON file to this level."),
+		FSlateIcon(),
+		FUIAction(FExecuteAction::CreateSP(this, &SLevelSelectorCameraOverlay::OnImportClicked)));
+	MenuBuilder.AddMenuEntry(
+		LOCTEXT("Export", "Export..."),
+		LOCTEXT("ExportTip", "Writes the favorites of this level to a CSV or JSON file."),
+		FSlateIcon(),
+		FUIAction(
+			FExecuteAction::CreateSP(this, &SLevelSelectorCameraOverlay::OnExportClicked),
+			FCanExecuteAction::CreateLambda([this]() { return bHasFavorites; })));
+	return MenuBuilder.MakeWidget();
+}
+
+void SLevelSelectorCameraOverlay::MakeActorQueryMenu(FMenuBuilder& MenuBuilder)
+{
+	MenuBuilder.AddWidget(
+		SNew(SBox)
+		.WidthOverride(160.0f)
+		[
+			SNew(SEditableTextBox)
+			.Text(FText::FromString(ActorQueryClassName))
+			.HintText(LOCTEXT("QueryClassHint", "Any class"))
+			.OnTextChanged_Lambda([this](const FText& Text) { ActorQueryClassName = Text.ToString().TrimStartAndEnd(); })
+		],
+		LOCTEXT("QueryClass", "Class"));
+	MenuBuilder.AddWidget(
+		SNew(SBox)
+		.WidthOverride(160.0f)
+		[
+			SNew(SEditableTextBox)
+			.Text(FText::FromString(ActorQueryTag))
+			.HintText(LOCTEXT("QueryTagHint", "Any tag"))
+			.OnTextChanged_Lambda([this](const FText& Text) { ActorQueryTag = Text.ToString().TrimStartAndEnd(); })
+		],
+		LOCTEXT("QueryTag", "Actor Tag"));
+	MenuBuilder.AddWidget(
+		SNew(SBox)
+		.WidthOverride(160.0f)
+		[
+			SNew(SEditableTextBox)
+			.Text(FText::FromString(ActorQueryDataLayer))
+			.HintText(LOCTEXT("QueryDataLayerHint", "Any data layer"))
+			.OnTextChanged_Lambda([this](const FText& Text) { ActorQueryDataLayer = Text.ToString().TrimStartAndEnd(); })
+		],
+		LOCTEXT("QueryDataLayer", "Data Layer"));
+	MenuBuilder.AddWidget(
+		SNew(SBox)
+		.WidthOverride(160.0f)
+		[
+			SNew(SNumericEntryBox<double>)
+			.MinValue(0.0)
+			.Value_Lambda([this]() { return ActorQueryViewDistance; })
+			.OnValueChanged_Lambda([this](double Value) { ActorQueryViewDistance = Value; })
+			.OnValueCommitted_Lambda([this](double Value, ETextCommit::Type) { ActorQueryViewDistance = Value; })
+			.ToolTipText(LOCTEXT("QueryDistanceTip", "0 uses the actor's own view, otherwise the camera looks at the actor from this far behind and above it."))
+		],
+		LOCTEXT("QueryDistance", "View Distance"));
+	MenuBuilder.AddMenuEntry(
+		LOCTEXT("QueryAdd", "Add Matching Actors"),
+		LOCTEXT("QueryAddTip", "Adds a favorite for each matching loaded actor. Names already used by this level get a numbered suffix."),
+		FSlateIcon(),
+		FUIAction(
+			FExecuteAction::CreateSP(this, &SLevelSelectorCameraOverlay::OnAddFromQueryClicked),
+			FCanExecuteAction::CreateLambda([this]() { return CurrentLevelPath.IsValid(); })));
+}
+
+void SLevelSelectorCameraOverlay::OnAddFromQueryClicked()
+{
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	if (!World || !CurrentLevelPath.IsValid())
+	{
+		return;
+	}
+
+	FLevelSelectorActorQuery Query;
+	if (!ActorQueryClassName.IsEmpty())
+	{
+		Query.ActorClass = FLevelSelectorCameraFavoriteTransfer::FindActorClass(ActorQueryClassName);
+		if (!Query.ActorClass)
+		{
+			FMessageDialog::Open(EAppMsgType::Ok, FText::Format(LOCTEXT("QueryClassErr", "{0} is not an actor class."), FText::FromString(ActorQueryClassName)));
+			return;
+		}
+	}
+	Query.ActorTag = ActorQueryTag.IsEmpty() ? NAME_None : FName(*ActorQueryTag);
+	Query.DataLayerName = ActorQueryDataLayer.IsEmpty() ? NAME_None : FName(*ActorQueryDataLayer);
+	Query.ViewDistance = ActorQueryViewDistance;
+
+	TMap<FName, FTransform> Favorites;
+	if (FLevelSelectorCameraFavoriteTransfer::CollectFromActors(World, Query, Favorites) > 0)
+	{
+		const int32 NumAdded = GetSettings()->AddCameraFavorites(CurrentLevelPath, Favorites);
+		UE_LOG(LogBDCLevelSelector, Display, TEXT("Added %d camera favorites to %s."), NumAdded, *CurrentLevelPath.GetLongPackageName());
+	}
+	else
+	{
+		UE_LOG(LogBDCLevelSelector, Display, TEXT("No loaded actor of %s matches the query."), *CurrentLevelPath.GetLongPackageName());
+	}
+}
+
+void SLevelSelectorCameraOverlay::OnAddFromSelectionClicked()
+{
+	if (!GEditor || !CurrentLevelPath.IsValid())
+	{
+		return;
+	}
+
+	TArray<AActor*> Actors;
+	GEditor->GetSelectedActors()->GetSelectedObjects<AActor>(Actors);
+	TMap<FName, FTransform> Favorites;
+	if (FLevelSelectorCameraFavoriteTransfer::CollectFromActors(Actors, 0.0, Favorites) > 0)
+	{
+		GetSettings()->AddCameraFavorites(CurrentLevelPath, Favorites);
+	}
+}
+
+void SLevelSelectorCameraOverlay::OnImportClicked()
+{
+	IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get();
+	if (!DesktopPlatform || !CurrentLevelPath.IsValid())
+	{
+		return;
+	}
+
+	TArray<FString> Filenames;
+	if (!DesktopPlatform->OpenFileDialog(FSlateApplication::Get().FindBestParentWindowHandleForDialogs(AsShared()),
+		LOCTEXT("ImportTitle", "Import Camera Favorites").ToString(), FPaths::ProjectDir(), FString(),
+		TEXT("Camera Favorites (*.csv;*.json)|*.csv;*.json"), EFileDialogFlags::None, Filenames) || Filenames.IsEmpty())
+	{
+		return;
+	}
+
+	TMap<FName, FTransform> Favorites;
+	if (!FLevelSelectorCameraFavoriteTransfer::Import(Filenames[0], Favorites))
+	{
+		FMessageDialog::Open(EAppMsgType::Ok, FText::Format(LOCTEXT("ImportErr", "Could not read {0}."), FText::FromString(Filenames[0])));
+		return;
+	}
+	GetSettings()->AddCameraFavorites(CurrentLevelPath, Favorites);
+}
+
+void SLevelSelectorCameraOverlay::OnExportClicked()
+{
+	IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get();
+	const FCameraFavorite* Favorites = CurrentLevelPath.IsValid() ? GetSettings()->FindCameraFavorites(CurrentLevelPath) : nullptr;
+	if (!DesktopPlatform || !Favorites)
+	{
+		return;
+	}
+
+	TArray<FString> Filenames;
+	if (!DesktopPlatform->SaveFileDialog(FSlateApplication::Get().FindBestParentWindowHandleForDialogs(AsShared()),
+		LOCTEXT("ExportTitle", "Export Camera Favorites").ToString(), FPaths::ProjectDir(), CurrentLevelPath.GetAssetName() + TEXT("_CameraFavorites.csv"),
+		TEXT("CSV (*.csv)|*.csv|JSON (*.json)|*.json"), EFileDialogFlags::None, Filenames) || Filenames.IsEmpty())
+	{
+		return;
+	}
+
+	if (!FLevelSelectorCameraFavoriteTransfer::Export(Filenames[0], *Favorites))
+	{
+		FMessageDialog::Open(EAppMsgType::Ok, FText::Format(LOCTEXT("ExportErr", "Could not write {0}."), FText::FromString(Filenames[0])));
+	}
+}
+
 FReply SLevelSelectorCameraOverlay::OnEditItemClicked(FName Key)
 {
 	if (FavComboButton.IsValid()) FavComboButton->SetIsOpen(false);
@@ -364,21 +981,9 @@ FReply SLevelSelectorCameraOverlay::OnEditItemClicked(FName Key)
 			const FName NewName(*RenameInput->GetText().ToString());
 			if (!NewName.IsNone() && NewName != Key)
 			{
-				UBDC_LevelSelectorSettings* Settings = GetSettings();
 				TSoftObjectPtr<UWorld> CurrentLevel;
 				GetCurrentLevelSoftPtr(CurrentLevel);
-
-				if (Settings->HoldFavorites.Contains(CurrentLevel))
-				{
-					if (Settings->HoldFavorites[CurrentLevel].HoldFavorites.Contains(Key))
-					{
-						const FTransform Trans = Settings->HoldFavorites[CurrentLevel].HoldFavorites[Key];
-						Settings->HoldFavorites[CurrentLevel].HoldFavorites.Remove(Key);
-						Settings->HoldFavorites[CurrentLevel].HoldFavorites.Add(NewName, Trans);
-
-						Settings->SaveToProjectDefaultConfig();
-					}
-				}
+				GetSettings()->RenameCameraFavorite(CurrentLevel.ToSoftObjectPath(), Key, NewName);
 			}
 		}
 		if (PopupWindow.IsValid()) PopupWindow->RequestDestroyWindow();
@@ -439,15 +1044,9 @@ FReply SLevelSelectorCameraOverlay::OnDeleteItemClicked(FName Key)
 
 	if (const EAppReturnType::Type Result = FMessageDialog::Open(EAppMsgType::YesNo, FText::Format(LOCTEXT("ConfirmDelete", "Are you sure you want to delete '{0}'?"), FText::FromName(Key))); Result == EAppReturnType::Yes)
 	{
-		UBDC_LevelSelectorSettings* Settings = GetSettings();
 		TSoftObjectPtr<UWorld> CurrentLevel;
 		GetCurrentLevelSoftPtr(CurrentLevel);
-
-		if (Settings->HoldFavorites.Contains(CurrentLevel))
-		{
-			Settings->HoldFavorites[CurrentLevel].HoldFavorites.Remove(Key);
-			Settings->SaveToProjectDefaultConfig();
-		}
+		GetSettings()->RemoveCameraFavorite(CurrentLevel.ToSoftObjectPath(), Key);
 	}
 
 	return FReply::Handled();
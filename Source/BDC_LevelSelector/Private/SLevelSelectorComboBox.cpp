@@ -7,16 +7,27 @@
 * and are used with permission.
 */
 #include "SLevelSelectorComboBox.h"
+#include "BDC_LevelSelector.h"
 #include "BDC_LevelSelectorSettings.h"
 #include "ContentBrowserModule.h"
 #include "Editor.h"
 #include "FileHelpers.h"
 #include "GameplayTagContainer.h"
 #include "IContentBrowserSingleton.h"
-#include "SGameplayTagCombo.h"
+#include "LevelSelectorMetadataCache.h"
+#include "LevelEditorViewport.h"
+#include "LevelSelectorPrefetcher.h"
+#include "LevelSelectorRegionLoader.h"
+#include "LevelSelectorStats.h"
+#include "LevelSelectorStyle.h"
+#include "LevelSelectorSwitchTelemetry.h"
+#include "SGameplayTagContainerCombo.h"
+#include "SLevelSelectorRow.h"
+#include "SLevelSelectorTreeRow.h"
 #include "SlateOptMacros.h"
-#include "AssetRegistry/AssetRegistryModule.h"
-#include "Engine/Texture2D.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Sort.h"
+#include "String/Find.h"
 #include "Engine/World.h"
 #include "Modules/ModuleManager.h"
 #include "Styling/AppStyle.h"
@@ -30,61 +41,46 @@
 #include "Widgets/Input/SCheckBox.h"
 #include "Widgets/Input/SComboButton.h"
 #include "Widgets/Layout/SBox.h"
+#include "Widgets/Layout/SSeparator.h"
+#include "Widgets/Layout/SWidgetSwitcher.h"
 #include "Widgets/Text/STextBlock.h"
 #include "Widgets/Input/SEditableTextBox.h"
 
-FLevelSelectorItem::FLevelSelectorItem(const FAssetData& InAssetData) : AssetData(InAssetData)
-{
-    DisplayName = AssetData.AssetName.ToString();
-    PackagePath = InAssetData.GetSoftObjectPath().GetLongPackageName();
-}
-
-bool FLevelSelectorItem::IsFavorite() const
-{
-    if (const UBDC_LevelSelectorSettings* Settings = GetDefault<UBDC_LevelSelectorSettings>())
-    {
-       auto SoftLevel = TSoftObjectPtr<UWorld>(AssetData.GetSoftObjectPath());
-       return Settings->FavoriteLevels.Contains(SoftLevel);
-    }
-    return false;
-}
-
-
 void SLevelSelectorComboBox::Construct(const FArguments& InArgs)
 {
     DefaultLevelIcon = FAppStyle::GetBrush("LevelEditor.Tabs.Levels");
     RefreshIconBrush = FAppStyle::GetBrush("Icons.Refresh");
-    FavoriteIconTextureTrue = LoadObject<UTexture2D>(nullptr, TEXT("/BDC_LevelSelector/Tex_MarkFav_True.Tex_MarkFav_True"));
-    FavoriteIconTextureFalse = LoadObject<UTexture2D>(nullptr, TEXT("/BDC_LevelSelector/Tex_MarkFav_False.Tex_MarkFav_False"));
-    FavoriteIconBrush = FAppStyle::GetBrush("Icons.Star");
-    UnfavoriteIconBrush = FAppStyle::GetBrush("Icons.EmptyStar");
-    if (FavoriteIconTextureTrue)
-    {
-        FavoriteIconTextureTrue->AddToRoot();
-        FavoriteIconTextureTrue->SetForceMipLevelsToBeResident(30.0f);
-        FavoriteIconTextureTrue->WaitForStreaming();
+    FavoriteIconBrush = FLevelSelectorStyle::GetBrush("LevelSelector.Favorite");
+    UnfavoriteIconBrush = FLevelSelectorStyle::GetBrush("LevelSelector.Unfavorite");
 
-        FavoriteOwnedBrush = MakeUnique<FSlateBrush>();
-        FavoriteOwnedBrush->SetResourceObject(FavoriteIconTextureTrue);
-        FavoriteOwnedBrush->ImageSize = FVector2D(24, 24);
-        FavoriteIconBrush = FavoriteOwnedBrush.Get();
+    LevelIndex = InArgs._LevelIndex;
+    if (!LevelIndex.IsValid())
+    {
+       LevelIndex = MakeShared<FLevelSelectorIndex>();
+       LevelIndex->Initialize();
     }
-
-    if (FavoriteIconTextureFalse)
+    LevelIndex->OnChanged().AddSP(this, &SLevelSelectorComboBox::HandleLevelIndexChanged);
+    Prefetcher = InArgs._Prefetcher;
+    SwitchTelemetry = InArgs._SwitchTelemetry;
+    if (SwitchTelemetry.IsValid())
     {
-        FavoriteIconTextureFalse->AddToRoot();
-        FavoriteIconTextureFalse->SetForceMipLevelsToBeResident(30.0f);
-        FavoriteIconTextureFalse->WaitForStreaming();
-
-        UnfavoriteOwnedBrush = MakeUnique<FSlateBrush>();
-        UnfavoriteOwnedBrush->SetResourceObject(FavoriteIconTextureFalse);
-        UnfavoriteOwnedBrush->ImageSize = FVector2D(24, 24);
-        UnfavoriteIconBrush = UnfavoriteOwnedBrush.Get();
+       SwitchTelemetry->OnSwitchRecorded().AddSP(this, &SLevelSelectorComboBox::HandleSwitchRecorded);
+    }
+    MetadataCache = InArgs._MetadataCache;
+    ThumbnailCache = InArgs._ThumbnailCache;
+    if (MetadataCache.IsValid())
+    {
+       MetadataCache->OnUpdated().AddSP(this, &SLevelSelectorComboBox::HandleMetadataUpdated);
+    }
+    SortMode = GetDefault<UBDC_LevelSelectorUserSettings>()->SortMode;
+    bShowFolderTree = GetDefault<UBDC_LevelSelectorUserSettings>()->bShowFolderTree;
+    bHideHeavyLevels = GetDefault<UBDC_LevelSelectorUserSettings>()->bHideHeavyLevels;
+    if (bShowFolderTree)
+    {
+       EnsurePathTrie();
     }
 
-    HeaderItem = MakeShareable(new FLevelSelectorItem(FAssetData()));
-
-    PopulateLevelList();
+    ApplyFilters();
 
     ChildSlot
     [
@@ -107,12 +103,10 @@ void SLevelSelectorComboBox::Construct(const FArguments& InArgs)
           .FillWidth(1.0f)
           .VAlign(VAlign_Center)
           [
-             SAssignNew(LevelComboBox, SComboBox<TSharedPtr<FLevelSelectorItem>>)
-             .OptionsSource(&LevelListSource)
-             .OnGenerateWidget(this, &SLevelSelectorComboBox::OnGenerateComboWidget)
-             .OnSelectionChanged(this, &SLevelSelectorComboBox::OnSelectionChanged)
-             .OnComboBoxOpening(this, &SLevelSelectorComboBox::OnComboBoxOpening)
-             .MaxListHeight(480.0f)
+             SAssignNew(LevelComboButton, SComboButton)
+             .OnComboBoxOpened(this, &SLevelSelectorComboBox::OnComboBoxOpening)
+             .OnMenuOpenChanged(this, &SLevelSelectorComboBox::OnMenuOpenChanged)
+             .ButtonContent()
              [
                 SAssignNew(ComboBoxContentContainer, SBox)
                 .VAlign(VAlign_Center)
@@ -120,6 +114,10 @@ void SLevelSelectorComboBox::Construct(const FArguments& InArgs)
                    SNew(STextBlock).Text(FText::FromString(TEXT("Select a Level...")))
                 ]
              ]
+             .MenuContent()
+             [
+                CreateMenuContent()
+             ]
           ]
           + SHorizontalBox::Slot()
           .AutoWidth()
@@ -160,10 +158,9 @@ void SLevelSelectorComboBox::Construct(const FArguments& InArgs)
        ]
     ];
 
-    FEditorDelegates::OnMapOpened.AddSP(this, &SLevelSelectorComboBox::HandleMapOpened);
+    LevelComboButton->SetMenuContentWidgetToFocus(SearchTextBoxWidget);
 
-    const FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
-    AssetRegistryModule.Get().OnFilesLoaded().AddSP(this, &SLevelSelectorComboBox::OnAssetRegistryFilesLoaded);
+    FEditorDelegates::OnMapOpened.AddSP(this, &SLevelSelectorComboBox::HandleMapOpened);
 
     if (GEditor && GEditor->GetEditorWorldContext().World())
     {
@@ -182,84 +179,125 @@ void SLevelSelectorComboBox::OnComboBoxOpening()
 
 SLevelSelectorComboBox::~SLevelSelectorComboBox()
 {
-    if (FModuleManager::Get().IsModuleLoaded("AssetRegistry"))
+    if (LevelIndex.IsValid())
     {
-       const FAssetRegistryModule& AssetRegistryModule = FModuleManager::GetModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
-       AssetRegistryModule.Get().OnFilesLoaded().RemoveAll(this);
+       LevelIndex->OnChanged().RemoveAll(this);
+    }
+    if (SwitchTelemetry.IsValid())
+    {
+       SwitchTelemetry->OnSwitchRecorded().RemoveAll(this);
+    }
+    if (MetadataCache.IsValid())
+    {
+       MetadataCache->OnUpdated().RemoveAll(this);
+    }
+    if (MetadataResortTickerHandle.IsValid())
+    {
+       FTSTicker::GetCoreTicker().RemoveTicker(MetadataResortTickerHandle);
     }
     FEditorDelegates::OnMapOpened.RemoveAll(this);
-
-    FavoriteIconTextureTrue = nullptr;
-    FavoriteIconTextureFalse = nullptr;
 }
 
-void SLevelSelectorComboBox::OnAssetRegistryFilesLoaded()
+void SLevelSelectorComboBox::HandleLevelIndexChanged(const FLevelSelectorIndexDelta& Delta)
 {
-    if (UBDC_LevelSelectorSettings* MutableSettings = GetMutableDefault<UBDC_LevelSelectorSettings>())
+    // The trie follows the same deltas as the list, only the folders on the path of a changed level are touched.
+    if (PathTrie.IsValid())
     {
-       FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
-
-       TArray<TSoftObjectPtr<UWorld>> FavoriteLevelsToRemove;
-       for (const auto& FavoritePath : MutableSettings->FavoriteLevels)
+       if (Delta.bFullRefresh)
        {
-          if (FavoritePath.IsValid())
-          {
-             const FAssetData AssetData = AssetRegistryModule.Get().GetAssetByObjectPath(FavoritePath.ToSoftObjectPath());
-             if (!AssetData.IsValid())
-             {
-                FavoriteLevelsToRemove.Add(FavoritePath);
-             }
-          }
+          PathTrie->Build(LevelIndex->GetSortedItems());
        }
-       
-       TArray<TSoftObjectPtr<UWorld>> HoldKeys;
-       MutableSettings->LevelTags.GetKeys(HoldKeys);
-       for (const auto& KeyPath : HoldKeys)
+       else
        {
-          if (KeyPath.IsValid())
+          for (const TSharedPtr<FLevelSelectorItem>& Item : Delta.Removed)
+          {
+             PathTrie->Remove(Item);
+          }
+          for (const TSharedPtr<FLevelSelectorItem>& Item : Delta.Updated)
           {
-             const FAssetData AssetData = AssetRegistryModule.Get().GetAssetByObjectPath(KeyPath.ToSoftObjectPath());
-             if (!AssetData.IsValid())
-             {
-                MutableSettings->LevelTags.Remove(KeyPath);
-             }
+             PathTrie->Update(Item);
+          }
+          for (const TSharedPtr<FLevelSelectorItem>& Item : Delta.Added)
+          {
+             PathTrie->Add(Item);
           }
        }
+    }
+
+    if (Delta.bFullRefresh)
+    {
+       ApplyFilters(true);
+       EnsureSelectedCurrentLevel(false);
+       return;
+    }
+
+    // One pass drops all removed and updated levels and one merge puts the changed ones back, however large the delta is.
+    TSet<const FLevelSelectorItem*> StaleItems;
+    StaleItems.Reserve(Delta.Removed.Num() + Delta.Updated.Num());
+    for (const TSharedPtr<FLevelSelectorItem>& Item : Delta.Removed)
+    {
+       StaleItems.Add(Item.Get());
+    }
+    for (const TSharedPtr<FLevelSelectorItem>& Item : Delta.Updated)
+    {
+       StaleItems.Add(Item.Get());
+    }
+    if (!StaleItems.IsEmpty())
+    {
+       LevelListSource.RemoveAll([&StaleItems](const TSharedPtr<FLevelSelectorItem>& Item)
+       {
+          return StaleItems.Contains(Item.Get());
+       });
+    }
 
-       for (const auto& LevelToRemove : FavoriteLevelsToRemove)
+    TArray<TSharedPtr<FLevelSelectorItem>> ChangedItems;
+    for (const TSharedPtr<FLevelSelectorItem>& Item : Delta.Updated)
+    {
+       if (PassesFilters(Item))
        {
-          MutableSettings->FavoriteLevels.Remove(LevelToRemove);
+          ChangedItems.Add(Item);
        }
     }
-    
-    PopulateLevelList();
-    if (GEditor && GEditor->GetEditorWorldContext().World())
+    for (const TSharedPtr<FLevelSelectorItem>& Item : Delta.Added)
     {
-       RefreshSelection(GEditor->GetEditorWorldContext().World()->GetPathName(), true);
+       if (PassesFilters(Item))
+       {
+          ChangedItems.Add(Item);
+       }
     }
+    MergeFiltered(ChangedItems);
 
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
-    AssetRegistryModule.Get().OnFilesLoaded().RemoveAll(this);
+    if (LevelListView.IsValid())
+    {
+       LevelListView->RequestListRefresh();
+    }
+    RefreshTree();
+    EnsureSelectedCurrentLevel(false);
 }
 
 void SLevelSelectorComboBox::RefreshSelection(const FString& MapPath, bool bStrict)
 {
-    const FString PackagePath = FPackageName::ObjectPathToPackageName(MapPath);
+    LEVELSELECTOR_SCOPE_CYCLE_COUNTER(STAT_LevelSelector_RefreshSelection);
 
-    for (const auto& Item : LevelListSource)
+    FString PackagePath = FPackageName::ObjectPathToPackageName(MapPath);
+    if (!FPackageName::IsValidLongPackageName(PackagePath))
     {
-       if (Item.IsValid() && Item->PackagePath.Equals(PackagePath, ESearchCase::IgnoreCase))
+       FPackageName::TryConvertFilenameToLongPackageName(MapPath, PackagePath);
+    }
+
+    if (const TSharedPtr<FLevelSelectorItem> Item = LevelIndex.IsValid() ? LevelIndex->FindItem(FName(*PackagePath, FNAME_Find)) : nullptr)
+    {
+       if (LevelListView.IsValid())
        {
-          if (LevelComboBox.IsValid())
-          {
-             LevelComboBox->SetSelectedItem(Item);
-          }
-          if (ComboBoxContentContainer.IsValid())
-          {
-             ComboBoxContentContainer->SetContent(CreateSelectedItemWidget(Item));
-          }
-          return;
+          LevelListView->SetSelection(Item, ESelectInfo::Direct);
+          LevelListView->RequestScrollIntoView(Item);
+       }
+       RevealInTree(*Item);
+       if (ComboBoxContentContainer.IsValid())
+       {
+          ComboBoxContentContainer->SetContent(CreateSelectedItemWidget(Item));
        }
+       return;
     }
 
     if (!bStrict)
@@ -267,9 +305,13 @@ void SLevelSelectorComboBox::RefreshSelection(const FString& MapPath, bool bStri
        return;
     }
 
-    if (LevelComboBox.IsValid())
+    if (LevelListView.IsValid())
+    {
+       LevelListView->ClearSelection();
+    }
+    if (LevelTreeView.IsValid())
     {
-       LevelComboBox->ClearSelection();
+       LevelTreeView->ClearSelection();
     }
     if (ComboBoxContentContainer.IsValid())
     {
@@ -288,153 +330,287 @@ void SLevelSelectorComboBox::EnsureSelectedCurrentLevel(bool bStrict)
     }
 }
 
-void SLevelSelectorComboBox::PopulateLevelList()
+TSharedRef<SWidget> SLevelSelectorComboBox::CreateMenuContent()
+{
+    // The list only builds rows for the visible window, scrolled out rows go back to RowPool.
+    // The tree asks for the children of expanded folders only, collapsed subtrees are never visited.
+    return SNew(SVerticalBox)
+        + SVerticalBox::Slot()
+        .AutoHeight()
+        .Padding(FMargin(4.0f))
+        [
+            CreateFilterHeaderWidget()
+        ]
+        + SVerticalBox::Slot()
+        .AutoHeight()
+        [
+            SNew(SBox)
+            .MaxDesiredHeight(480.0f)
+            .MinDesiredWidth(480.0f)
+            [
+                SNew(SWidgetSwitcher)
+                .WidgetIndex_Lambda([this]()
+                {
+                    return bShowFolderTree ? 1 : 0;
+                })
+                + SWidgetSwitcher::Slot()
+                [
+                    SAssignNew(LevelListView, SListView<TSharedPtr<FLevelSelectorItem>>)
+                    .ListItemsSource(&LevelListSource)
+                    .SelectionMode(ESelectionMode::Single)
+                    .OnGenerateRow(this, &SLevelSelectorComboBox::OnGenerateLevelRow)
+                    .OnRowReleased(this, &SLevelSelectorComboBox::OnLevelRowReleased)
+                    .OnSelectionChanged(this, &SLevelSelectorComboBox::OnSelectionChanged)
+                ]
+                + SWidgetSwitcher::Slot()
+                [
+                    SAssignNew(LevelTreeView, STreeView<TSharedPtr<FLevelSelectorTreeNode>>)
+                    .TreeItemsSource(&TreeRootItems)
+                    .SelectionMode(ESelectionMode::Single)
+                    .OnGenerateRow(this, &SLevelSelectorComboBox::OnGenerateTreeRow)
+                    .OnGetChildren(this, &SLevelSelectorComboBox::OnGetTreeChildren)
+                    .OnSelectionChanged(this, &SLevelSelectorComboBox::OnTreeSelectionChanged)
+                ]
+            ]
+        ];
+}
+
+TSharedRef<SWidget> SLevelSelectorComboBox::CreateFilterHeaderWidget()
 {
-    AllLevels.Empty();
+    return SNew(SHorizontalBox)
+        + SHorizontalBox::Slot()
+        .FillWidth(1.0f)
+        .Padding(FMargin(0,0,4,0))
+        [
+            SAssignNew(SearchTextBoxWidget, SEditableTextBox)
+            .HintText(FText::FromString(TEXT("Search levels...")))
+            .Text(SearchTextFilter)
+            .OnTextChanged(this, &SLevelSelectorComboBox::OnSearchTextChanged)
+            .OnTextCommitted(this, &SLevelSelectorComboBox::OnSearchTextCommitted)
+            .MinDesiredWidth(160)
+        ]
+        + SHorizontalBox::Slot()
+        .AutoWidth()
+        .Padding(FMargin(0,0,4,0))
+        [
+            SNew(SGameplayTagContainerCombo)
+            .OnTagContainerChanged(this, &SLevelSelectorComboBox::OnFilterTagsChanged)
+            .TagContainer_Lambda([this]()
+            {
+                return SelectedFilterTags;
+            })
+            .Filter(FString())
+        ]
+        + SHorizontalBox::Slot()
+        .AutoWidth()
+        .Padding(FMargin(0,0,4,0))
+        [
+            SNew(SButton)
+            .ButtonStyle(FAppStyle::Get(), "SimpleButton")
+            .OnClicked(this, &SLevelSelectorComboBox::OnTagMatchClicked)
+            .ToolTipText(FText::FromString(TEXT("Any: levels with at least one of the tags. All: levels with every tag. Parent tags match their child tags.")))
+            [
+                SNew(STextBlock).Text(this, &SLevelSelectorComboBox::GetTagMatchText)
+            ]
+        ]
+        + SHorizontalBox::Slot()
+        .AutoWidth()
+        .Padding(FMargin(0,0,4,0))
+        [
+            SNew(SComboButton)
+            .ComboButtonStyle(FAppStyle::Get(), "SimpleComboButton")
+            .HasDownArrow(false)
+            .ToolTipText(FText::FromString(TEXT("Sort levels")))
+            .OnGetMenuContent(this, &SLevelSelectorComboBox::CreateSortMenuContent)
+            .ButtonContent()
+            [
+                SNew(SImage)
+                .Image(FAppStyle::GetBrush("Icons.SortDown"))
+                .ColorAndOpacity(FSlateColor::UseForeground())
+            ]
+        ]
+        + SHorizontalBox::Slot()
+        .AutoWidth()
+        .Padding(FMargin(0,0,4,0))
+        [
+            SNew(SCheckBox)
+            .Style(FAppStyle::Get(), "ToggleButtonCheckbox")
+            .ToolTipText(FText::FromString(TEXT("Show the levels as a folder tree")))
+            .IsChecked_Lambda([this]()
+            {
+                return bShowFolderTree ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+            })
+            .OnCheckStateChanged_Lambda([this](ECheckBoxState NewState)
+            {
+                SetShowFolderTree(NewState == ECheckBoxState::Checked);
+            })
+            [
+                SNew(SImage)
+                .Image(FAppStyle::GetBrush("Icons.FolderOpen"))
+                .ColorAndOpacity(FSlateColor::UseForeground())
+            ]
+        ]
+        + SHorizontalBox::Slot()
+        .AutoWidth()
+        [
+            SNew(SButton)
+            .ButtonStyle(FAppStyle::Get(), "SimpleButton")
+            .OnClicked(this, &SLevelSelectorComboBox::OnClearFilterClicked)
+            .ToolTipText(FText::FromString(TEXT("Clear search and tag filter")))
+            [
+                SNew(STextBlock).Text(FText::FromString(TEXT("X")))
+            ]
+        ];
+}
 
-    const FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-    TArray<FAssetData> AssetDataList;
-    AssetRegistryModule.Get().GetAssetsByClass(UWorld::StaticClass()->GetClassPathName(), AssetDataList);
+TSharedRef<ITableRow> SLevelSelectorComboBox::OnGenerateLevelRow(TSharedPtr<FLevelSelectorItem> InItem, const TSharedRef<STableViewBase>& OwnerTable)
+{
+    LEVELSELECTOR_SCOPE_CYCLE_COUNTER(STAT_LevelSelector_GenerateRow);
+    INC_DWORD_STAT(STAT_LevelSelector_RowsGenerated);
 
-    const UBDC_LevelSelectorSettings* Settings = GetDefault<UBDC_LevelSelectorSettings>();
-    if (!Settings)
+    if (RowPool.Num() > 0)
     {
-       return;
+        TSharedRef<SLevelSelectorRow> Row = RowPool.Pop();
+        Row->SetItem(InItem);
+        return Row;
     }
 
-    for (const auto& FavoritePath : Settings->FavoriteLevels)
+    return SNew(SLevelSelectorRow, OwnerTable)
+        .Item(InItem)
+        .LevelIcon(DefaultLevelIcon)
+        .FavoriteIcon(FavoriteIconBrush)
+        .UnfavoriteIcon(UnfavoriteIconBrush)
+        .SwitchTelemetry(SwitchTelemetry)
+        .MetadataCache(MetadataCache)
+        .ThumbnailCache(ThumbnailCache)
+        .OnToggleFavorite(this, &SLevelSelectorComboBox::OnToggleFavorite)
+        .OnShowInContentBrowser_Lambda([this](const TSharedPtr<FLevelSelectorItem>& Item)
+        {
+            OnShowInContentBrowserClicked(Item);
+        })
+        .OnTagsChanged(this, &SLevelSelectorComboBox::OnTagsChanged)
+        .OnOpenAtFavorite(this, &SLevelSelectorComboBox::OpenLevelAtFavorite)
+        .OnHovered(this, &SLevelSelectorComboBox::OnLevelRowHovered)
+        .OnUnhovered(this, &SLevelSelectorComboBox::OnLevelRowUnhovered);
+}
+
+void SLevelSelectorComboBox::OnLevelRowHovered(const TSharedPtr<FLevelSelectorItem>& InItem)
+{
+    if (Prefetcher.IsValid())
     {
-       if (FavoritePath.IsValid())
-       {
-          if (const FAssetData AssetData = AssetRegistryModule.Get().GetAssetByObjectPath(FavoritePath.ToSoftObjectPath()); AssetData.IsValid())
-          {
-             AllLevels.Add(FLevelSelectorItem::Create(AssetData));
-          }
-       }
+        Prefetcher->BeginHover(InItem->PackageName);
     }
+}
 
-    for (const FAssetData& Data : AssetDataList)
+void SLevelSelectorComboBox::OnLevelRowUnhovered()
+{
+    if (Prefetcher.IsValid())
     {
-       if (Data.GetSoftObjectPath().GetLongPackageName().StartsWith(TEXT("/Game/")))
-       {
-          TSharedRef<FLevelSelectorItem> NewItem = FLevelSelectorItem::Create(Data);
-          bool bIsAlreadyInList = false;
-          for (const TSharedPtr<FLevelSelectorItem>& ExistingItem : AllLevels)
-          {
-             if (ExistingItem->PackagePath == NewItem->PackagePath)
-             {
-                bIsAlreadyInList = true;
-                break;
-             }
-          }
-          if (!bIsAlreadyInList)
-          {
-             AllLevels.Add(NewItem);
-          }
-       }
+        Prefetcher->EndHover();
     }
+}
 
-    SortLevelList();
+void SLevelSelectorComboBox::OnMenuOpenChanged(bool bIsOpen)
+{
+    if (!bIsOpen)
+    {
+        OnLevelRowUnhovered();
+    }
+}
 
-    ApplyFilters();
+void SLevelSelectorComboBox::OnLevelRowReleased(const TSharedRef<ITableRow>& InRow)
+{
+    TSharedRef<SLevelSelectorRow> Row = StaticCastSharedRef<SLevelSelectorRow>(InRow);
+    Row->SetItem(nullptr);
+    RowPool.Add(Row);
 }
 
-void SLevelSelectorComboBox::SortLevelList()
+void SLevelSelectorComboBox::CloseMenu()
 {
-    if (const UBDC_LevelSelectorSettings* Settings = GetDefault<UBDC_LevelSelectorSettings>())
+    if (LevelComboButton.IsValid() && LevelComboButton->IsOpen())
     {
-       AllLevels.Sort([&](const TSharedPtr<FLevelSelectorItem>& A, const TSharedPtr<FLevelSelectorItem>& B)
-       {
-          const FSoftObjectPath PathA = A->AssetData.GetSoftObjectPath();
-          auto SoftLevelA = TSoftObjectPtr<UWorld>(PathA);
-          const FSoftObjectPath PathB = B->AssetData.GetSoftObjectPath();
-          auto SoftLevelB = TSoftObjectPtr<UWorld>(PathB);
+        LevelComboButton->SetIsOpen(false);
+    }
+}
 
-          const bool bAIsFavorite = Settings->FavoriteLevels.Contains(SoftLevelA);
+void SLevelSelectorComboBox::OnToggleFavorite(const TSharedPtr<FLevelSelectorItem>& InItem)
+{
+    if (InItem.IsValid())
+    {
+        OnFavoriteCheckboxChanged(InItem->IsFavorite() ? ECheckBoxState::Unchecked : ECheckBoxState::Checked, InItem);
+    }
+}
 
-          if (const bool bBIsFavorite = Settings->FavoriteLevels.Contains(SoftLevelB); bAIsFavorite != bBIsFavorite)
-          {
-             return bAIsFavorite;
-          }
-          return A->PackagePath < B->PackagePath;
-       });
+void SLevelSelectorComboBox::OnSelectionChanged(TSharedPtr<FLevelSelectorItem> InItem, ESelectInfo::Type SelectInfo)
+{
+    if (SelectInfo != ESelectInfo::OnMouseClick && SelectInfo != ESelectInfo::OnKeyPress)
+    {
+       return;
     }
-    else
+    if (InItem.IsValid())
     {
-       AllLevels.Sort([](const TSharedPtr<FLevelSelectorItem>& A, const TSharedPtr<FLevelSelectorItem>& B)
-       {
-          return A->PackagePath < B->PackagePath;
-       });
+       OpenLevel(InItem);
     }
 }
 
-TSharedRef<SWidget> SLevelSelectorComboBox::OnGenerateComboWidget(TSharedPtr<FLevelSelectorItem> InItem)
+void SLevelSelectorComboBox::OpenLevel(const TSharedPtr<FLevelSelectorItem>& InItem)
 {
-    if (IsHeaderItem(InItem))
+    CloseMenu();
+    if (SwitchTelemetry.IsValid())
     {
-        return SNew(SVerticalBox)
-        + SVerticalBox::Slot()
-        .AutoHeight()
-        .Padding(FMargin(4.0f))
-        [
-            SNew(SHorizontalBox)
-            + SHorizontalBox::Slot()
-            .FillWidth(1.0f)
-            .Padding(FMargin(0,0,4,0))
-            [
-                SAssignNew(SearchTextBoxWidget, SEditableTextBox)
-                .HintText(FText::FromString(TEXT("Search levels...")))
-                .Text(SearchTextFilter)
-                .OnTextChanged(this, &SLevelSelectorComboBox::OnSearchTextChanged)
-                .OnTextCommitted(this, &SLevelSelectorComboBox::OnSearchTextCommitted)
-                .MinDesiredWidth(160)
-            ]
-            + SHorizontalBox::Slot()
-            .AutoWidth()
-            .Padding(FMargin(0,0,4,0))
-            [
-                SAssignNew(FilterTagComboWidget, SGameplayTagCombo)
-                .OnTagChanged_Lambda([this](const FGameplayTag NewTag)
-                {
-                    OnFilterTagChanged(NewTag);
-                })
-                .Tag(SelectedFilterTag)
-                .Filter(FString())
-            ]
-            + SHorizontalBox::Slot()
-            .AutoWidth()
-            [
-                SNew(SButton)
-                .ButtonStyle(FAppStyle::Get(), "SimpleButton")
-                .OnClicked(this, &SLevelSelectorComboBox::OnClearFilterClicked)
-                .ToolTipText(FText::FromString(TEXT("Clear search and tag filter")))
-                [
-                    SNew(STextBlock).Text(FText::FromString(TEXT("X")))
-                ]
-            ]
-        ];
+       SwitchTelemetry->BeginSwitch(InItem->PackageName);
+    }
+    FEditorFileUtils::LoadMap(InItem->AssetData.GetSoftObjectPath().ToString());
+    if (SwitchTelemetry.IsValid())
+    {
+       SwitchTelemetry->EndSwitch();
     }
-    return CreateLevelItemWidget(InItem);
 }
 
-void SLevelSelectorComboBox::OnSelectionChanged(TSharedPtr<FLevelSelectorItem> InItem, ESelectInfo::Type SelectInfo)
+void SLevelSelectorComboBox::OpenLevelAtFavorite(const TSharedPtr<FLevelSelectorItem>& InItem, FName FavoriteName)
 {
-    if (IsHeaderItem(InItem))
+    const FCameraFavorite* Favorites = InItem.IsValid() ? GetDefault<UBDC_LevelSelectorSettings>()->FindCameraFavorites(InItem->AssetData.GetSoftObjectPath()) : nullptr;
+    const FTransform* FoundTransform = Favorites ? Favorites->HoldFavorites.Find(FavoriteName) : nullptr;
+    if (!FoundTransform)
     {
-        if (LevelComboBox.IsValid())
-        {
-            LevelComboBox->ClearSelection();
-        }
-        return;
+       return;
     }
+    const FTransform CameraTransform = *FoundTransform;
 
-    if (SelectInfo != ESelectInfo::OnMouseClick && SelectInfo != ESelectInfo::OnKeyPress)
+    const double StartTime = FPlatformTime::Seconds();
+    const uint64 StartMemory = FPlatformMemory::GetStats().UsedPhysical;
+    OpenLevel(InItem);
+    const double LevelLoadedTime = FPlatformTime::Seconds();
+
+    // The switch may have been cancelled at the save prompt.
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (!World || World->GetPackage()->GetFName() != InItem->PackageName)
     {
        return;
     }
-    if (InItem.IsValid())
+
+    // World Partition levels get the cells around the favorite loaded as a region, other levels were loaded as a
+    // whole by LoadMap already. The regions World Partition restored from the last session go first, so only the
+    // favorite's region stays loaded.
+    const int32 NumUnloaded = FLevelSelectorRegionLoader::UnloadRegions(World);
+    const bool bLoadedRegion = FLevelSelectorRegionLoader::LoadAround(World, CameraTransform.GetLocation(), GetDefault<UBDC_LevelSelectorUserSettings>()->OpenAtFavoriteLoadRadius);
+    if (bLoadedRegion)
+    {
+       const double EndTime = FPlatformTime::Seconds();
+       const int64 MemoryDelta = static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical) - static_cast<int64>(StartMemory);
+       UE_LOG(LogBDCLevelSelector, Log, TEXT("Opened %s at %s in %.1f ms, %.1f ms of them for the region after unloading %d restored regions. Physical memory changed by %+.1f MiB."),
+          *InItem->PackagePath, *FavoriteName.ToString(), (EndTime - StartTime) * 1000.0, (EndTime - LevelLoadedTime) * 1000.0, NumUnloaded,
+          MemoryDelta / (1024.0 * 1024.0));
+    }
+
+    for (FLevelEditorViewportClient* Client : GEditor->GetLevelViewportClients())
     {
-       FEditorFileUtils::LoadMap(InItem->AssetData.GetSoftObjectPath().ToString());
+       if (Client && Client->IsPerspective())
+       {
+          Client->SetViewLocation(CameraTransform.GetLocation());
+          Client->SetViewRotation(CameraTransform.GetRotation().Rotator());
+          Client->Invalidate();
+       }
     }
 }
 
@@ -447,26 +623,22 @@ TSharedRef<SWidget> SLevelSelectorComboBox::CreateSelectedItemWidget(const TShar
 
     const FSlateBrush* FinalBrush = DefaultLevelIcon;
     
-    const UBDC_LevelSelectorSettings* Settings = GetDefault<UBDC_LevelSelectorSettings>();
     FString TagString = TEXT("");
-    if (Settings)
+    if (!InItem->Tags.IsEmpty())
     {
-    	auto SoftLevel = TSoftObjectPtr<UWorld>(InItem->AssetData.GetSoftObjectPath());
-    	if (const FGameplayTag* FoundTag = Settings->LevelTags.Find(SoftLevel); FoundTag && FoundTag->IsValid())
-        {
-            FString TagName = FoundTag->ToString();
-            TArray<FString> TagParts;
-            TagName.ParseIntoArray(TagParts, TEXT("."), true);
+        FString TagName = InItem->Tags.First().ToString();
+        TArray<FString> TagParts;
+        TagName.ParseIntoArray(TagParts, TEXT("."), true);
 
-            if (TagParts.Num() > 2)
-            {
-                TagString = FString::Printf(TEXT(" (...%s.%s)"), *TagParts[TagParts.Num() - 2], *TagParts.Last());
-            }
-            else
-            {
-                TagString = FString::Printf(TEXT(" (%s)"), *TagName);
-            }
+        if (TagParts.Num() > 2)
+        {
+            TagName = FString::Printf(TEXT("...%s.%s"), *TagParts[TagParts.Num() - 2], *TagParts.Last());
+        }
+        if (InItem->Tags.Num() > 1)
+        {
+            TagName += FString::Printf(TEXT(" +%d"), InItem->Tags.Num() - 1);
         }
+        TagString = FString::Printf(TEXT(" (%s)"), *TagName);
     }
 
     const FString DisplayText = InItem->DisplayName + TagString;
@@ -514,190 +686,85 @@ TSharedRef<SWidget> SLevelSelectorComboBox::CreateSelectedItemWidget(const TShar
        ];
 }
 
-TSharedRef<SWidget> SLevelSelectorComboBox::CreateLevelItemWidget(const TSharedPtr<FLevelSelectorItem>& InItem)
+void SLevelSelectorComboBox::OnTagsChanged(const TSharedPtr<FLevelSelectorItem>& InItem, const FGameplayTagContainer& NewTags)
 {
     if (!InItem.IsValid())
     {
-       return SNew(STextBlock).Text(FText::FromString(TEXT("Invalid Level")));
+       return;
     }
 
-    const FSlateBrush* FinalBrush = DefaultLevelIcon;
+    // The dropdown stays open, several tags are usually picked in a row.
+    if (UBDC_LevelSelectorSettings* LocaleSettings = GetMutableDefault<UBDC_LevelSelectorSettings>())
+    {
+       const FSoftObjectPath LevelPath = InItem->AssetData.GetSoftObjectPath();
+       LevelIndex->UpdateItem(InItem, [&]()
+       {
+          LocaleSettings->SetLevelTags(LevelPath, NewTags);
+       });
 
-    return SNew(SHorizontalBox)
-       + SHorizontalBox::Slot()
-       .AutoWidth()
-       .VAlign(VAlign_Center)
-       [
-          SNew(SBox)
-          .WidthOverride(24)
-          .HeightOverride(24)
-          .HAlign(HAlign_Center)
-          .VAlign(VAlign_Center)
-          .Padding(0.0f, 2.0f)
-          [
-             SNew(SImage)
-             .Image(FinalBrush)
-          ]
-       ]
-       + SHorizontalBox::Slot()
-       .FillWidth(1.0)
-       .VAlign(VAlign_Center)
-       .MinWidth(200)
-       .Padding(4.0f, 2.0f)
-       [
-          SNew(STextBlock)
-          .Text(FText::FromString(InItem->DisplayName))
-          .Font(FAppStyle::GetFontStyle("PropertyWindow.NormalFont"))
-          .MinDesiredWidth(200)
-          .Clipping(EWidgetClipping::ClipToBounds)
-       ]
-       + SHorizontalBox::Slot()
-       .AutoWidth()
-       .HAlign(HAlign_Right)
-       .VAlign(VAlign_Center)
-       .Padding(4.0f, 0.0f, 0.0f, 0.0f)
-       .MaxWidth(200)
-       [
-          CreateTagSelectionWidget(InItem)
-       ]
-       + SHorizontalBox::Slot()
-       .AutoWidth()
-       .HAlign(HAlign_Right)
-       .VAlign(VAlign_Center)
-       .Padding(4.0f, 0.0f, 0.0f, 0.0f)
-       [
-          SNew(SBox)
-          .WidthOverride(18)
-          .HeightOverride(18)
-          [
-             SNew(SButton)
-             .ButtonStyle(FAppStyle::Get(), "NoBorder")
-             .OnClicked(FOnClicked::CreateLambda([this, Item = InItem]() mutable -> FReply
-             {
-                return OnShowInContentBrowserClicked(Item).Handled();
-             }))
-             .ContentPadding(2)
-             .ToolTipText(FText::FromString(TEXT("Show in Content Browser")))
-             [
-                SNew(SImage)
-                .Image(FAppStyle::GetBrush("SystemWideCommands.FindInContentBrowser"))
-                .ColorAndOpacity(FSlateColor::UseForeground())
-             ]
-          ]
-       ]
-       + SHorizontalBox::Slot()
-       .AutoWidth()
-       .HAlign(HAlign_Right)
-       .VAlign(VAlign_Center)
-       .Padding(4.0f, 0.0f, 0.0f, 0.0f)
-       [
-          SNew(SButton)
-          .ButtonStyle(FAppStyle::Get(), "NoBorder")
-          .OnClicked(FOnClicked::CreateLambda([this, Item = InItem]() -> FReply
-          {
-             const ECheckBoxState NewState = Item->IsFavorite() ? ECheckBoxState::Unchecked : ECheckBoxState::Checked;
-             OnFavoriteCheckboxChanged(NewState, Item);
-             return FReply::Handled();
-          }))
-          .ToolTipText(FText::FromString(TEXT("Add/Remove from favorites")))
-          .Content()
-          [
-             SNew(SImage)
-             .Image(InItem->IsFavorite() ? FavoriteIconBrush : UnfavoriteIconBrush)
-             .DesiredSizeOverride(FVector2D(24, 24))
-          ]
-       ];
-}
-
-TSharedRef<SWidget> SLevelSelectorComboBox::CreateTagSelectionWidget(const TSharedPtr<FLevelSelectorItem>& InItem)
-{
-    const FSoftObjectPath LevelPath(InItem->AssetData.GetSoftObjectPath());
-    UBDC_LevelSelectorSettings* Settings = GetMutableDefault<UBDC_LevelSelectorSettings>();
-
-	auto SoftLevel = TSoftObjectPtr<UWorld>(LevelPath);
-    const FGameplayTag* CurrentTag = Settings->LevelTags.Find(SoftLevel);
-
-    return SNew(SComboButton)
-       .ButtonContent()
-       [
-          SNew(STextBlock)
-          .Text(FText::FromString(CurrentTag ? CurrentTag->ToString() : TEXT("No Tag")))
-       ]
-       .MenuContent()
-       [
-          SNew(SBox)
-          .MaxDesiredHeight(400)
-          .WidthOverride(300)
-          [
-             SNew(SGameplayTagCombo)
-             .OnTagChanged_Lambda([this, Item = InItem](const FGameplayTag NewTag) mutable
-             {
-                OnTagChanged(Item, NewTag);
-             })
-             .Tag(CurrentTag ? *CurrentTag : FGameplayTag())
-             .Filter(FString())
-          ]
-       ];
+       EnsureSelectedCurrentLevel(true);
+    }
 }
 
-void SLevelSelectorComboBox::OnTagChanged(const TSharedPtr<FLevelSelectorItem>& InItem, FGameplayTag NewTag)
+void SLevelSelectorComboBox::OnFavoriteCheckboxChanged(ECheckBoxState NewState, TSharedPtr<FLevelSelectorItem> InItem)
 {
     if (!InItem.IsValid())
     {
        return;
     }
 
-    if (UBDC_LevelSelectorSettings* LocaleSettings = GetMutableDefault<UBDC_LevelSelectorSettings>())
+    if (UBDC_LevelSelectorSettings* Settings = GetMutableDefault<UBDC_LevelSelectorSettings>())
     {
-       if (UWorld* LevelObject = TSoftObjectPtr<UWorld>(InItem->AssetData.GetSoftObjectPath()).LoadSynchronous())
+       const FSoftObjectPath LevelPath = InItem->AssetData.GetSoftObjectPath();
+       LevelIndex->UpdateItem(InItem, [&]()
        {
-          LocaleSettings->SetLevelTag(LevelObject, NewTag);
-
-          PopulateLevelList();
+          if (NewState == ECheckBoxState::Checked) { Settings->AddFavorite(LevelPath); }
+          else { Settings->RemoveFavorite(LevelPath); }
+       });
 
-          if (LevelComboBox.IsValid() && LevelComboBox->IsOpen())
-          {
-             LevelComboBox->SetIsOpen(false);
-          }
-          EnsureSelectedCurrentLevel(true);
-       }
+       CloseMenu();
+       EnsureSelectedCurrentLevel(true);
     }
 }
 
-void SLevelSelectorComboBox::OnFavoriteCheckboxChanged(ECheckBoxState NewState, TSharedPtr<FLevelSelectorItem> InItem)
+void SLevelSelectorComboBox::HandleMapOpened(const FString& Filename, bool bAsTemplate)
 {
-    if (!InItem.IsValid())
+    // Only the opened level gets a new frecency key, the index reports it as updated and it moves to its new slot.
+    FString PackagePath = FPackageName::ObjectPathToPackageName(Filename);
+    if (!FPackageName::IsValidLongPackageName(PackagePath))
     {
-       return;
+        FPackageName::TryConvertFilenameToLongPackageName(Filename, PackagePath);
     }
-
-    const TSoftObjectPtr<UWorld> LevelSoftObjectPath(InItem->AssetData.GetSoftObjectPath());
-    if (UWorld* LevelObject = LevelSoftObjectPath.LoadSynchronous())
+    const FName PackageName(*PackagePath);
+    if (!bAsTemplate)
     {
-       if (UBDC_LevelSelectorSettings* Settings = GetMutableDefault<UBDC_LevelSelectorSettings>())
-       {
-          if (NewState == ECheckBoxState::Checked) { Settings->AddFavorite(LevelObject); }
-          else { Settings->RemoveFavorite(LevelObject); }
-
-          PopulateLevelList();
+        UBDC_LevelSelectorUserSettings* UserSettings = GetMutableDefault<UBDC_LevelSelectorUserSettings>();
+        TArray<FName> ForgottenPackages;
+        if (const TSharedPtr<FLevelSelectorItem> Item = LevelIndex->FindItem(PackageName))
+        {
+            LevelIndex->UpdateItem(Item, [UserSettings, PackageName, &ForgottenPackages]() { UserSettings->RecordLevelOpen(PackageName, &ForgottenPackages); });
+        }
+        else
+        {
+            UserSettings->RecordLevelOpen(PackageName, &ForgottenPackages);
+        }
 
-          if (LevelComboBox.IsValid() && LevelComboBox->IsOpen())
-          {
-             LevelComboBox->SetIsOpen(false);
-          }
-          EnsureSelectedCurrentLevel(true);
-       }
+        // Forgotten levels lost their key, the update re-reads it so they drop back to the unranked slots.
+        for (const FName ForgottenPackage : ForgottenPackages)
+        {
+            if (const TSharedPtr<FLevelSelectorItem> Item = LevelIndex->FindItem(ForgottenPackage))
+            {
+                LevelIndex->UpdateItem(Item, []() {});
+            }
+        }
     }
-}
 
-void SLevelSelectorComboBox::HandleMapOpened(const FString& Filename, bool bAsTemplate)
-{
     RefreshSelection(Filename, true);
 }
 
 FReply SLevelSelectorComboBox::OnRefreshButtonClicked()
 {
-    PopulateLevelList();
+    LevelIndex->Rescan();
     if (GEditor && GEditor->GetEditorWorldContext().World())
     {
        RefreshSelection(GEditor->GetEditorWorldContext().World()->GetPathName(), true);
@@ -714,110 +781,542 @@ FReply SLevelSelectorComboBox::OnShowInContentBrowserClicked(const TSharedPtr<FL
         AssetsToSelect.Add(InItem->AssetData);
         ContentBrowserModule.Get().SyncBrowserToAssets(AssetsToSelect);
 
-        if (LevelComboBox.IsValid())
-        {
-            LevelComboBox->SetIsOpen(false);
-        }
-
+        const_cast<SLevelSelectorComboBox*>(this)->CloseMenu();
         const_cast<SLevelSelectorComboBox*>(this)->EnsureSelectedCurrentLevel(true);
     }
     return FReply::Handled();
 }
 
-bool SLevelSelectorComboBox::IsHeaderItem(const TSharedPtr<FLevelSelectorItem>& InItem) const
+const FLevelSelectorTagIndex::FQuery& SLevelSelectorComboBox::GetTagQuery() const
+{
+    if (bTagQueryDirty || !LevelIndex->IsTagQueryCurrent(TagQuery))
+    {
+        TagQuery = LevelIndex->MakeTagQuery(SelectedFilterTags, TagMatch);
+        bTagQueryDirty = false;
+    }
+    return TagQuery;
+}
+
+void SLevelSelectorComboBox::ApplyFilters(bool bForceFullPass)
+{
+    LEVELSELECTOR_SCOPE_CYCLE_COUNTER(STAT_LevelSelector_ApplyFilters);
+    INC_DWORD_STAT(STAT_LevelSelector_FilterPasses);
+
+    if (!bForceFullPass && IsRefinementOfAppliedFilters())
+    {
+        RefineAppliedFilters();
+        return;
+    }
+
+    AppliedSearchFolded = SearchTextFolded;
+    AppliedFilterTags = SelectedFilterTags;
+    AppliedTagMatch = TagMatch;
+    bHasAppliedFilters = true;
+
+    LevelListSource.Reset();
+    LevelIndex->GetFilteredItems(SearchTextFolded, GetTagQuery(), LevelListSource);
+    if (bHideHeavyLevels)
+    {
+        LevelListSource.RemoveAll([this](const TSharedPtr<FLevelSelectorItem>& Item)
+        {
+            return IsHeavyLevel(*Item);
+        });
+    }
+    RequestMissingMetadata();
+    SortLevelListSource();
+
+    if (LevelListView.IsValid())
+    {
+        LevelListView->RequestListRefresh();
+    }
+    RefreshTree();
+}
+
+bool SLevelSelectorComboBox::IsRefinementOfAppliedFilters() const
 {
-    return HeaderItem.IsValid() && InItem == HeaderItem;
+    if (!bHasAppliedFilters)
+    {
+        return false;
+    }
+
+    // Every text containing the longer query also contains the applied one, so its survivors are a superset.
+    const bool bSearchNarrowed = UE::String::FindFirst(SearchTextFolded, AppliedSearchFolded, ESearchCase::CaseSensitive) != INDEX_NONE;
+    // More tags narrow an All filter down, fewer tags narrow an Any filter down.
+    bool bTagsNarrowed = AppliedFilterTags.IsEmpty() || (AppliedTagMatch == TagMatch && AppliedFilterTags == SelectedFilterTags);
+    if (!bTagsNarrowed && AppliedTagMatch == TagMatch && !SelectedFilterTags.IsEmpty())
+    {
+        bTagsNarrowed = TagMatch == ELevelSelectorTagMatch::All
+            ? SelectedFilterTags.HasAllExact(AppliedFilterTags)
+            : AppliedFilterTags.HasAllExact(SelectedFilterTags);
+    }
+    return bSearchNarrowed && bTagsNarrowed;
+}
+
+void SLevelSelectorComboBox::RefineAppliedFilters()
+{
+    const bool bChanged = AppliedSearchFolded != SearchTextFolded || AppliedFilterTags != SelectedFilterTags || AppliedTagMatch != TagMatch;
+    AppliedSearchFolded = SearchTextFolded;
+    AppliedFilterTags = SelectedFilterTags;
+    AppliedTagMatch = TagMatch;
+    if (!bChanged)
+    {
+        return;
+    }
+
+    LevelListSource.RemoveAll([this](const TSharedPtr<FLevelSelectorItem>& Item)
+    {
+        return !PassesFilters(Item);
+    });
+
+    if (LevelListView.IsValid())
+    {
+        LevelListView->RequestListRefresh();
+    }
+    RefreshTree();
 }
 
-FGameplayTag SLevelSelectorComboBox::GetItemTag(const TSharedPtr<FLevelSelectorItem>& InItem) const
+bool SLevelSelectorComboBox::PassesFilters(const TSharedPtr<FLevelSelectorItem>& InItem) const
 {
     if (!InItem.IsValid())
     {
-        return FGameplayTag();
+        return false;
     }
-    if (const UBDC_LevelSelectorSettings* Settings = GetDefault<UBDC_LevelSelectorSettings>())
+
+    if (!LevelIndex->MatchesSearch(*InItem, SearchTextFolded))
     {
-       auto SoftLevel = TSoftObjectPtr<UWorld>(InItem->AssetData.GetSoftObjectPath());
-       if (const FGameplayTag* Found = Settings->LevelTags.Find(SoftLevel))
-       {
-          return *Found;
-       }
+        return false;
     }
-    return FGameplayTag();
+
+    if (bHideHeavyLevels && IsHeavyLevel(*InItem))
+    {
+        return false;
+    }
+
+    return LevelIndex->MatchesTags(*InItem, GetTagQuery());
 }
 
-void SLevelSelectorComboBox::ApplyFilters()
+bool SLevelSelectorComboBox::IsHeavyLevel(const FLevelSelectorItem& InItem) const
 {
-    const FString SearchLower = SearchTextFilter.ToString().ToLower();
+    const int64 HeavyThreshold = static_cast<int64>(GetDefault<UBDC_LevelSelectorUserSettings>()->HeavyLevelThresholdMB) * 1024 * 1024;
+    const FLevelPackageMetadata* Metadata = MetadataCache.IsValid() ? MetadataCache->Find(InItem.PackageName) : nullptr;
+    return Metadata && HeavyThreshold > 0 && Metadata->GetTotalSize() > HeavyThreshold;
+}
 
-    LevelListSource.Empty();
-	
-    if (HeaderItem.IsValid())
+void SLevelSelectorComboBox::InsertFiltered(const TSharedPtr<FLevelSelectorItem>& InItem)
+{
+    const int32 InsertIndex = Algo::LowerBound(LevelListSource, InItem, [this](const TSharedPtr<FLevelSelectorItem>& A, const TSharedPtr<FLevelSelectorItem>& B)
+    {
+        return CompareListItems(A, B);
+    });
+    LevelListSource.Insert(InItem, InsertIndex);
+
+    if (NeedsMetadata() && !MetadataCache->Find(InItem->PackageName))
+    {
+        MetadataCache->Request(InItem->PackageName);
+    }
+}
+
+void SLevelSelectorComboBox::MergeFiltered(TArray<TSharedPtr<FLevelSelectorItem>>& InItems)
+{
+    if (NeedsMetadata())
     {
-        LevelListSource.Add(HeaderItem);
+        for (const TSharedPtr<FLevelSelectorItem>& Item : InItems)
+        {
+            if (!MetadataCache->Find(Item->PackageName))
+            {
+                MetadataCache->Request(Item->PackageName);
+            }
+        }
     }
 
-    for (const TSharedPtr<FLevelSelectorItem>& Item : AllLevels)
+    const auto Compare = [this](const TSharedPtr<FLevelSelectorItem>& A, const TSharedPtr<FLevelSelectorItem>& B)
     {
-        if (!Item.IsValid()) continue;
+        return CompareListItems(A, B);
+    };
+    Algo::Sort(InItems, Compare);
+    FLevelSelectorIndex::MergeSorted(LevelListSource, InItems, Compare);
+}
 
-        bool bPassSearch = true;
-        if (!SearchLower.IsEmpty())
+bool SLevelSelectorComboBox::CompareListItems(const TSharedPtr<FLevelSelectorItem>& A, const TSharedPtr<FLevelSelectorItem>& B) const
+{
+    if (SortMode == ELevelSelectorSortMode::Frecency && A->IsFavorite() == B->IsFavorite() && A->FrecencyKey != B->FrecencyKey)
+    {
+        return A->FrecencyKey > B->FrecencyKey;
+    }
+    if (SortMode == ELevelSelectorSortMode::DiskSize && MetadataCache.IsValid() && A->IsFavorite() == B->IsFavorite())
+    {
+        const FLevelPackageMetadata* MetadataA = MetadataCache->Find(A->PackageName);
+        const FLevelPackageMetadata* MetadataB = MetadataCache->Find(B->PackageName);
+        const int64 SizeA = MetadataA ? MetadataA->GetTotalSize() : -1;
+        const int64 SizeB = MetadataB ? MetadataB->GetTotalSize() : -1;
+        if (SizeA != SizeB)
         {
-            bPassSearch = Item->DisplayName.ToLower().Contains(SearchLower);
+            return SizeA > SizeB;
         }
+    }
+    if (SortMode == ELevelSelectorSortMode::OpenTime && SwitchTelemetry.IsValid() && A->IsFavorite() == B->IsFavorite())
+    {
+        const float MedianA = SwitchTelemetry->GetMedianMs(A->PackageName);
+        const float MedianB = SwitchTelemetry->GetMedianMs(B->PackageName);
+        if (MedianA != MedianB)
+        {
+            return MedianA > MedianB;
+        }
+    }
+    return FLevelSelectorIndex::CompareItems(A, B);
+}
 
-        bool bPassTag = true;
-        if (SelectedFilterTag.IsValid())
+void SLevelSelectorComboBox::RequestMissingMetadata()
+{
+    // Sizes are only known for levels that were measured, the rest is collected in the background and resorted on arrival.
+    // Levels the cache already knows are left alone, it re-queues them by itself once they were saved.
+    if (!NeedsMetadata())
+    {
+        return;
+    }
+    for (const TSharedPtr<FLevelSelectorItem>& Item : LevelListSource)
+    {
+        if (!MetadataCache->Find(Item->PackageName))
         {
-            bPassTag = GetItemTag(Item) == SelectedFilterTag;
+            MetadataCache->Request(Item->PackageName);
         }
+    }
+}
+
+bool SLevelSelectorComboBox::NeedsMetadata() const
+{
+    return MetadataCache.IsValid() && (SortMode == ELevelSelectorSortMode::DiskSize || bHideHeavyLevels);
+}
+
+void SLevelSelectorComboBox::SortLevelListSource()
+{
+    // The index hands out items in name order already.
+    if (SortMode != ELevelSelectorSortMode::Name)
+    {
+        Algo::Sort(LevelListSource, [this](const TSharedPtr<FLevelSelectorItem>& A, const TSharedPtr<FLevelSelectorItem>& B)
+        {
+            return CompareListItems(A, B);
+        });
+    }
+}
+
+TSharedRef<SWidget> SLevelSelectorComboBox::CreateSortMenuContent()
+{
+    const UEnum* SortModeEnum = StaticEnum<ELevelSelectorSortMode>();
+    TSharedRef<SVerticalBox> Menu = SNew(SVerticalBox);
+    for (int32 EnumIndex = 0; EnumIndex < SortModeEnum->NumEnums() - 1; ++EnumIndex)
+    {
+        const ELevelSelectorSortMode Mode = static_cast<ELevelSelectorSortMode>(SortModeEnum->GetValueByIndex(EnumIndex));
+        Menu->AddSlot()
+        .AutoHeight()
+        .Padding(FMargin(8.0f, 2.0f))
+        [
+            SNew(SCheckBox)
+            .Style(FAppStyle::Get(), "RadioButton")
+            .IsChecked_Lambda([this, Mode]()
+            {
+                return SortMode == Mode ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+            })
+            .OnCheckStateChanged_Lambda([this, Mode](ECheckBoxState)
+            {
+                SetSortMode(Mode);
+            })
+            .ToolTipText(SortModeEnum->GetToolTipTextByIndex(EnumIndex))
+            [
+                SNew(STextBlock).Text(SortModeEnum->GetDisplayNameTextByIndex(EnumIndex))
+            ]
+        ];
+    }
+
+    Menu->AddSlot()
+    .AutoHeight()
+    .Padding(FMargin(8.0f, 2.0f))
+    [
+        SNew(SSeparator)
+    ];
+    Menu->AddSlot()
+    .AutoHeight()
+    .Padding(FMargin(8.0f, 2.0f))
+    [
+        SNew(SCheckBox)
+        .IsChecked_Lambda([this]()
+        {
+            return bHideHeavyLevels ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+        })
+        .OnCheckStateChanged_Lambda([this](ECheckBoxState NewState)
+        {
+            SetHideHeavyLevels(NewState == ECheckBoxState::Checked);
+        })
+        .ToolTipText(FText::FromString(TEXT("Leave levels above the heavy level threshold of the user settings out of the list")))
+        [
+            SNew(STextBlock).Text(FText::FromString(TEXT("Hide heavy levels")))
+        ]
+    ];
+    return Menu;
+}
+
+void SLevelSelectorComboBox::SetHideHeavyLevels(bool bInHideHeavyLevels)
+{
+    if (bHideHeavyLevels == bInHideHeavyLevels)
+    {
+        return;
+    }
+    bHideHeavyLevels = bInHideHeavyLevels;
+
+    UBDC_LevelSelectorUserSettings* UserSettings = GetMutableDefault<UBDC_LevelSelectorUserSettings>();
+    UserSettings->bHideHeavyLevels = bInHideHeavyLevels;
+    UserSettings->RequestConfigSave();
+
+    ApplyFilters(true);
+}
+
+void SLevelSelectorComboBox::SetSortMode(ELevelSelectorSortMode InSortMode)
+{
+    if (SortMode == InSortMode)
+    {
+        return;
+    }
+    SortMode = InSortMode;
+
+    UBDC_LevelSelectorUserSettings* UserSettings = GetMutableDefault<UBDC_LevelSelectorUserSettings>();
+    UserSettings->SortMode = InSortMode;
+    UserSettings->RequestConfigSave();
+
+    ApplyFilters(true);
+}
+
+void SLevelSelectorComboBox::HandleSwitchRecorded(FName PackageName)
+{
+    // Only the switched level's median changed, it moves to its new slot and the rest of the list stays sorted.
+    if (SortMode != ELevelSelectorSortMode::OpenTime || !LevelIndex.IsValid())
+    {
+        return;
+    }
 
-        if (bPassSearch && bPassTag)
+    const TSharedPtr<FLevelSelectorItem> Item = LevelIndex->FindItem(PackageName);
+    if (Item.IsValid() && LevelListSource.RemoveSingle(Item) > 0)
+    {
+        InsertFiltered(Item);
+        if (LevelListView.IsValid())
         {
-            LevelListSource.Add(Item);
+            LevelListView->RequestListRefresh();
         }
     }
+}
 
-    if (LevelComboBox.IsValid())
+void SLevelSelectorComboBox::HandleMetadataUpdated()
+{
+    // Sizes change the order, and with heavy levels hidden which levels pass. Batches arriving within the interval share one pass.
+    if (NeedsMetadata() && !MetadataResortTickerHandle.IsValid())
     {
-        LevelComboBox->RefreshOptions();
+        MetadataResortTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &SLevelSelectorComboBox::OnMetadataResortTick), 0.5f);
     }
 }
 
+bool SLevelSelectorComboBox::OnMetadataResortTick(float DeltaTime)
+{
+    MetadataResortTickerHandle.Reset();
+    if (bHideHeavyLevels)
+    {
+        ApplyFilters(true);
+    }
+    else if (SortMode == ELevelSelectorSortMode::DiskSize)
+    {
+        SortLevelListSource();
+        if (LevelListView.IsValid())
+        {
+            LevelListView->RequestListRefresh();
+        }
+    }
+    return false;
+}
+
 void SLevelSelectorComboBox::OnSearchTextChanged(const FText& InText)
 {
+    const double FilterStart = FPlatformTime::Seconds();
     SearchTextFilter = InText;
+    SearchTextFolded = FLevelSelectorSearchIndex::Fold(InText.ToString());
     ApplyFilters();
+    FLevelSelectorFilterLatency::Record((FPlatformTime::Seconds() - FilterStart) * 1000.0);
 }
 
 void SLevelSelectorComboBox::OnSearchTextCommitted(const FText& InText, ETextCommit::Type CommitType)
 {
+    // OnSearchTextChanged already filtered for this text, committing it must not filter a second time.
+    FString Folded = FLevelSelectorSearchIndex::Fold(InText.ToString());
+    if (Folded == SearchTextFolded)
+    {
+        return;
+    }
+
     SearchTextFilter = InText;
+    SearchTextFolded = MoveTemp(Folded);
     ApplyFilters();
 }
 
-void SLevelSelectorComboBox::OnFilterTagChanged(FGameplayTag InTag)
+void SLevelSelectorComboBox::OnFilterTagsChanged(const FGameplayTagContainer& InTags)
 {
-    SelectedFilterTag = InTag;
+    SelectedFilterTags = InTags;
+    bTagQueryDirty = true;
     ApplyFilters();
 }
 
+FReply SLevelSelectorComboBox::OnTagMatchClicked()
+{
+    TagMatch = TagMatch == ELevelSelectorTagMatch::Any ? ELevelSelectorTagMatch::All : ELevelSelectorTagMatch::Any;
+    bTagQueryDirty = true;
+    ApplyFilters();
+    return FReply::Handled();
+}
+
+FText SLevelSelectorComboBox::GetTagMatchText() const
+{
+    return FText::FromString(TagMatch == ELevelSelectorTagMatch::All ? TEXT("All") : TEXT("Any"));
+}
+
 FReply SLevelSelectorComboBox::OnClearFilterClicked()
 {
     SearchTextFilter = FText::GetEmpty();
-    SelectedFilterTag = FGameplayTag();
+    SearchTextFolded.Reset();
+    SelectedFilterTags.Reset();
+    bTagQueryDirty = true;
 
     if (SearchTextBoxWidget.IsValid())
     {
         SearchTextBoxWidget->SetText(SearchTextFilter);
     }
-    if (FilterTagComboWidget.IsValid())
-    {
-    	
-    }
 
     ApplyFilters();
     return FReply::Handled();
 }
 
+TSharedRef<ITableRow> SLevelSelectorComboBox::OnGenerateTreeRow(TSharedPtr<FLevelSelectorTreeNode> InNode, const TSharedRef<STableViewBase>& OwnerTable)
+{
+    LEVELSELECTOR_SCOPE_CYCLE_COUNTER(STAT_LevelSelector_GenerateRow);
+    INC_DWORD_STAT(STAT_LevelSelector_RowsGenerated);
+
+    return SNew(SLevelSelectorTreeRow, OwnerTable)
+        .Node(InNode)
+        .LevelIcon(DefaultLevelIcon)
+        .FavoriteIcon(FavoriteIconBrush);
+}
+
+void SLevelSelectorComboBox::OnGetTreeChildren(TSharedPtr<FLevelSelectorTreeNode> InNode, TArray<TSharedPtr<FLevelSelectorTreeNode>>& OutChildren)
+{
+    if (InNode->IsFolder())
+    {
+        TreeFilter.GetVisibleChildren(*InNode, OutChildren);
+    }
+}
+
+void SLevelSelectorComboBox::OnTreeSelectionChanged(TSharedPtr<FLevelSelectorTreeNode> InNode, ESelectInfo::Type SelectInfo)
+{
+    if (!InNode.IsValid() || (SelectInfo != ESelectInfo::OnMouseClick && SelectInfo != ESelectInfo::OnKeyPress))
+    {
+        return;
+    }
+
+    if (InNode->IsFolder())
+    {
+        LevelTreeView->SetItemExpansion(InNode, !LevelTreeView->IsItemExpanded(InNode));
+        return;
+    }
+    OpenLevel(InNode->Level);
+}
+
+void SLevelSelectorComboBox::SetShowFolderTree(bool bInShowFolderTree)
+{
+    if (bShowFolderTree == bInShowFolderTree)
+    {
+        return;
+    }
+    bShowFolderTree = bInShowFolderTree;
+
+    UBDC_LevelSelectorUserSettings* UserSettings = GetMutableDefault<UBDC_LevelSelectorUserSettings>();
+    UserSettings->bShowFolderTree = bInShowFolderTree;
+    UserSettings->RequestConfigSave();
+
+    if (bShowFolderTree)
+    {
+        EnsurePathTrie();
+        RefreshTree();
+        EnsureSelectedCurrentLevel(false);
+    }
+}
+
+void SLevelSelectorComboBox::EnsurePathTrie()
+{
+    if (!PathTrie.IsValid())
+    {
+        PathTrie = MakeShared<FLevelSelectorPathTrie>();
+        PathTrie->Build(LevelIndex->GetSortedItems());
+    }
+}
+
+void SLevelSelectorComboBox::RefreshTree()
+{
+    if (!bShowFolderTree || !PathTrie.IsValid())
+    {
+        return;
+    }
+    LEVELSELECTOR_SCOPE_CYCLE_COUNTER(STAT_LevelSelector_FilterTree);
+
+    // LevelListSource holds the levels matching on their own, folders matching the search add their whole subtree.
+    const bool bTagsActive = !SelectedFilterTags.IsEmpty();
+    if (!SearchTextFolded.IsEmpty() || bTagsActive || bHideHeavyLevels)
+    {
+        TFunction<bool(const FLevelSelectorItem&)> LevelFilter;
+        if (bTagsActive || bHideHeavyLevels)
+        {
+            LevelFilter = [this, bTagsActive](const FLevelSelectorItem& Item)
+            {
+                return (!bHideHeavyLevels || !IsHeavyLevel(Item)) && (!bTagsActive || LevelIndex->MatchesTags(Item, GetTagQuery()));
+            };
+        }
+        PathTrie->Filter(SearchTextFolded, LevelListSource, LevelFilter, TreeFilter);
+    }
+    else
+    {
+        TreeFilter.Reset();
+    }
+
+    TreeRootItems.Reset();
+    for (const TSharedPtr<FLevelSelectorTreeNode>& Folder : PathTrie->GetRootFolders())
+    {
+        if (!TreeFilter.bActive || TreeFilter.VisibleFolders.Contains(Folder.Get()) || TreeFilter.MatchedFolders.Contains(Folder.Get()))
+        {
+            TreeRootItems.Add(Folder);
+        }
+    }
+
+    if (LevelTreeView.IsValid())
+    {
+        for (FLevelSelectorTreeNode* Folder : TreeFilter.VisibleFolders)
+        {
+            LevelTreeView->SetItemExpansion(Folder->AsShared(), true);
+        }
+        LevelTreeView->RequestTreeRefresh();
+    }
+}
+
+void SLevelSelectorComboBox::RevealInTree(const FLevelSelectorItem& InItem)
+{
+    if (!bShowFolderTree || !PathTrie.IsValid() || !LevelTreeView.IsValid())
+    {
+        return;
+    }
+
+    const TSharedPtr<FLevelSelectorTreeNode> Node = PathTrie->FindLevelNode(InItem);
+    if (!Node.IsValid() || (TreeFilter.bActive && !TreeFilter.VisibleLevels.Contains(&InItem) && !TreeFilter.IsInMatchedFolder(*Node)))
+    {
+        return;
+    }
+
+    // The root node has no parent and is never shown itself.
+    for (FLevelSelectorTreeNode* Folder = Node->Parent; Folder && Folder->Parent; Folder = Folder->Parent)
+    {
+        LevelTreeView->SetItemExpansion(Folder->AsShared(), true);
+    }
+    LevelTreeView->SetSelection(Node, ESelectInfo::Direct);
+    LevelTreeView->RequestScrollIntoView(Node);
+}
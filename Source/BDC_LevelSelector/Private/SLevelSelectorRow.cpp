@@ -0,0 +1,498 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "SLevelSelectorRow.h"
+#include "BDC_LevelSelectorSettings.h"
+#include "BDC_LevelSelectorUserSettings.h"
+#include "LevelSelectorMetadataCache.h"
+#include "LevelSelectorSwitchTelemetry.h"
+#include "LevelSelectorThumbnailCache.h"
+#include "SGameplayTagContainerCombo.h"
+#include "Framework/MultiBox/MultiBoxBuilder.h"
+#include "Styling/AppStyle.h"
+#include "Widgets/SBoxPanel.h"
+#include "Widgets/Images/SImage.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SComboButton.h"
+#include "Widgets/Input/SNumericEntryBox.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Text/STextBlock.h"
+
+void SLevelSelectorRow::Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTable)
+{
+	LevelIcon = InArgs._LevelIcon;
+	FavoriteIcon = InArgs._FavoriteIcon;
+	UnfavoriteIcon = InArgs._UnfavoriteIcon;
+	SwitchTelemetry = InArgs._SwitchTelemetry;
+	MetadataCache = InArgs._MetadataCache;
+	ThumbnailCache = InArgs._ThumbnailCache;
+	OnToggleFavorite = InArgs._OnToggleFavorite;
+	OnShowInContentBrowser = InArgs._OnShowInContentBrowser;
+	OnTagsChanged = InArgs._OnTagsChanged;
+	OnOpenAtFavorite = InArgs._OnOpenAtFavorite;
+	OnHovered = InArgs._OnHovered;
+	OnUnhovered = InArgs._OnUnhovered;
+	SetItem(InArgs._Item);
+
+	STableRow::Construct(
+		STableRow::FArguments()
+		.Padding(FMargin(0.0f, 1.0f))
+		.Content()
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			[
+				SNew(SBox)
+				.WidthOverride(32)
+				.HeightOverride(32)
+				.HAlign(HAlign_Center)
+				.VAlign(VAlign_Center)
+				.Padding(0.0f, 2.0f)
+				[
+					SNew(SImage)
+					.Image(this, &SLevelSelectorRow::GetLevelIconBrush)
+				]
+			]
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0)
+			.VAlign(VAlign_Center)
+			.MinWidth(200)
+			.Padding(4.0f, 2.0f)
+			[
+				SNew(STextBlock)
+				.Text(this, &SLevelSelectorRow::GetDisplayNameText)
+				.Font(FAppStyle::GetFontStyle("PropertyWindow.NormalFont"))
+				.MinDesiredWidth(200)
+				.Clipping(EWidgetClipping::ClipToBounds)
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.HAlign(HAlign_Right)
+			.VAlign(VAlign_Center)
+			.Padding(4.0f, 0.0f, 0.0f, 0.0f)
+			[
+				SNew(STextBlock)
+				.Text(this, &SLevelSelectorRow::GetMetadataText)
+				.ToolTipText(this, &SLevelSelectorRow::GetMetadataToolTipText)
+				.Font(FAppStyle::GetFontStyle("SmallFont"))
+				.ColorAndOpacity(this, &SLevelSelectorRow::GetMetadataColor)
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.HAlign(HAlign_Right)
+			.VAlign(VAlign_Center)
+			.Padding(4.0f, 0.0f, 0.0f, 0.0f)
+			[
+				SNew(STextBlock)
+				.Text(this, &SLevelSelectorRow::GetOpenTimeText)
+				.ToolTipText(this, &SLevelSelectorRow::GetOpenTimeToolTipText)
+				.Visibility(this, &SLevelSelectorRow::GetOpenTimeVisibility)
+				.Font(FAppStyle::GetFontStyle("SmallFont"))
+				.ColorAndOpacity(FSlateColor::UseSubduedForeground())
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.HAlign(HAlign_Right)
+			.VAlign(VAlign_Center)
+			.Padding(4.0f, 0.0f, 0.0f, 0.0f)
+			.MaxWidth(200)
+			[
+				SAssignNew(TagComboButton, SComboButton)
+				.OnGetMenuContent(this, &SLevelSelectorRow::OnGetTagMenuContent)
+				.ButtonContent()
+				[
+					SNew(STextBlock)
+					.Text(this, &SLevelSelectorRow::GetTagText)
+				]
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.HAlign(HAlign_Right)
+			.VAlign(VAlign_Center)
+			.Padding(4.0f, 0.0f, 0.0f, 0.0f)
+			[
+				SAssignNew(OpenAtFavoriteComboButton, SComboButton)
+				.ComboButtonStyle(FAppStyle::Get(), "SimpleComboButton")
+				.HasDownArrow(false)
+				.Visibility(this, &SLevelSelectorRow::GetOpenAtFavoriteVisibility)
+				.OnGetMenuContent(this, &SLevelSelectorRow::OnGetOpenAtFavoriteMenuContent)
+				.ToolTipText(FText::FromString(TEXT("Open at camera favorite")))
+				.ButtonContent()
+				[
+					SNew(SImage)
+					.Image(FAppStyle::GetBrush("ClassIcon.CameraActor"))
+					.ColorAndOpacity(FSlateColor::UseForeground())
+					.DesiredSizeOverride(FVector2D(14, 14))
+				]
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.HAlign(HAlign_Right)
+			.VAlign(VAlign_Center)
+			.Padding(4.0f, 0.0f, 0.0f, 0.0f)
+			[
+				SNew(SBox)
+				.WidthOverride(18)
+				.HeightOverride(18)
+				[
+					SNew(SButton)
+					.ButtonStyle(FAppStyle::Get(), "NoBorder")
+					.OnClicked(this, &SLevelSelectorRow::OnShowInContentBrowserClicked)
+					.ContentPadding(2)
+					.ToolTipText(FText::FromString(TEXT("Show in Content Browser")))
+					[
+						SNew(SImage)
+						.Image(FAppStyle::GetBrush("SystemWideCommands.FindInContentBrowser"))
+						.ColorAndOpacity(FSlateColor::UseForeground())
+					]
+				]
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.HAlign(HAlign_Right)
+			.VAlign(VAlign_Center)
+			.Padding(4.0f, 0.0f, 0.0f, 0.0f)
+			[
+				SNew(SButton)
+				.ButtonStyle(FAppStyle::Get(), "NoBorder")
+				.OnClicked(this, &SLevelSelectorRow::OnFavoriteClicked)
+				.ToolTipText(FText::FromString(TEXT("Add/Remove from favorites")))
+				.Content()
+				[
+					SNew(SImage)
+					.Image(this, &SLevelSelectorRow::GetFavoriteBrush)
+					.DesiredSizeOverride(FVector2D(24, 24))
+				]
+			]
+		],
+		InOwnerTable);
+}
+
+void SLevelSelectorRow::SetItem(const TSharedPtr<FLevelSelectorItem>& InItem)
+{
+	Item = InItem;
+	DisplayNameText = Item.IsValid() ? FText::FromString(Item->DisplayName) : FText::GetEmpty();
+	CachedTags.Reset();
+	CachedTagText = FText::FromString(TEXT("No Tag"));
+	CachedTelemetryRevision = MAX_uint32;
+	CachedMetadataRevision = MAX_uint32;
+	if (MetadataCache.IsValid() && Item.IsValid())
+	{
+		MetadataCache->Request(Item->PackageName);
+	}
+
+	// A picker left open by the previous item must not edit the new one.
+	if (TagComboButton.IsValid() && TagComboButton->IsOpen())
+	{
+		TagComboButton->SetIsOpen(false);
+	}
+	if (OpenAtFavoriteComboButton.IsValid() && OpenAtFavoriteComboButton->IsOpen())
+	{
+		OpenAtFavoriteComboButton->SetIsOpen(false);
+	}
+}
+
+void SLevelSelectorRow::OnMouseEnter(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	STableRow::OnMouseEnter(MyGeometry, MouseEvent);
+	if (Item.IsValid())
+	{
+		OnHovered.ExecuteIfBound(Item);
+	}
+}
+
+void SLevelSelectorRow::OnMouseLeave(const FPointerEvent& MouseEvent)
+{
+	STableRow::OnMouseLeave(MouseEvent);
+	OnUnhovered.ExecuteIfBound();
+}
+
+FText SLevelSelectorRow::GetDisplayNameText() const
+{
+	return DisplayNameText;
+}
+
+const FSlateBrush* SLevelSelectorRow::GetLevelIconBrush() const
+{
+	// Asking while painting means only rows on screen ever queue a thumbnail.
+	const FSlateBrush* Thumbnail = ThumbnailCache.IsValid() && Item.IsValid() ? ThumbnailCache->GetThumbnail(Item->PackageName) : nullptr;
+	return Thumbnail ? Thumbnail : LevelIcon;
+}
+
+FText SLevelSelectorRow::GetTagText() const
+{
+	const FGameplayTagContainer& Tags = Item.IsValid() ? Item->Tags : FGameplayTagContainer::EmptyContainer;
+	if (Tags != CachedTags)
+	{
+		CachedTags = Tags;
+		if (Tags.IsEmpty())
+		{
+			CachedTagText = FText::FromString(TEXT("No Tag"));
+		}
+		else if (Tags.Num() == 1)
+		{
+			CachedTagText = FText::FromString(Tags.First().ToString());
+		}
+		else
+		{
+			CachedTagText = FText::FromString(FString::Printf(TEXT("%s +%d"), *Tags.First().ToString(), Tags.Num() - 1));
+		}
+	}
+	return CachedTagText;
+}
+
+FText SLevelSelectorRow::GetOpenTimeText() const
+{
+	UpdateOpenTimeTexts();
+	return CachedOpenTimeText;
+}
+
+FText SLevelSelectorRow::GetOpenTimeToolTipText() const
+{
+	UpdateOpenTimeTexts();
+	return CachedOpenTimeToolTipText;
+}
+
+EVisibility SLevelSelectorRow::GetOpenTimeVisibility() const
+{
+	UpdateOpenTimeTexts();
+	return CachedOpenTimeText.IsEmpty() ? EVisibility::Collapsed : EVisibility::Visible;
+}
+
+void SLevelSelectorRow::UpdateOpenTimeTexts() const
+{
+	const uint32 Revision = SwitchTelemetry.IsValid() ? SwitchTelemetry->GetRevision() : 0;
+	if (Revision == CachedTelemetryRevision)
+	{
+		return;
+	}
+	CachedTelemetryRevision = Revision;
+
+	const FLevelSwitchHistory* History = SwitchTelemetry.IsValid() && Item.IsValid() ? SwitchTelemetry->FindHistory(Item->PackageName) : nullptr;
+	if (!History || History->Samples.IsEmpty())
+	{
+		CachedOpenTimeText = FText::GetEmpty();
+		CachedOpenTimeToolTipText = FText::GetEmpty();
+		return;
+	}
+
+	FNumberFormattingOptions Seconds;
+	Seconds.SetMinimumFractionalDigits(1).SetMaximumFractionalDigits(1);
+	const FText Median = FText::AsNumber(History->MedianMs / 1000.0f, &Seconds);
+	const FText P95 = FText::AsNumber(History->P95Ms / 1000.0f, &Seconds);
+	CachedOpenTimeText = FText::Format(FText::FromString(TEXT("{0}s / {1}s")), Median, P95);
+	CachedOpenTimeToolTipText = FText::Format(FText::FromString(TEXT("Opens in {0}s (median), {1}s (p95) over the last {2} switches")),
+		Median, P95, FText::AsNumber(History->Samples.Num()));
+}
+
+FText SLevelSelectorRow::GetMetadataText() const
+{
+	UpdateMetadataTexts();
+	return CachedMetadataText;
+}
+
+FText SLevelSelectorRow::GetMetadataToolTipText() const
+{
+	UpdateMetadataTexts();
+	return CachedMetadataToolTipText;
+}
+
+FSlateColor SLevelSelectorRow::GetMetadataColor() const
+{
+	UpdateMetadataTexts();
+	return bCachedIsHeavy ? FAppStyle::GetSlateColor("Colors.Warning") : FSlateColor::UseSubduedForeground();
+}
+
+void SLevelSelectorRow::UpdateMetadataTexts() const
+{
+	const uint32 Revision = MetadataCache.IsValid() ? MetadataCache->GetRevision() : 0;
+	if (Revision == CachedMetadataRevision)
+	{
+		return;
+	}
+	CachedMetadataRevision = Revision;
+
+	const FLevelPackageMetadata* Metadata = MetadataCache.IsValid() && Item.IsValid() ? MetadataCache->Find(Item->PackageName) : nullptr;
+	if (!Metadata)
+	{
+		CachedMetadataText = FText::GetEmpty();
+		CachedMetadataToolTipText = FText::GetEmpty();
+		bCachedIsHeavy = false;
+		return;
+	}
+
+	const int64 HeavyThreshold = static_cast<int64>(GetDefault<UBDC_LevelSelectorUserSettings>()->HeavyLevelThresholdMB) * 1024 * 1024;
+	bCachedIsHeavy = HeavyThreshold > 0 && Metadata->GetTotalSize() > HeavyThreshold;
+
+	const FText TotalSize = FText::AsMemory(Metadata->GetTotalSize());
+	const FText ModifiedDate = FText::AsDate(Metadata->LastModified, EDateTimeStyle::Short);
+	CachedMetadataText = Metadata->ExternalActorCount > 0
+		? FText::Format(FText::FromString(TEXT("{0}, {1} actors, {2}")), TotalSize, FText::AsNumber(Metadata->ExternalActorCount), ModifiedDate)
+		: FText::Format(FText::FromString(TEXT("{0}, {1}")), TotalSize, ModifiedDate);
+	CachedMetadataToolTipText = FText::Format(
+		FText::FromString(TEXT("Map {0}, {1} external actor packages ({2}), last modified {3}{4}")),
+		FText::AsMemory(Metadata->MapFileSize), FText::AsNumber(Metadata->ExternalActorCount), FText::AsMemory(Metadata->ExternalActorBytes),
+		FText::AsDateTime(Metadata->LastModified, EDateTimeStyle::Short, EDateTimeStyle::Short), bCachedIsHeavy ? FText::FromString(TEXT("\nHeavy level, opening it takes a while")) : FText::GetEmpty());
+}
+
+const FSlateBrush* SLevelSelectorRow::GetFavoriteBrush() const
+{
+	return Item.IsValid() && Item->IsFavorite() ? FavoriteIcon : UnfavoriteIcon;
+}
+
+FReply SLevelSelectorRow::OnFavoriteClicked()
+{
+	OnToggleFavorite.ExecuteIfBound(Item);
+	return FReply::Handled();
+}
+
+FReply SLevelSelectorRow::OnShowInContentBrowserClicked()
+{
+	OnShowInContentBrowser.ExecuteIfBound(Item);
+	return FReply::Handled();
+}
+
+TSharedRef<SWidget> SLevelSelectorRow::OnGetTagMenuContent()
+{
+	if (!Item.IsValid())
+	{
+		return SNullWidget::NullWidget;
+	}
+
+	return SNew(SBox)
+		.MaxDesiredHeight(400)
+		.WidthOverride(300)
+		[
+			SNew(SGameplayTagContainerCombo)
+			.OnTagContainerChanged_Lambda([this, BoundItem = Item](const FGameplayTagContainer& NewTags)
+			{
+				OnTagsChanged.ExecuteIfBound(BoundItem, NewTags);
+			})
+			.TagContainer_Lambda([BoundItem = Item]()
+			{
+				return BoundItem->Tags;
+			})
+			.Filter(FString())
+		];
+}
+
+EVisibility SLevelSelectorRow::GetOpenAtFavoriteVisibility() const
+{
+	// Cached on the item from one listing of the favorites folder, painting never reads a favorites file.
+	return OnOpenAtFavorite.IsBound() && Item.IsValid() && Item->bHasCameraFavorites ? EVisibility::Visible : EVisibility::Collapsed;
+}
+
+TSharedRef<SWidget> SLevelSelectorRow::OnGetOpenAtFavoriteMenuContent()
+{
+	const FCameraFavorite* Favorites = Item.IsValid() ? GetDefault<UBDC_LevelSelectorSettings>()->FindCameraFavorites(Item->AssetData.GetSoftObjectPath()) : nullptr;
+	if (!Favorites)
+	{
+		return SNullWidget::NullWidget;
+	}
+
+	// Copied, submenus are built after this returns and the store may have changed by then.
+	TArray<TPair<FName, FVector>> Entries;
+	for (const auto& Pair : Favorites->HoldFavorites)
+	{
+		Entries.Emplace(Pair.Key, Pair.Value.GetLocation());
+	}
+	Entries.Sort([](const TPair<FName, FVector>& A, const TPair<FName, FVector>& B) { return A.Key.LexicalLess(B.Key); });
+
+	FMenuBuilder MenuBuilder(true, nullptr);
+	MenuBuilder.BeginSection(NAME_None, FText::FromString(TEXT("Region")));
+	MenuBuilder.AddWidget(
+		SNew(SBox)
+		.WidthOverride(120.0f)
+		[
+			SNew(SNumericEntryBox<float>)
+			.MinValue(100.0f)
+			.Value_Lambda([]() { return GetDefault<UBDC_LevelSelectorUserSettings>()->OpenAtFavoriteLoadRadius; })
+			.OnValueCommitted_Lambda([](float Value, ETextCommit::Type)
+			{
+				UBDC_LevelSelectorUserSettings* UserSettings = GetMutableDefault<UBDC_LevelSelectorUserSettings>();
+				UserSettings->OpenAtFavoriteLoadRadius = FMath::Max(Value, 100.0f);
+				UserSettings->RequestConfigSave();
+			})
+			.ToolTipText(FText::FromString(TEXT("World Partition levels load only the editor cells this many centimeters around the favorite")))
+		],
+		FText::FromString(TEXT("Load Radius")));
+	MenuBuilder.EndSection();
+
+	const auto AddFavoriteEntry = [this, BoundItem = Item](FMenuBuilder& Builder, const TPair<FName, FVector>& Entry)
+	{
+		const FName Name = Entry.Key;
+		Builder.AddMenuEntry(
+			FText::FromName(Name),
+			FText::Format(FText::FromString(TEXT("Opens the level with only the region around {0} loaded")), FText::FromString(Entry.Value.ToCompactString())),
+			FSlateIcon(),
+			FUIAction(FExecuteAction::CreateLambda([this, BoundItem, Name]()
+			{
+				OnOpenAtFavorite.ExecuteIfBound(BoundItem, Name);
+			})));
+	};
+
+	// Long lists are grouped by the name up to the first underscore or space, e.g. "Arena_North" and "Arena_South".
+	// Groups of one favorite and favorites without a prefix stay at the top level.
+	static constexpr int32 MaxUngroupedFavorites = 12;
+	MenuBuilder.BeginSection(NAME_None, FText::FromString(TEXT("Open at Camera Favorite")));
+	if (Entries.Num() <= MaxUngroupedFavorites)
+	{
+		for (const TPair<FName, FVector>& Entry : Entries)
+		{
+			AddFavoriteEntry(MenuBuilder, Entry);
+		}
+	}
+	else
+	{
+		// FString keys compare case-insensitively, "arena_a" and "Arena_B" share a group.
+		TArray<TPair<FString, TArray<TPair<FName, FVector>>>> Groups;
+		TMap<FString, int32> GroupIndexByPrefix;
+		for (const TPair<FName, FVector>& Entry : Entries)
+		{
+			const FString NameString = Entry.Key.ToString();
+			int32 SeparatorIndex = INDEX_NONE;
+			int32 SpaceIndex = INDEX_NONE;
+			NameString.FindChar(TEXT('_'), SeparatorIndex);
+			if (NameString.FindChar(TEXT(' '), SpaceIndex) && (SeparatorIndex == INDEX_NONE || SpaceIndex < SeparatorIndex))
+			{
+				SeparatorIndex = SpaceIndex;
+			}
+			const FString Prefix = SeparatorIndex > 0 ? NameString.Left(SeparatorIndex) : NameString;
+
+			int32& GroupIndex = GroupIndexByPrefix.FindOrAdd(Prefix, INDEX_NONE);
+			if (GroupIndex == INDEX_NONE)
+			{
+				GroupIndex = Groups.Emplace(Prefix, TArray<TPair<FName, FVector>>());
+			}
+			Groups[GroupIndex].Value.Add(Entry);
+		}
+
+		for (const TPair<FString, TArray<TPair<FName, FVector>>>& Group : Groups)
+		{
+			if (Group.Value.Num() == 1)
+			{
+				AddFavoriteEntry(MenuBuilder, Group.Value[0]);
+				continue;
+			}
+			MenuBuilder.AddSubMenu(
+				FText::Format(FText::FromString(TEXT("{0} ({1})")), FText::FromString(Group.Key), FText::AsNumber(Group.Value.Num())),
+				FText::GetEmpty(),
+				FNewMenuDelegate::CreateLambda([AddFavoriteEntry, GroupEntries = Group.Value](FMenuBuilder& SubMenuBuilder)
+				{
+					for (const TPair<FName, FVector>& Entry : GroupEntries)
+					{
+						AddFavoriteEntry(SubMenuBuilder, Entry);
+					}
+				}));
+		}
+	}
+	MenuBuilder.EndSection();
+	return MenuBuilder.MakeWidget();
+}
@@ -0,0 +1,109 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "SLevelSelectorTreeRow.h"
+#include "LevelSelectorIndex.h"
+#include "Styling/AppStyle.h"
+#include "Widgets/SBoxPanel.h"
+#include "Widgets/Images/SImage.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/SExpanderArrow.h"
+
+void SLevelSelectorTreeRow::Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTable)
+{
+	Node = InArgs._Node;
+	LevelIcon = InArgs._LevelIcon;
+	FavoriteIcon = InArgs._FavoriteIcon;
+
+	const FText NameText = FText::FromString(Node->IsFolder() ? Node->Name : Node->Level->DisplayName);
+	const FText ToolTipText = FText::FromString(Node->IsFolder() ? Node->Path : Node->Level->PackagePath);
+
+	STableRow::Construct(
+		STableRow::FArguments()
+		.Padding(FMargin(0.0f, 1.0f))
+		.ToolTipText(ToolTipText)
+		.Content()
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			[
+				SNew(SExpanderArrow, SharedThis(this))
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			[
+				SNew(SBox)
+				.WidthOverride(18)
+				.HeightOverride(18)
+				[
+					SNew(SImage)
+					.Image(this, &SLevelSelectorTreeRow::GetIconBrush)
+					.ColorAndOpacity(Node->IsFolder() ? FSlateColor::UseForeground() : FSlateColor(FLinearColor::White))
+				]
+			]
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			.VAlign(VAlign_Center)
+			.Padding(4.0f, 2.0f)
+			[
+				SNew(STextBlock)
+				.Text(NameText)
+				.Font(FAppStyle::GetFontStyle("PropertyWindow.NormalFont"))
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(4.0f, 0.0f)
+			[
+				SNew(STextBlock)
+				.Text(this, &SLevelSelectorTreeRow::GetCountText)
+				.Font(FAppStyle::GetFontStyle("SmallFont"))
+				.ColorAndOpacity(FSlateColor::UseSubduedForeground())
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(4.0f, 0.0f, 3.0f, 0.0f)
+			[
+				SNew(SImage)
+				.Image(FavoriteIcon)
+				.DesiredSizeOverride(FVector2D(16, 16))
+				.Visibility(this, &SLevelSelectorTreeRow::GetFavoriteVisibility)
+			]
+		],
+		InOwnerTable);
+}
+
+const FSlateBrush* SLevelSelectorTreeRow::GetIconBrush() const
+{
+	if (!Node->IsFolder())
+	{
+		return LevelIcon;
+	}
+	return FAppStyle::GetBrush(IsItemExpanded() ? "Icons.FolderOpen" : "Icons.FolderClosed");
+}
+
+FText SLevelSelectorTreeRow::GetCountText() const
+{
+	const int32 Count = Node->IsFolder() ? Node->NumLevels : INDEX_NONE;
+	if (Count != CachedCount)
+	{
+		CachedCount = Count;
+		CachedCountText = Count == INDEX_NONE ? FText::GetEmpty() : FText::AsNumber(Count);
+	}
+	return CachedCountText;
+}
+
+EVisibility SLevelSelectorTreeRow::GetFavoriteVisibility() const
+{
+	return !Node->IsFolder() && Node->Level->IsFavorite() ? EVisibility::Visible : EVisibility::Collapsed;
+}
@@ -0,0 +1,117 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "LevelSelectorTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "BDC_LevelSelectorSettings.h"
+#include "LevelSelectorCameraFavoriteStore.h"
+#include "LevelSelectorCameraSpatialIndex.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLevelSelectorCameraFavoriteStoreRoundTripTest, "BDC.LevelSelector.CameraFavoriteStore.RoundTrip", LevelSelectorTests::TestFlags)
+bool FLevelSelectorCameraFavoriteStoreRoundTripTest::RunTest(const FString& Parameters)
+{
+	// A folder no project uses, its files are removed again at the end.
+	const FName Desert(TEXT("/Game/__LevelSelectorAutomation__/L_Desert"));
+	const FName Dune(TEXT("/Game/__LevelSelectorAutomation__/L_Dune"));
+	const FString TestDir = FLevelSelectorCameraFavoriteStore::GetRootDir() / TEXT("Game") / TEXT("__LevelSelectorAutomation__");
+	IFileManager::Get().DeleteDirectory(*TestDir, false, true);
+
+	const FTransform Entrance(FRotator(0.0, 90.0, 0.0), FVector(100.0, -200.0, 300.0));
+	const FTransform Tower(FRotator(-30.0, 45.0, 0.0), FVector(5000.0, 2500.0, 1200.0));
+	const auto HasFavorite = [](const FCameraFavorite* Favorites, FName Name, const FTransform& Expected)
+	{
+		const FTransform* CameraTransform = Favorites ? Favorites->HoldFavorites.Find(Name) : nullptr;
+		return CameraTransform && CameraTransform->Equals(Expected, 1.e-3);
+	};
+
+	FLevelSelectorCameraFavoriteStore Store;
+	TestNull(TEXT("A level without a file has no favorites"), Store.Find(Desert));
+	TestTrue(TEXT("Adding a favorite writes the file"), Store.AddFavorite(Desert, TEXT("Entrance"), Entrance));
+	TestTrue(TEXT("A second favorite is added to the same file"), Store.AddFavorite(Desert, TEXT("Tower"), Tower));
+	TestTrue(TEXT("The file is named after the package"), IFileManager::Get().FileExists(*FLevelSelectorCameraFavoriteStore::GetFilename(Desert)));
+	TestTrue(TEXT("A written level has favorites"), Store.HasFavorites(Desert));
+	{
+		FLevelSelectorCameraFavoriteStore Reader;
+		TestTrue(TEXT("A new store finds the file in its listing"), Reader.HasFavorites(Desert));
+		TestFalse(TEXT("A level without a file is not listed"), Reader.HasFavorites(Dune));
+		const FCameraFavorite* Favorites = Reader.Find(Desert);
+		TestTrue(TEXT("A new store reads both favorites back"), Favorites && Favorites->HoldFavorites.Num() == 2);
+		TestTrue(TEXT("Transforms survive the round trip"), HasFavorite(Favorites, TEXT("Entrance"), Entrance) && HasFavorite(Favorites, TEXT("Tower"), Tower));
+	}
+
+	const FLevelSelectorCameraSpatialIndex* SpatialIndex = Store.FindSpatialIndex(Desert);
+	TestTrue(TEXT("The spatial index holds the favorites"), SpatialIndex && SpatialIndex->Num() == 2);
+
+	TestTrue(TEXT("Renaming a favorite writes the file"), Store.RenameFavorite(Desert, TEXT("Tower"), TEXT("Summit")));
+	TestFalse(TEXT("Renaming a missing favorite changes nothing"), Store.RenameFavorite(Desert, TEXT("Tower"), TEXT("Peak")));
+	TestFalse(TEXT("Removing a missing favorite changes nothing"), Store.RemoveFavorite(Desert, TEXT("Tower")));
+	TestFalse(TEXT("A mutation that reports no change is not written"), Store.Modify(Desert, [](FCameraFavorite&) { return false; }));
+	{
+		FLevelSelectorCameraFavoriteStore Reader;
+		const FCameraFavorite* Favorites = Reader.Find(Desert);
+		TestTrue(TEXT("The renamed favorite is read back under its new name"), HasFavorite(Favorites, TEXT("Summit"), Tower));
+		TestFalse(TEXT("The old name is gone from the file"), Favorites && Favorites->HoldFavorites.Contains(TEXT("Tower")));
+	}
+	SpatialIndex = Store.FindSpatialIndex(Desert);
+	FLevelSelectorCameraSpatialIndex::FHit Hit;
+	TestTrue(TEXT("The spatial index follows a rename"), SpatialIndex && SpatialIndex->FindNearest(Tower.GetLocation(), Hit) && Hit.Name == TEXT("Summit"));
+
+	TestTrue(TEXT("Moving a level writes its new file"), Store.Move(Desert, Dune));
+	TestFalse(TEXT("Moving removes the old file"), IFileManager::Get().FileExists(*FLevelSelectorCameraFavoriteStore::GetFilename(Desert)));
+	TestFalse(TEXT("Moving a level without favorites does nothing"), Store.Move(Desert, Dune));
+	{
+		FLevelSelectorCameraFavoriteStore Reader;
+		TestFalse(TEXT("The old level is not listed after a move"), Reader.HasFavorites(Desert));
+		TestTrue(TEXT("The new level is listed after a move"), Reader.HasFavorites(Dune));
+		TestNull(TEXT("The old level has no favorites after a move"), Reader.Find(Desert));
+		const FCameraFavorite* Favorites = Reader.Find(Dune);
+		TestTrue(TEXT("The new level has all favorites after a move"),
+			HasFavorite(Favorites, TEXT("Entrance"), Entrance) && HasFavorite(Favorites, TEXT("Summit"), Tower));
+	}
+
+	TestTrue(TEXT("Removing a favorite writes the file"), Store.RemoveFavorite(Dune, TEXT("Entrance")));
+	TestTrue(TEXT("Removing the last favorite deletes the file"), Store.RemoveFavorite(Dune, TEXT("Summit")));
+	TestFalse(TEXT("No file is left for a level without favorites"), IFileManager::Get().FileExists(*FLevelSelectorCameraFavoriteStore::GetFilename(Dune)));
+	TestNull(TEXT("A level whose favorites were all removed has none"), Store.Find(Dune));
+	TestFalse(TEXT("A level whose favorites were all removed is not listed"), Store.HasFavorites(Dune));
+
+	// Lines that don't parse are skipped, the rest of the file still loads.
+	const FString Contents = FString::Printf(TEXT("LevelSelectorCameraFavorites 1\nBroken\n=%s\nEntrance=%s\n"), *Tower.ToString(), *Entrance.ToString());
+	FFileHelper::SaveStringToFile(Contents, *FLevelSelectorCameraFavoriteStore::GetFilename(Desert));
+	{
+		FLevelSelectorCameraFavoriteStore Reader;
+		const FCameraFavorite* Favorites = Reader.Find(Desert);
+		TestTrue(TEXT("Only the valid line of a damaged file is read"), Favorites && Favorites->HoldFavorites.Num() == 1 && HasFavorite(Favorites, TEXT("Entrance"), Entrance));
+	}
+
+	// The test files are not in source control, so a read-only one can't be checked out and has to stay as it is.
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.SetReadOnly(*FLevelSelectorCameraFavoriteStore::GetFilename(Desert), true);
+	{
+		FLevelSelectorCameraFavoriteStore Writer;
+		AddExpectedError(TEXT("is read-only and could not be checked out"), EAutomationExpectedErrorFlags::Contains, 1);
+		TestFalse(TEXT("A read-only file that can't be checked out is not written"), Writer.AddFavorite(Desert, TEXT("Tower"), Tower));
+		TestFalse(TEXT("The failed write is rolled back"), HasFavorite(Writer.Find(Desert), TEXT("Tower"), Tower));
+	}
+	{
+		FLevelSelectorCameraFavoriteStore Reader;
+		const FCameraFavorite* Favorites = Reader.Find(Desert);
+		TestTrue(TEXT("The read-only file keeps its contents"), Favorites && Favorites->HoldFavorites.Num() == 1);
+	}
+	PlatformFile.SetReadOnly(*FLevelSelectorCameraFavoriteStore::GetFilename(Desert), false);
+
+	IFileManager::Get().DeleteDirectory(*TestDir, false, true);
+	return true;
+}
+
+#endif
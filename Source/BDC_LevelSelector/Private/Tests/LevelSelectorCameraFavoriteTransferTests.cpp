@@ -0,0 +1,118 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "LevelSelectorTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "BDC_LevelSelectorSettings.h"
+#include "LevelSelectorCameraFavoriteStore.h"
+#include "LevelSelectorCameraFavoriteTransfer.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace LevelSelectorTests
+{
+	static FCameraFavorite MakeTransferFavorites()
+	{
+		// Names with separators and quotes, they have to be escaped in both formats.
+		FCameraFavorite Favorites;
+		Favorites.HoldFavorites.Add(TEXT("Entrance"), FTransform(FRotator(0.0, 90.0, 0.0), FVector(100.0, -200.0, 300.0)));
+		Favorites.HoldFavorites.Add(TEXT("Gate, \"North\""), FTransform(FRotator(-30.0, 45.5, 0.0), FVector(5000.25, 2500.0, 1200.0)));
+		Favorites.HoldFavorites.Add(TEXT("Tower {Top} \\ Roof"), FTransform(FRotator(-89.0, -170.0, 0.0), FVector(-1.0e5, 3.0e5, -50.0)));
+		return Favorites;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLevelSelectorCameraFavoriteTransferRoundTripTest, "BDC.LevelSelector.CameraFavoriteTransfer.RoundTrip", LevelSelectorTests::TestFlags)
+bool FLevelSelectorCameraFavoriteTransferRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace LevelSelectorTests;
+
+	const FCameraFavorite Favorites = MakeTransferFavorites();
+	const FString TestDir = FPaths::AutomationTransientDir() / TEXT("LevelSelector");
+	for (const TCHAR* Extension : { TEXT("csv"), TEXT("json") })
+	{
+		const FString Filename = TestDir / TEXT("CameraFavorites.") + Extension;
+		if (!TestTrue(*FString::Printf(TEXT("Favorites are exported to %s"), Extension), FLevelSelectorCameraFavoriteTransfer::Export(Filename, Favorites)))
+		{
+			continue;
+		}
+
+		TMap<FName, FTransform> Imported;
+		Imported.Add(TEXT("Existing"), FTransform::Identity);
+		TestTrue(*FString::Printf(TEXT("Favorites are imported from %s"), Extension), FLevelSelectorCameraFavoriteTransfer::Import(Filename, Imported));
+		TestEqual(*FString::Printf(TEXT("Importing from %s adds to the favorites already there"), Extension), Imported.Num(), Favorites.HoldFavorites.Num() + 1);
+		for (const TPair<FName, FTransform>& Pair : Favorites.HoldFavorites)
+		{
+			const FTransform* Transform = Imported.Find(Pair.Key);
+			TestTrue(*FString::Printf(TEXT("%s survives the round trip through %s"), *Pair.Key.ToString(), Extension),
+				Transform && Transform->Equals(Pair.Value, 1.e-2));
+		}
+	}
+
+	// Hand written files: no header, blanks around fields, and rows that have to be skipped.
+	const FString CsvFilename = TestDir / TEXT("HandWritten.csv");
+	FFileHelper::SaveStringToFile(TEXT("Entrance , 1, 2, 3, 0, 90, 0\nBroken,1,2\n\n\"Quoted, Name\",4,5,6,10,20,30\n"), *CsvFilename);
+	TMap<FName, FTransform> Imported;
+	AddExpectedError(TEXT("Skipped 1 rows"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestTrue(TEXT("A CSV file without a header is read"), FLevelSelectorCameraFavoriteTransfer::Import(CsvFilename, Imported));
+	TestEqual(TEXT("Malformed and empty rows are skipped"), Imported.Num(), 2);
+	TestTrue(TEXT("Blanks around names and numbers are ignored"), Imported.Contains(TEXT("Entrance")) && Imported[TEXT("Entrance")].GetLocation().Equals(FVector(1.0, 2.0, 3.0)));
+	TestTrue(TEXT("Quoted names may contain commas"), Imported.Contains(TEXT("Quoted, Name")));
+
+	const FString JsonFilename = TestDir / TEXT("HandWritten.json");
+	FFileHelper::SaveStringToFile(TEXT("[\n{ \"Name\": \"Split\",\n \"Location\": [1, 2, 3],\n \"Rotation\": [0, 0, 0] },\n{ \"Name\": \"NoRotation\", \"Location\": [1, 2, 3] }\n]\n"), *JsonFilename);
+	Imported.Reset();
+	AddExpectedError(TEXT("Skipped 1 objects"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestTrue(TEXT("A JSON array without a wrapping object is read"), FLevelSelectorCameraFavoriteTransfer::Import(JsonFilename, Imported));
+	TestTrue(TEXT("Objects may span several lines, incomplete ones are skipped"), Imported.Num() == 1 && Imported.Contains(TEXT("Split")));
+
+	AddExpectedError(TEXT("Could not read camera favorites"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestFalse(TEXT("Importing a missing file fails"), FLevelSelectorCameraFavoriteTransfer::Import(TestDir / TEXT("Missing.csv"), Imported));
+
+	IFileManager::Get().DeleteDirectory(*TestDir, false, true);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLevelSelectorCameraFavoriteTransferNameLimitsTest, "BDC.LevelSelector.CameraFavoriteTransfer.NameLimits", LevelSelectorTests::TestFlags)
+bool FLevelSelectorCameraFavoriteTransferNameLimitsTest::RunTest(const FString& Parameters)
+{
+	const FString LongName = FString::ChrN(NAME_SIZE, TEXT('A'));
+	TestTrue(TEXT("Names just below NAME_SIZE are valid"), FLevelSelectorCameraFavoriteStore::IsValidFavoriteName(FStringView(LongName).LeftChop(1)));
+	TestFalse(TEXT("Names of NAME_SIZE characters are rejected"), FLevelSelectorCameraFavoriteStore::IsValidFavoriteName(LongName));
+	TestFalse(TEXT("Names with a line feed are rejected"), FLevelSelectorCameraFavoriteStore::IsValidFavoriteName(TEXT("Upper\nLower")));
+	TestFalse(TEXT("Names with a carriage return are rejected"), FLevelSelectorCameraFavoriteStore::IsValidFavoriteName(TEXT("Upper\rLower")));
+	TestFalse(TEXT("Empty names are rejected"), FLevelSelectorCameraFavoriteStore::IsValidFavoriteName(TEXT("")));
+
+	const FString TestDir = FPaths::AutomationTransientDir() / TEXT("LevelSelector");
+	const FString CsvFilename = TestDir / TEXT("LongNames.csv");
+	FFileHelper::SaveStringToFile(LongName + TEXT(",1,2,3,0,0,0\nShort,1,2,3,0,0,0\n"), *CsvFilename);
+	TMap<FName, FTransform> Imported;
+	AddExpectedError(TEXT("Skipped 1 rows"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestTrue(TEXT("A CSV file with an overlong name is read"), FLevelSelectorCameraFavoriteTransfer::Import(CsvFilename, Imported));
+	TestTrue(TEXT("The overlong name is skipped, the rest is imported"), Imported.Num() == 1 && Imported.Contains(TEXT("Short")));
+
+	const FString JsonFilename = TestDir / TEXT("LineBreaks.json");
+	FFileHelper::SaveStringToFile(TEXT("[{ \"Name\": \"Upper\\nLower\", \"Location\": [1, 2, 3], \"Rotation\": [0, 0, 0] }]\n"), *JsonFilename);
+	Imported.Reset();
+	AddExpectedError(TEXT("Skipped 1 objects"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestTrue(TEXT("A JSON file with a line break in a name is read"), FLevelSelectorCameraFavoriteTransfer::Import(JsonFilename, Imported));
+	TestEqual(TEXT("Names with escaped line breaks are skipped"), Imported.Num(), 0);
+
+	TMap<FName, FTransform> Existing;
+	Existing.Add(FName(FStringView(LongName).LeftChop(1)), FTransform::Identity);
+	const FName UniqueName = FLevelSelectorCameraFavoriteTransfer::MakeUniqueName(FString(FStringView(LongName).LeftChop(1)), Existing);
+	TestTrue(TEXT("Unique names of long names stay below NAME_SIZE"), !Existing.Contains(UniqueName) && UniqueName.GetStringLength() < NAME_SIZE);
+
+	IFileManager::Get().DeleteDirectory(*TestDir, false, true);
+	return true;
+}
+
+#endif
@@ -0,0 +1,158 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "LevelSelectorTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "LevelSelectorCameraSpatialIndex.h"
+#include "Math/RandomStream.h"
+
+namespace LevelSelectorTests
+{
+	struct FSpatialTestFavorite
+	{
+		FName Name;
+		FVector Location;
+	};
+
+	/** Names in distance order from Origin, ties by name, as the index should report them. */
+	static TArray<FName> SortByDistance(TConstArrayView<FSpatialTestFavorite> Favorites, const FVector& Origin, double Radius = TNumericLimits<double>::Max())
+	{
+		TArray<TPair<double, FName>> Sorted;
+		for (const FSpatialTestFavorite& Favorite : Favorites)
+		{
+			const double Distance = FVector::Dist(Origin, Favorite.Location);
+			if (Distance <= Radius)
+			{
+				Sorted.Emplace(Distance, Favorite.Name);
+			}
+		}
+		Sorted.Sort([](const TPair<double, FName>& A, const TPair<double, FName>& B)
+		{
+			return A.Key < B.Key || (A.Key == B.Key && A.Value.LexicalLess(B.Value));
+		});
+
+		TArray<FName> Names;
+		for (const TPair<double, FName>& Pair : Sorted)
+		{
+			Names.Add(Pair.Value);
+		}
+		return Names;
+	}
+
+	static TArray<FName> WalkNext(const FLevelSelectorCameraSpatialIndex& Index, const FVector& Origin)
+	{
+		TArray<FName> Names;
+		FLevelSelectorCameraSpatialIndex::FHit Hit;
+		for (bool bFound = Index.FindNearest(Origin, Hit); bFound && Names.Num() <= Index.Num(); bFound = Index.FindNext(Origin, Hit.Distance, Hit.Name, Hit))
+		{
+			Names.Add(Hit.Name);
+		}
+		return Names;
+	}
+
+	static TArray<FName> WalkPrevious(const FLevelSelectorCameraSpatialIndex& Index, const FVector& Origin)
+	{
+		TArray<FName> Names;
+		FLevelSelectorCameraSpatialIndex::FHit Hit;
+		for (bool bFound = Index.FindPrevious(Origin, TNumericLimits<double>::Max(), NAME_None, Hit); bFound && Names.Num() <= Index.Num();
+			bFound = Index.FindPrevious(Origin, Hit.Distance, Hit.Name, Hit))
+		{
+			Names.Insert(Hit.Name, 0);
+		}
+		return Names;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLevelSelectorCameraSpatialIndexOrderTest, "BDC.LevelSelector.CameraSpatialIndex.Order", LevelSelectorTests::TestFlags)
+bool FLevelSelectorCameraSpatialIndexOrderTest::RunTest(const FString& Parameters)
+{
+	using namespace LevelSelectorTests;
+
+	FLevelSelectorCameraSpatialIndex Index(1000.0);
+	FLevelSelectorCameraSpatialIndex::FHit Hit;
+	TestFalse(TEXT("An empty index finds nothing"), Index.FindNearest(FVector::ZeroVector, Hit));
+
+	// Three favorites at the same distance from the origin, their order comes from the name alone.
+	TArray<FSpatialTestFavorite> Favorites = {
+		{ TEXT("Tie_C"), FVector(1500.0, 0.0, 0.0) },
+		{ TEXT("Tie_A"), FVector(-1500.0, 0.0, 0.0) },
+		{ TEXT("Tie_B"), FVector(0.0, 0.0, 1500.0) },
+	};
+	FRandomStream Random(1234);
+	for (int32 FavoriteIndex = 0; FavoriteIndex < 64; ++FavoriteIndex)
+	{
+		Favorites.Add({ FName(*FString::Printf(TEXT("Random_%02d"), FavoriteIndex)), Random.GetUnitVector() * Random.FRandRange(0.0f, 20000.0f) });
+	}
+	for (const FSpatialTestFavorite& Favorite : Favorites)
+	{
+		Index.Add(Favorite.Name, Favorite.Location);
+	}
+	TestEqual(TEXT("Every favorite is indexed"), Index.Num(), Favorites.Num());
+
+	TestTrue(TEXT("The nearest favorite wins ties by name"), Index.FindNearest(FVector::ZeroVector, Hit) && Hit.Name == TEXT("Tie_A"));
+	TestTrue(TEXT("Next steps through a tie by name"), Index.FindNext(FVector::ZeroVector, Hit.Distance, Hit.Name, Hit) && Hit.Name == TEXT("Tie_B"));
+	TestTrue(TEXT("Previous steps back through a tie by name"), Index.FindPrevious(FVector::ZeroVector, Hit.Distance, Hit.Name, Hit) && Hit.Name == TEXT("Tie_A"));
+
+	// Near origins walk the grid cell by cell, far ones bucket the occupied cells.
+	const FVector Origins[] = { FVector::ZeroVector, FVector(7300.0, -2100.0, 450.0), FVector(2.0e6, -3.0e6, 1.0e6) };
+	for (const FVector& Origin : Origins)
+	{
+		const TArray<FName> Expected = SortByDistance(Favorites, Origin);
+		TestEqual(*FString::Printf(TEXT("Next visits every favorite in order from %s"), *Origin.ToString()), WalkNext(Index, Origin), Expected);
+		TestEqual(*FString::Printf(TEXT("Previous visits every favorite in reverse order from %s"), *Origin.ToString()), WalkPrevious(Index, Origin), Expected);
+
+		for (const double Radius : { 0.0, 2500.0, 12000.0, 5.0e6 })
+		{
+			TArray<FLevelSelectorCameraSpatialIndex::FHit> Hits;
+			Index.FindInRadius(Origin, Radius, Hits);
+			TArray<FName> HitNames;
+			for (const FLevelSelectorCameraSpatialIndex::FHit& RadiusHit : Hits)
+			{
+				HitNames.Add(RadiusHit.Name);
+			}
+			TestEqual(*FString::Printf(TEXT("Radius %.0f from %s finds the favorites within it, nearest first"), Radius, *Origin.ToString()),
+				HitNames, SortByDistance(Favorites, Origin, Radius));
+		}
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLevelSelectorCameraSpatialIndexMaintenanceTest, "BDC.LevelSelector.CameraSpatialIndex.Maintenance", LevelSelectorTests::TestFlags)
+bool FLevelSelectorCameraSpatialIndexMaintenanceTest::RunTest(const FString& Parameters)
+{
+	using namespace LevelSelectorTests;
+
+	FLevelSelectorCameraSpatialIndex Index(1000.0);
+	Index.Add(TEXT("Entrance"), FVector(100.0, 0.0, 0.0));
+	Index.Add(TEXT("Tower"), FVector(2500.0, 0.0, 0.0));
+	Index.Add(TEXT("Cave"), FVector(-4000.0, 0.0, 0.0));
+
+	Index.Add(TEXT("Entrance"), FVector(9000.0, 0.0, 0.0));
+	TestEqual(TEXT("Adding an indexed name moves it"), Index.Num(), 3);
+	TestEqual(TEXT("A moved favorite is found at its new place"), WalkNext(Index, FVector::ZeroVector),
+		TArray<FName>{ TEXT("Tower"), TEXT("Cave"), TEXT("Entrance") });
+
+	TestTrue(TEXT("Renaming a favorite succeeds"), Index.Rename(TEXT("Tower"), TEXT("Summit")));
+	TestFalse(TEXT("Renaming onto an indexed name fails"), Index.Rename(TEXT("Summit"), TEXT("Cave")));
+	TestFalse(TEXT("Renaming a missing favorite fails"), Index.Rename(TEXT("Tower"), TEXT("Peak")));
+
+	// The last favorite takes the slot of a removed one, it has to stay reachable.
+	TestTrue(TEXT("Removing a favorite succeeds"), Index.Remove(TEXT("Entrance")));
+	TestFalse(TEXT("Removing a missing favorite fails"), Index.Remove(TEXT("Entrance")));
+	TestEqual(TEXT("Removed favorites are not found"), WalkNext(Index, FVector::ZeroVector), TArray<FName>{ TEXT("Summit"), TEXT("Cave") });
+	TestEqual(TEXT("The remaining favorites stay in order backwards"), WalkPrevious(Index, FVector::ZeroVector), TArray<FName>{ TEXT("Summit"), TEXT("Cave") });
+
+	Index.Reset();
+	FLevelSelectorCameraSpatialIndex::FHit Hit;
+	TestFalse(TEXT("A reset index finds nothing"), Index.FindNearest(FVector::ZeroVector, Hit));
+	return true;
+}
+
+#endif
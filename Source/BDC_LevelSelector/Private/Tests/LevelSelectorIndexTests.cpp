@@ -0,0 +1,265 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "LevelSelectorTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "LevelSelectorIndex.h"
+#include "LevelSelectorIndexCache.h"
+
+namespace LevelSelectorTests
+{
+	static TArray<FString> GetPackagePaths(TConstArrayView<TSharedPtr<FLevelSelectorItem>> Items)
+	{
+		TArray<FString> Paths;
+		for (const TSharedPtr<FLevelSelectorItem>& Item : Items)
+		{
+			Paths.Add(Item->PackagePath);
+		}
+		return Paths;
+	}
+
+	static TArray<FString> GetFilteredPaths(const FLevelSelectorIndex& Index, const TCHAR* Query, const FLevelSelectorTagIndex::FQuery& TagQuery)
+	{
+		TArray<TSharedPtr<FLevelSelectorItem>> Items;
+		Index.GetFilteredItems(FLevelSelectorSearchIndex::Fold(Query), TagQuery, Items);
+		return GetPackagePaths(Items);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLevelSelectorIndexReconcileTest, "BDC.LevelSelector.Index.Reconcile", LevelSelectorTests::TestFlags)
+bool FLevelSelectorIndexReconcileTest::RunTest(const FString& Parameters)
+{
+	using namespace LevelSelectorTests;
+	FScopedSettingsOverride SettingsOverride;
+	SettingsOverride.SetFavorite(TEXT("/Game/Tests/Maps/L_Forest"));
+
+	FLevelSelectorIndex Index;
+	FLevelSelectorIndexDelta LastDelta;
+	Index.OnChanged().AddLambda([&LastDelta](const FLevelSelectorIndexDelta& Delta) { LastDelta = Delta; });
+
+	TArray<FAssetData> Assets = {
+		MakeWorldAsset(TEXT("/Game/Tests/Other/L_City")),
+		MakeWorldAsset(TEXT("/Game/Tests/Maps/L_Desert")),
+		MakeWorldAsset(TEXT("/Game/Tests/Maps/L_Forest")),
+		MakeWorldAsset(TEXT("/Game/Tests/Maps/L_Desert")),
+		MakeWorldAsset(TEXT("/Outside/Maps/L_Outside")),
+		FAssetData(TEXT("/Game/Tests/Maps/SM_Rock"), TEXT("/Game/Tests/Maps"), TEXT("SM_Rock"), FTopLevelAssetPath(TEXT("/Script/Engine"), TEXT("StaticMesh"))),
+	};
+	Index.Reconcile(Assets);
+
+	TestEqual(TEXT("Duplicates, other classes and levels outside the content roots are skipped, favorites sort first"),
+		GetPackagePaths(Index.GetSortedItems()),
+		TArray<FString>{ TEXT("/Game/Tests/Maps/L_Forest"), TEXT("/Game/Tests/Maps/L_Desert"), TEXT("/Game/Tests/Other/L_City") });
+	TestEqual(TEXT("The first reconcile adds every item"), LastDelta.Added.Num(), 3);
+
+	Assets = {
+		MakeWorldAsset(TEXT("/Game/Tests/Other/L_City")),
+		MakeWorldAsset(TEXT("/Game/Tests/Maps/L_Forest")),
+		MakeWorldAsset(TEXT("/Game/Tests/Maps/L_Swamp")),
+	};
+	const TSharedPtr<FLevelSelectorItem> CityItem = Index.FindItem(TEXT("/Game/Tests/Other/L_City"));
+	LastDelta.Reset();
+	Index.Reconcile(Assets);
+
+	TestEqual(TEXT("Only the removed level is reported as removed"), GetPackagePaths(LastDelta.Removed), TArray<FString>{ TEXT("/Game/Tests/Maps/L_Desert") });
+	TestEqual(TEXT("Only the new level is reported as added"), GetPackagePaths(LastDelta.Added), TArray<FString>{ TEXT("/Game/Tests/Maps/L_Swamp") });
+	TestFalse(TEXT("The removed level can't be found anymore"), Index.FindItem(TEXT("/Game/Tests/Maps/L_Desert")).IsValid());
+	TestTrue(TEXT("Unchanged levels keep their item"), Index.FindItem(TEXT("/Game/Tests/Other/L_City")) == CityItem);
+
+	LastDelta.Reset();
+	Index.Reconcile(TArray<FAssetData>(), TEXT("/Game/Tests/Other/"));
+
+	TestEqual(TEXT("A root reconcile only removes levels below the root"), GetPackagePaths(LastDelta.Removed), TArray<FString>{ TEXT("/Game/Tests/Other/L_City") });
+	TestEqual(TEXT("Levels outside the root stay"),
+		GetPackagePaths(Index.GetSortedItems()),
+		TArray<FString>{ TEXT("/Game/Tests/Maps/L_Forest"), TEXT("/Game/Tests/Maps/L_Swamp") });
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLevelSelectorIndexFilterTest, "BDC.LevelSelector.Index.GetFilteredItems", LevelSelectorTests::TestFlags)
+bool FLevelSelectorIndexFilterTest::RunTest(const FString& Parameters)
+{
+	using namespace LevelSelectorTests;
+	FScopedSettingsOverride SettingsOverride;
+	SettingsOverride.SetFavorite(TEXT("/Game/Tests/L_City_Gym"));
+
+	TArray<FAssetData> Assets = {
+		MakeWorldAsset(TEXT("/Game/Tests/L_Desert_Gym")),
+		MakeWorldAsset(TEXT("/Game/Tests/L_Desert_Art")),
+		MakeWorldAsset(TEXT("/Game/Tests/L_Forest_Gym")),
+		MakeWorldAsset(TEXT("/Game/Tests/L_City_Gym")),
+		MakeWorldAsset(TEXT("/Game/Tests/Unique/L_Unique_B")),
+		MakeWorldAsset(TEXT("/Game/Tests/Unique/L_Unique_A")),
+	};
+	// Enough filler that a rare query takes the path that sorts its matches on their own.
+	for (int32 Index = 0; Index < 64; ++Index)
+	{
+		Assets.Add(MakeWorldAsset(FString::Printf(TEXT("/Game/Tests/Filler/L_Filler_%02d"), Index)));
+	}
+
+	FLevelSelectorIndex Index;
+	Index.Reconcile(Assets);
+	const FLevelSelectorTagIndex::FQuery NoTags = Index.MakeTagQuery(FGameplayTagContainer(), ELevelSelectorTagMatch::Any);
+
+	TestEqual(TEXT("An empty query lists the whole index in order"),
+		GetFilteredPaths(Index, TEXT(""), NoTags), GetPackagePaths(Index.GetSortedItems()));
+	TestEqual(TEXT("Matches keep the index order, favorites first"),
+		GetFilteredPaths(Index, TEXT("_gym"), NoTags),
+		TArray<FString>{ TEXT("/Game/Tests/L_City_Gym"), TEXT("/Game/Tests/L_Desert_Gym"), TEXT("/Game/Tests/L_Forest_Gym") });
+	TestEqual(TEXT("Search is case-insensitive"),
+		GetFilteredPaths(Index, TEXT("DESERT"), NoTags),
+		TArray<FString>{ TEXT("/Game/Tests/L_Desert_Art"), TEXT("/Game/Tests/L_Desert_Gym") });
+	TestEqual(TEXT("Few matches are sorted like the index"),
+		GetFilteredPaths(Index, TEXT("unique"), NoTags),
+		TArray<FString>{ TEXT("/Game/Tests/Unique/L_Unique_A"), TEXT("/Game/Tests/Unique/L_Unique_B") });
+	TestEqual(TEXT("The package path is searched too"), GetFilteredPaths(Index, TEXT("filler/l_filler_07"), NoTags).Num(), 1);
+	TestEqual(TEXT("Unknown text matches nothing"), GetFilteredPaths(Index, TEXT("volcano"), NoTags).Num(), 0);
+
+	const TSharedPtr<FLevelSelectorItem> DesertItem = Index.FindItem(TEXT("/Game/Tests/L_Desert_Art"));
+	TestTrue(TEXT("MatchesSearch agrees with GetFilteredItems"), DesertItem.IsValid() && Index.MatchesSearch(*DesertItem, FLevelSelectorSearchIndex::Fold(TEXT("desert"))));
+	TestFalse(TEXT("MatchesSearch rejects other levels"), DesertItem.IsValid() && Index.MatchesSearch(*DesertItem, FLevelSelectorSearchIndex::Fold(TEXT("forest"))));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLevelSelectorIndexTagQueryTest, "BDC.LevelSelector.Index.TagQuery", LevelSelectorTests::TestFlags)
+bool FLevelSelectorIndexTagQueryTest::RunTest(const FString& Parameters)
+{
+	using namespace LevelSelectorTests;
+	FScopedSettingsOverride SettingsOverride;
+	SettingsOverride.SetTags(TEXT("/Game/Tests/L_Desert"), FGameplayTagContainer(TAG_Env_Desert));
+	FGameplayTagContainer ForestTags(TAG_Env_Forest);
+	ForestTags.AddTag(TAG_Kind_Gym);
+	SettingsOverride.SetTags(TEXT("/Game/Tests/L_Forest"), ForestTags);
+
+	FLevelSelectorIndex Index;
+	Index.Reconcile({
+		MakeWorldAsset(TEXT("/Game/Tests/L_City")),
+		MakeWorldAsset(TEXT("/Game/Tests/L_Desert")),
+		MakeWorldAsset(TEXT("/Game/Tests/L_Forest")),
+	});
+
+	const FLevelSelectorTagIndex::FQuery EnvQuery = Index.MakeTagQuery(FGameplayTagContainer(TAG_Env), ELevelSelectorTagMatch::Any);
+	TestEqual(TEXT("A parent tag matches levels with any of its child tags"),
+		GetFilteredPaths(Index, TEXT(""), EnvQuery),
+		TArray<FString>{ TEXT("/Game/Tests/L_Desert"), TEXT("/Game/Tests/L_Forest") });
+
+	FGameplayTagContainer DesertOrGym(TAG_Env_Desert);
+	DesertOrGym.AddTag(TAG_Kind_Gym);
+	TestEqual(TEXT("Any needs one of the tags"),
+		GetFilteredPaths(Index, TEXT(""), Index.MakeTagQuery(DesertOrGym, ELevelSelectorTagMatch::Any)),
+		TArray<FString>{ TEXT("/Game/Tests/L_Desert"), TEXT("/Game/Tests/L_Forest") });
+	TestEqual(TEXT("All needs every tag"),
+		GetFilteredPaths(Index, TEXT(""), Index.MakeTagQuery(DesertOrGym, ELevelSelectorTagMatch::All)).Num(), 0);
+
+	FGameplayTagContainer EnvAndGym(TAG_Env);
+	EnvAndGym.AddTag(TAG_Kind_Gym);
+	TestEqual(TEXT("All matches parents of the level's tags"),
+		GetFilteredPaths(Index, TEXT(""), Index.MakeTagQuery(EnvAndGym, ELevelSelectorTagMatch::All)),
+		TArray<FString>{ TEXT("/Game/Tests/L_Forest") });
+
+	TestEqual(TEXT("Text and tag filters combine"), GetFilteredPaths(Index, TEXT("desert"), EnvQuery), TArray<FString>{ TEXT("/Game/Tests/L_Desert") });
+	TestEqual(TEXT("An empty tag query lets every level pass"),
+		GetFilteredPaths(Index, TEXT(""), Index.MakeTagQuery(FGameplayTagContainer(), ELevelSelectorTagMatch::All)).Num(), 3);
+
+	const TSharedPtr<FLevelSelectorItem> CityItem = Index.FindItem(TEXT("/Game/Tests/L_City"));
+	TestTrue(TEXT("The query is compiled against the current tag bits"), Index.IsTagQueryCurrent(EnvQuery));
+	TestFalse(TEXT("MatchesTags rejects untagged levels"), CityItem.IsValid() && Index.MatchesTags(*CityItem, EnvQuery));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLevelSelectorIndexCacheTest, "BDC.LevelSelector.Index.CacheRoundTrip", LevelSelectorTests::TestFlags)
+bool FLevelSelectorIndexCacheTest::RunTest(const FString& Parameters)
+{
+	using namespace LevelSelectorTests;
+	FScopedSettingsOverride SettingsOverride;
+	SettingsOverride.SetFavorite(TEXT("/Game/Tests/L_Forest"));
+	FGameplayTagContainer ForestTags(TAG_Env_Forest);
+	ForestTags.AddTag(TAG_Kind_Gym);
+	SettingsOverride.SetTags(TEXT("/Game/Tests/L_Forest"), ForestTags);
+
+	FLevelSelectorIndex Index;
+	Index.Reconcile({
+		MakeWorldAsset(TEXT("/Game/Tests/L_Desert")),
+		MakeWorldAsset(TEXT("/Game/Tests/L_Forest")),
+		MakeWorldAsset(TEXT("/Game/Tests/W\u00FCste/L_D\u00FCne")),
+	});
+
+	// Parsed from memory, the cache file under Saved/ is left alone.
+	const TArray<uint8> Data = FLevelSelectorIndexCache::Serialize(Index.GetSortedItems());
+	TArray<FLevelSelectorIndexCache::FEntry> Entries;
+	if (!TestTrue(TEXT("The serialized index parses"), FLevelSelectorIndexCache::Parse(Data.GetData(), Data.Num(), Entries)))
+	{
+		return false;
+	}
+
+	const TArray<TSharedPtr<FLevelSelectorItem>>& Items = Index.GetSortedItems();
+	if (!TestEqual(TEXT("Every item is written"), Entries.Num(), Items.Num()))
+	{
+		return false;
+	}
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+	{
+		const FLevelSelectorIndexCache::FEntry& Entry = Entries[EntryIndex];
+		const FLevelSelectorItem& Item = *Items[EntryIndex];
+		TestEqual(TEXT("Entries keep the index order"), Entry.PackageName, Item.PackageName);
+		TestEqual(TEXT("Asset names survive, including non-ASCII ones"), Entry.AssetName, Item.AssetData.AssetName);
+		TestEqual(TEXT("The favorite state survives"), Entry.bIsFavorite, Item.bIsFavorite);
+	}
+	TestEqual(TEXT("Tags are written comma separated"), Entries[0].Tags,
+		FString::Printf(TEXT("%s,%s"), *FGameplayTag(TAG_Env_Forest).ToString(), *FGameplayTag(TAG_Kind_Gym).ToString()));
+
+	TArray<FLevelSelectorIndexCache::FEntry> Rejected;
+	AddExpectedError(TEXT("Ignoring truncated level index cache"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestFalse(TEXT("Truncated data is rejected"), FLevelSelectorIndexCache::Parse(Data.GetData(), Data.Num() - 1, Rejected));
+
+	TArray<uint8> Corrupted = Data;
+	Corrupted[0] ^= 0xFF;
+	TestFalse(TEXT("Data with a wrong magic is rejected"), FLevelSelectorIndexCache::Parse(Corrupted.GetData(), Corrupted.Num(), Rejected));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLevelSelectorIndexIncrementalOrderTest, "BDC.LevelSelector.Index.IncrementalOrder", LevelSelectorTests::TestFlags)
+bool FLevelSelectorIndexIncrementalOrderTest::RunTest(const FString& Parameters)
+{
+	using namespace LevelSelectorTests;
+	FScopedSettingsOverride SettingsOverride;
+
+	FLevelSelectorIndex Index;
+	TArray<FAssetData> Assets = {
+		MakeWorldAsset(TEXT("/Game/Tests/L_A")),
+		MakeWorldAsset(TEXT("/Game/Tests/L_B")),
+		MakeWorldAsset(TEXT("/Game/Tests/L_C")),
+		MakeWorldAsset(TEXT("/Game/Tests/L_D")),
+	};
+	Index.Reconcile(Assets);
+
+	// Re-sorted twice before the next read, the second change finds the item still queued.
+	const TSharedPtr<FLevelSelectorItem> CItem = Index.FindItem(TEXT("/Game/Tests/L_C"));
+	Index.UpdateItem(CItem, [&SettingsOverride]() { SettingsOverride.SetFavorite(TEXT("/Game/Tests/L_C")); });
+	Index.UpdateItem(CItem, []() {});
+	TestEqual(TEXT("Re-sorted items move to their new place"),
+		GetPackagePaths(Index.GetSortedItems()),
+		TArray<FString>{ TEXT("/Game/Tests/L_C"), TEXT("/Game/Tests/L_A"), TEXT("/Game/Tests/L_B"), TEXT("/Game/Tests/L_D") });
+
+	Assets.RemoveAt(1);
+	Assets.RemoveAt(0);
+	Assets.Add(MakeWorldAsset(TEXT("/Game/Tests/L_E")));
+	Assets.Add(MakeWorldAsset(TEXT("/Game/Tests/L_0")));
+	Index.Reconcile(Assets);
+	TestEqual(TEXT("Removals and additions of one batch are applied in one compaction"),
+		GetPackagePaths(Index.GetSortedItems()),
+		TArray<FString>{ TEXT("/Game/Tests/L_C"), TEXT("/Game/Tests/L_0"), TEXT("/Game/Tests/L_D"), TEXT("/Game/Tests/L_E") });
+
+	const FLevelSelectorTagIndex::FQuery NoTags = Index.MakeTagQuery(FGameplayTagContainer(), ELevelSelectorTagMatch::Any);
+	TestEqual(TEXT("Filtered reads see the compacted order too"), GetFilteredPaths(Index, TEXT("l_"), NoTags), GetPackagePaths(Index.GetSortedItems()));
+	return true;
+}
+
+#endif
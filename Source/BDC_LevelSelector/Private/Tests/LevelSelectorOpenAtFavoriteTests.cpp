@@ -0,0 +1,67 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "LevelSelectorTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "BDC_LevelSelectorSettings.h"
+#include "LevelSelectorCameraFavoriteStore.h"
+#include "LevelSelectorIndex.h"
+#include "LevelSelectorRegionLoader.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLevelSelectorOpenAtFavoriteFlagTest, "BDC.LevelSelector.OpenAtFavorite.HasFavoritesFlag", LevelSelectorTests::TestFlags)
+bool FLevelSelectorOpenAtFavoriteFlagTest::RunTest(const FString& Parameters)
+{
+	using namespace LevelSelectorTests;
+	FScopedSettingsOverride SettingsOverride;
+	UBDC_LevelSelectorSettings* Settings = SettingsOverride.Get();
+
+	// A folder no project uses, its files are removed again at the end.
+	const FString PackageName = TEXT("/Game/__LevelSelectorAutomation__/L_OpenAt");
+	const FSoftObjectPath LevelPath = MakeWorldPath(PackageName);
+	const FName PackageFName(*PackageName);
+
+	const TSharedRef<FLevelSelectorItem> Before = FLevelSelectorItem::Create(MakeWorldAsset(PackageName));
+	TestFalse(TEXT("A level without favorites is not flagged"), Before->bHasCameraFavorites);
+
+	Settings->AddCameraFavorite(LevelPath, TEXT("Entrance"), FTransform(FVector(100.0, 0.0, 0.0)));
+	TestTrue(TEXT("The settings know about the new favorite"), Settings->HasCameraFavorites(PackageFName));
+	const TSharedRef<FLevelSelectorItem> After = FLevelSelectorItem::Create(MakeWorldAsset(PackageName));
+	TestTrue(TEXT("A level with favorites is flagged"), After->bHasCameraFavorites);
+
+	Settings->RemoveCameraFavorite(LevelPath, TEXT("Entrance"));
+	TestFalse(TEXT("Removing the last favorite clears the level"), Settings->HasCameraFavorites(PackageFName));
+	After->RefreshCachedState(Settings);
+	TestFalse(TEXT("A refreshed item drops the flag"), After->bHasCameraFavorites);
+
+	IFileManager::Get().DeleteDirectory(*(FLevelSelectorCameraFavoriteStore::GetRootDir() / TEXT("Game") / TEXT("__LevelSelectorAutomation__")), false, true);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLevelSelectorOpenAtFavoriteRegionTest, "BDC.LevelSelector.OpenAtFavorite.RegionLoader", LevelSelectorTests::TestFlags)
+bool FLevelSelectorOpenAtFavoriteRegionTest::RunTest(const FString& Parameters)
+{
+	TestFalse(TEXT("Nothing is loaded without a world"), FLevelSelectorRegionLoader::LoadAround(nullptr, FVector::ZeroVector, 1000.0));
+	TestEqual(TEXT("Nothing is unloaded without a world"), FLevelSelectorRegionLoader::UnloadRegions(nullptr), 0);
+
+	// Levels without World Partition were loaded as a whole by LoadMap, there is no region to load or unload.
+	UWorld* World = UWorld::CreateWorld(EWorldType::Inactive, false);
+	if (!TestNotNull(TEXT("A world without partition was created"), World))
+	{
+		return false;
+	}
+	TestFalse(TEXT("A level without World Partition loads no region"), FLevelSelectorRegionLoader::LoadAround(World, FVector::ZeroVector, 1000.0));
+	TestEqual(TEXT("A level without World Partition has no regions to unload"), FLevelSelectorRegionLoader::UnloadRegions(World), 0);
+	World->DestroyWorld(false);
+	return true;
+}
+
+#endif
@@ -0,0 +1,63 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "LevelSelectorTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "LevelSelectorPathFilter.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLevelSelectorPathFilterMatchesTest, "BDC.LevelSelector.PathFilter.Matches", LevelSelectorTests::TestFlags)
+bool FLevelSelectorPathFilterMatchesTest::RunTest(const FString& Parameters)
+{
+	FLevelSelectorPathFilter Filter;
+	TestFalse(TEXT("A filter without rules matches nothing"), Filter.Matches(TEXT("/Game/Maps/L_Desert")));
+
+	Filter.Compile(TArray<FString>{ TEXT("/Game/"), TEXT("/Game/Developers/Shared") }, TArray<FString>{ TEXT("/Game/Developers/") });
+	TestTrue(TEXT("An include covers the folders below it"), Filter.Matches(TEXT("/Game/Maps/L_Desert")));
+	TestTrue(TEXT("Paths compare case-insensitively"), Filter.Matches(TEXT("/game/maps/L_Desert")));
+	TestFalse(TEXT("A deeper exclude wins over the include above it"), Filter.Matches(TEXT("/Game/Developers/Someone/L_Gym")));
+	TestTrue(TEXT("A deeper include wins over the exclude above it"), Filter.Matches(TEXT("/Game/Developers/Shared/L_Gym")));
+	TestFalse(TEXT("Mount points without a rule are not matched"), Filter.Matches(TEXT("/MyPlugin/Maps/L_Desert")));
+	TestFalse(TEXT("Rules match whole segments only"), Filter.Matches(TEXT("/GameExtra/Maps/L_Desert")));
+
+	Filter.Compile(TArray<FString>{ TEXT("/Game/Maps") }, TArray<FString>{ TEXT("/Game/Maps/") });
+	TestFalse(TEXT("An exclude wins over an include of the same path"), Filter.Matches(TEXT("/Game/Maps/L_Desert")));
+
+	Filter.Compile(TArray<FString>{ TEXT("  Game/Maps  "), TEXT(""), TEXT("   ") }, {});
+	TestTrue(TEXT("A missing leading slash and surrounding blanks are ignored"), Filter.Matches(TEXT("/Game/Maps/L_Desert")));
+	TestEqual(TEXT("Empty patterns add no nodes"), Filter.GetNumNodes(), 3);
+
+	Filter.Compile(TArray<FString>{ TEXT("/") }, TArray<FString>{ TEXT("/Engine/") });
+	TestTrue(TEXT("The root pattern matches every mount point"), Filter.Matches(TEXT("/MyPlugin/Maps/L_Desert")));
+	TestFalse(TEXT("Excludes still apply below the root pattern"), Filter.Matches(TEXT("/Engine/Maps/L_Entry")));
+
+	Filter.Compile({}, {});
+	TestEqual(TEXT("Compiling replaces all rules"), Filter.GetNumNodes(), 1);
+	TestFalse(TEXT("Compiling without rules matches nothing"), Filter.Matches(TEXT("/MyPlugin/Maps/L_Desert")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLevelSelectorPathFilterCouldMatchBelowTest, "BDC.LevelSelector.PathFilter.CouldMatchBelow", LevelSelectorTests::TestFlags)
+bool FLevelSelectorPathFilterCouldMatchBelowTest::RunTest(const FString& Parameters)
+{
+	FLevelSelectorPathFilter Filter;
+	Filter.Compile(TArray<FString>{ TEXT("/Game/Maps/Shared") }, {});
+	TestTrue(TEXT("A root above an include can match"), Filter.CouldMatchBelow(TEXT("/Game")));
+	TestTrue(TEXT("A root covered by an include can match"), Filter.CouldMatchBelow(TEXT("/Game/Maps/Shared/Desert")));
+	TestFalse(TEXT("A sibling of an include cannot match"), Filter.CouldMatchBelow(TEXT("/Game/Art")));
+	TestFalse(TEXT("Another mount point cannot match"), Filter.CouldMatchBelow(TEXT("/Engine")));
+
+	Filter.Compile(TArray<FString>{ TEXT("/Game/"), TEXT("/Game/Developers/Shared") }, TArray<FString>{ TEXT("/Game/Developers/") });
+	TestTrue(TEXT("An excluded root with an include below it can match"), Filter.CouldMatchBelow(TEXT("/Game/Developers")));
+	TestFalse(TEXT("A root covered by an exclude cannot match"), Filter.CouldMatchBelow(TEXT("/Game/Developers/Someone")));
+	TestTrue(TEXT("A root covered by an include can match even without nodes for it"), Filter.CouldMatchBelow(TEXT("/Game/Maps/Desert")));
+	return true;
+}
+
+#endif
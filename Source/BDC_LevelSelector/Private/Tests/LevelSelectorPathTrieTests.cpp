@@ -0,0 +1,160 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "LevelSelectorTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "LevelSelectorIndex.h"
+#include "LevelSelectorPathTrie.h"
+
+namespace LevelSelectorTests
+{
+	static TArray<FString> GetNodeNames(TConstArrayView<TSharedPtr<FLevelSelectorTreeNode>> Nodes)
+	{
+		TArray<FString> Names;
+		for (const TSharedPtr<FLevelSelectorTreeNode>& Node : Nodes)
+		{
+			Names.Add(Node->IsFolder() ? Node->Name : Node->Level->PackagePath);
+		}
+		return Names;
+	}
+
+	static FLevelSelectorTreeNode* FindFolderNode(const FLevelSelectorPathTrie& Trie, const FString& Path)
+	{
+		TArray<FString> Segments;
+		Path.ParseIntoArray(Segments, TEXT("/"));
+		const TArray<TSharedPtr<FLevelSelectorTreeNode>>* Folders = &Trie.GetRootFolders();
+		FLevelSelectorTreeNode* Found = nullptr;
+		for (const FString& Segment : Segments)
+		{
+			const TSharedPtr<FLevelSelectorTreeNode>* Child = Folders->FindByPredicate([&Segment](const TSharedPtr<FLevelSelectorTreeNode>& Node) { return Node->Name == Segment; });
+			if (!Child)
+			{
+				return nullptr;
+			}
+			Found = Child->Get();
+			Folders = &Found->Folders;
+		}
+		return Found;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLevelSelectorPathTrieMaintenanceTest, "BDC.LevelSelector.PathTrie.Maintenance", LevelSelectorTests::TestFlags)
+bool FLevelSelectorPathTrieMaintenanceTest::RunTest(const FString& Parameters)
+{
+	using namespace LevelSelectorTests;
+	FScopedSettingsOverride SettingsOverride;
+
+	const TSharedPtr<FLevelSelectorItem> Dune = FLevelSelectorItem::Create(MakeWorldAsset(TEXT("/Game/Maps/Desert/L_Dune")));
+	const TSharedPtr<FLevelSelectorItem> Oasis = FLevelSelectorItem::Create(MakeWorldAsset(TEXT("/Game/Maps/Desert/L_Oasis")));
+	const TSharedPtr<FLevelSelectorItem> Grove = FLevelSelectorItem::Create(MakeWorldAsset(TEXT("/Game/Maps/Forest/L_Grove")));
+	const TSharedPtr<FLevelSelectorItem> Gym = FLevelSelectorItem::Create(MakeWorldAsset(TEXT("/Game/Gym/L_Gym")));
+	const TSharedPtr<FLevelSelectorItem> PluginLevel = FLevelSelectorItem::Create(MakeWorldAsset(TEXT("/PluginMaps/L_Plugin")));
+
+	FLevelSelectorPathTrie Trie;
+	Trie.Build({ Dune, Oasis, Grove, Gym, PluginLevel });
+
+	TestEqual(TEXT("One root folder per mount point, sorted by name"), GetNodeNames(Trie.GetRootFolders()), TArray<FString>{ TEXT("Game"), TEXT("PluginMaps") });
+	TestEqual(TEXT("One folder per path segment"), Trie.GetNumFolders(), 6);
+
+	FLevelSelectorTreeNode* GameFolder = FindFolderNode(Trie, TEXT("Game"));
+	FLevelSelectorTreeNode* DesertFolder = FindFolderNode(Trie, TEXT("Game/Maps/Desert"));
+	if (!TestNotNull(TEXT("The game folder exists"), GameFolder) || !TestNotNull(TEXT("Nested folders exist"), DesertFolder))
+	{
+		return false;
+	}
+	TestEqual(TEXT("Sub folders are sorted by name"), GetNodeNames(GameFolder->Folders), TArray<FString>{ TEXT("Gym"), TEXT("Maps") });
+	TestEqual(TEXT("Folders count the levels below them"), GameFolder->NumLevels, 4);
+	TestEqual(TEXT("Folders know their package path"), DesertFolder->Path, FString(TEXT("/Game/Maps/Desert")));
+	TestEqual(TEXT("Levels are listed in index order"), GetNodeNames(DesertFolder->Levels),
+		TArray<FString>{ TEXT("/Game/Maps/Desert/L_Dune"), TEXT("/Game/Maps/Desert/L_Oasis") });
+
+	const TSharedPtr<FLevelSelectorTreeNode> DuneNode = Trie.FindLevelNode(*Dune);
+	TestTrue(TEXT("A level node is found in its folder"), DuneNode.IsValid() && DuneNode->Parent == DesertFolder);
+
+	Oasis->bIsFavorite = true;
+	Trie.Update(Oasis);
+	TestEqual(TEXT("A new favorite moves to the front of its folder"), GetNodeNames(DesertFolder->Levels),
+		TArray<FString>{ TEXT("/Game/Maps/Desert/L_Oasis"), TEXT("/Game/Maps/Desert/L_Dune") });
+
+	Trie.Remove(Grove);
+	TestNull(TEXT("A folder left without levels is removed"), FindFolderNode(Trie, TEXT("Game/Maps/Forest")));
+	TestEqual(TEXT("Removing a level updates the counts on its path"), GameFolder->NumLevels, 3);
+	TestEqual(TEXT("The removed folder is forgotten"), Trie.GetNumFolders(), 5);
+
+	Trie.Remove(PluginLevel);
+	TestEqual(TEXT("An empty mount point is removed"), GetNodeNames(Trie.GetRootFolders()), TArray<FString>{ TEXT("Game") });
+
+	Trie.Add(Grove);
+	TestNotNull(TEXT("Adding a level creates its folders again"), FindFolderNode(Trie, TEXT("Game/Maps/Forest")));
+	TestEqual(TEXT("Adding a level updates the counts on its path"), GameFolder->NumLevels, 4);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLevelSelectorPathTrieFilterTest, "BDC.LevelSelector.PathTrie.Filter", LevelSelectorTests::TestFlags)
+bool FLevelSelectorPathTrieFilterTest::RunTest(const FString& Parameters)
+{
+	using namespace LevelSelectorTests;
+	FScopedSettingsOverride SettingsOverride;
+
+	const TSharedPtr<FLevelSelectorItem> Dune = FLevelSelectorItem::Create(MakeWorldAsset(TEXT("/Game/Maps/Desert/L_Dune")));
+	const TSharedPtr<FLevelSelectorItem> Oasis = FLevelSelectorItem::Create(MakeWorldAsset(TEXT("/Game/Maps/Desert/L_Oasis")));
+	const TSharedPtr<FLevelSelectorItem> Grove = FLevelSelectorItem::Create(MakeWorldAsset(TEXT("/Game/Maps/Forest/L_Grove")));
+	const TSharedPtr<FLevelSelectorItem> Gym = FLevelSelectorItem::Create(MakeWorldAsset(TEXT("/Game/Gym/L_Gym")));
+
+	FLevelSelectorPathTrie Trie;
+	Trie.Build({ Dune, Oasis, Grove, Gym });
+	FLevelSelectorTreeNode* GameFolder = FindFolderNode(Trie, TEXT("Game"));
+	FLevelSelectorTreeNode* MapsFolder = FindFolderNode(Trie, TEXT("Game/Maps"));
+	FLevelSelectorTreeNode* DesertFolder = FindFolderNode(Trie, TEXT("Game/Maps/Desert"));
+	FLevelSelectorTreeNode* ForestFolder = FindFolderNode(Trie, TEXT("Game/Maps/Forest"));
+	if (!GameFolder || !MapsFolder || !DesertFolder || !ForestFolder)
+	{
+		AddError(TEXT("The trie is missing folders."));
+		return false;
+	}
+
+	FLevelSelectorTreeFilter Filter;
+	TArray<TSharedPtr<FLevelSelectorTreeNode>> Children;
+	Filter.GetVisibleChildren(*MapsFolder, Children);
+	TestEqual(TEXT("An inactive filter shows everything"), GetNodeNames(Children), TArray<FString>{ TEXT("Desert"), TEXT("Forest") });
+
+	Trie.Filter(TEXT("desert"), {}, nullptr, Filter);
+	TestTrue(TEXT("A folder matching the query is taken as a whole"), Filter.MatchedFolders.Contains(DesertFolder));
+	TestTrue(TEXT("The path to a matched folder is visible"), Filter.VisibleFolders.Contains(MapsFolder) && Filter.VisibleFolders.Contains(GameFolder));
+	Children.Reset();
+	Filter.GetVisibleChildren(*MapsFolder, Children);
+	TestEqual(TEXT("Folders off the matched path are hidden"), GetNodeNames(Children), TArray<FString>{ TEXT("Desert") });
+	Children.Reset();
+	Filter.GetVisibleChildren(*DesertFolder, Children);
+	TestEqual(TEXT("A matched folder shows all its levels"), Children.Num(), 2);
+	TestTrue(TEXT("Levels below a matched folder count as matched"), Filter.IsInMatchedFolder(*Trie.FindLevelNode(*Dune)));
+
+	Trie.Filter(TEXT("maps/forest"), {}, nullptr, Filter);
+	TestTrue(TEXT("A query with a slash matches the folder path"), Filter.MatchedFolders.Contains(ForestFolder));
+	TestFalse(TEXT("A path query does not match other folders"), Filter.MatchedFolders.Contains(DesertFolder) || Filter.MatchedFolders.Contains(MapsFolder));
+
+	Trie.Filter(TEXT("desert"), {}, [Dune](const FLevelSelectorItem& Item) { return &Item == Dune.Get(); }, Filter);
+	TestTrue(TEXT("With a level filter, matched folders are not taken as a whole"), Filter.MatchedFolders.IsEmpty());
+	TestTrue(TEXT("Levels below a matched folder have to pass the level filter"),
+		Filter.VisibleLevels.Contains(Dune.Get()) && !Filter.VisibleLevels.Contains(Oasis.Get()));
+
+	Trie.Filter(TEXT("gym"), { Grove }, nullptr, Filter);
+	TestTrue(TEXT("Levels that matched on their own are visible"), Filter.VisibleLevels.Contains(Grove.Get()));
+	TestTrue(TEXT("The path to a matching level is visible"), Filter.VisibleFolders.Contains(ForestFolder) && Filter.VisibleFolders.Contains(MapsFolder));
+	Children.Reset();
+	Filter.GetVisibleChildren(*GameFolder, Children);
+	TestEqual(TEXT("Matched folders and paths to matching levels are both shown"), GetNodeNames(Children), TArray<FString>{ TEXT("Gym"), TEXT("Maps") });
+	Children.Reset();
+	Filter.GetVisibleChildren(*MapsFolder, Children);
+	TestEqual(TEXT("Folders without a match stay hidden"), GetNodeNames(Children), TArray<FString>{ TEXT("Forest") });
+	return true;
+}
+
+#endif
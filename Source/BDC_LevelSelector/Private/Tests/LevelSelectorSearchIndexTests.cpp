@@ -0,0 +1,74 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "LevelSelectorTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "LevelSelectorSearchIndex.h"
+#include "Algo/Sort.h"
+#include "String/Find.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLevelSelectorSearchIndexTest, "BDC.LevelSelector.SearchIndex.MatchesScan", LevelSelectorTests::TestFlags)
+bool FLevelSelectorSearchIndexTest::RunTest(const FString& Parameters)
+{
+	// Enough entries that common grams switch to bit sets and back while entries are removed.
+	const TCHAR* Regions[] = { TEXT("Desert"), TEXT("Forest"), TEXT("Arctic"), TEXT("City") };
+	TMap<int32, FString> TextsById;
+	FLevelSelectorSearchIndex SearchIndex;
+	for (int32 Index = 0; Index < 3000; ++Index)
+	{
+		const FString Text = FString::Printf(TEXT("L_%s_%04d"), Regions[Index % UE_ARRAY_COUNT(Regions)], Index);
+		TextsById.Add(SearchIndex.Add({ FStringView(Text) }), FLevelSelectorSearchIndex::Fold(Text));
+	}
+
+	const auto CheckAgainstScan = [this, &SearchIndex, &TextsById](const TCHAR* Context)
+	{
+		const TCHAR* Queries[] = { TEXT("d"), TEXT("z"), TEXT("_"), TEXT("de"), TEXT("t_"), TEXT("ci"), TEXT("des"), TEXT("y_0"), TEXT("city_"), TEXT("_0042"), TEXT("arctic_2999"), TEXT("nomatch") };
+		for (const TCHAR* Query : Queries)
+		{
+			TArray<int32> Expected;
+			for (const TPair<int32, FString>& Pair : TextsById)
+			{
+				if (UE::String::FindFirst(Pair.Value, Query, ESearchCase::CaseSensitive) != INDEX_NONE)
+				{
+					Expected.Add(Pair.Key);
+				}
+			}
+			TArray<int32> Found;
+			SearchIndex.Find(Query, Found);
+			Algo::Sort(Expected);
+			Algo::Sort(Found);
+			TestEqual(*FString::Printf(TEXT("%s: \"%s\" finds the same entries as a scan"), Context, Query), Found, Expected);
+		}
+	};
+	CheckAgainstScan(TEXT("Built"));
+
+	// Removes most entries, which moves the common grams back to sorted id lists, then reuses some of the ids.
+	for (int32 Id = 0; Id < 3000; ++Id)
+	{
+		if (Id % 7 != 0)
+		{
+			SearchIndex.Remove(Id);
+			TextsById.Remove(Id);
+		}
+	}
+	CheckAgainstScan(TEXT("Removed"));
+
+	for (int32 Index = 0; Index < 50; ++Index)
+	{
+		const FString Text = FString::Printf(TEXT("L_Swamp_City_%02d"), Index);
+		TextsById.Add(SearchIndex.Add({ FStringView(Text) }), FLevelSelectorSearchIndex::Fold(Text));
+	}
+	CheckAgainstScan(TEXT("Readded"));
+
+	TestEqual(TEXT("Num counts the live entries"), SearchIndex.Num(), TextsById.Num());
+	return true;
+}
+
+#endif
@@ -0,0 +1,67 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "LevelSelectorTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "BDC_LevelSelectorSettings.h"
+#include "LevelSelectorIndex.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLevelSelectorSoftPathMutatorTest, "BDC.LevelSelector.Settings.SoftPathMutatorsDontLoad", LevelSelectorTests::TestFlags)
+bool FLevelSelectorSoftPathMutatorTest::RunTest(const FString& Parameters)
+{
+	using namespace LevelSelectorTests;
+
+	// Any engine map that exists on disk and is not loaded yet will do.
+	const TCHAR* CandidateMaps[] = { TEXT("/Engine/Maps/Entry"), TEXT("/Engine/Maps/Templates/Template_Default"), TEXT("/Engine/Maps/Templates/OpenWorld") };
+	FString PackageName;
+	for (const TCHAR* CandidateMap : CandidateMaps)
+	{
+		if (FPackageName::DoesPackageExist(CandidateMap) && !FindObject<UPackage>(nullptr, CandidateMap))
+		{
+			PackageName = CandidateMap;
+			break;
+		}
+	}
+	if (PackageName.IsEmpty())
+	{
+		AddInfo(TEXT("Every candidate map is already loaded or missing, nothing to test."));
+		return true;
+	}
+
+	FScopedSettingsOverride SettingsOverride;
+	UBDC_LevelSelectorSettings* Settings = SettingsOverride.Get();
+	const FSoftObjectPath LevelPath = MakeWorldPath(PackageName);
+	const FName PackageFName(*PackageName);
+
+	Settings->AddFavorite(LevelPath);
+	TestTrue(TEXT("The level is a favorite"), Settings->IsFavorite(PackageFName));
+	Settings->SetLevelTags(LevelPath, FGameplayTagContainer(TAG_Env_Desert));
+	TestTrue(TEXT("The level has its tag"), Settings->GetLevelTags(LevelPath).HasTagExact(TAG_Env_Desert));
+
+	// The index reads the same state through its items, which only carry the registry entry.
+	FLevelSelectorIndex Index;
+	Index.Reconcile({ MakeWorldAsset(PackageName) });
+	const TSharedPtr<FLevelSelectorItem> Item = Index.FindItem(PackageFName);
+	if (TestTrue(TEXT("The favorite is indexed outside of the content roots"), Item.IsValid()))
+	{
+		Index.UpdateItem(Item, [Settings, &LevelPath]() { Settings->SetLevelTags(LevelPath, FGameplayTagContainer()); });
+		TestTrue(TEXT("The item lost its tag"), Item->Tags.IsEmpty());
+	}
+
+	Settings->RemoveFavorite(LevelPath);
+	TestFalse(TEXT("The level is no favorite anymore"), Settings->IsFavorite(PackageFName));
+
+	TestNull(TEXT("Toggling favorites and tags did not load the level"), FindObject<UPackage>(nullptr, *PackageName));
+	return true;
+}
+
+#endif
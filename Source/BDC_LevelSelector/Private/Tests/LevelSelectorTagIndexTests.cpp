@@ -0,0 +1,72 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "LevelSelectorTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "LevelSelectorTagIndex.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLevelSelectorTagIndexTest, "BDC.LevelSelector.TagIndex.Matches", LevelSelectorTests::TestFlags)
+bool FLevelSelectorTagIndexTest::RunTest(const FString& Parameters)
+{
+	using namespace LevelSelectorTests;
+	FLevelSelectorTagIndex TagIndex;
+
+	FGameplayTagContainer ForestGym(TAG_Env_Forest);
+	ForestGym.AddTag(TAG_Kind_Gym);
+	TagIndex.SetTags(0, FGameplayTagContainer(TAG_Env_Desert));
+	TagIndex.SetTags(1, ForestGym);
+	TagIndex.SetTags(2, FGameplayTagContainer());
+
+	const FLevelSelectorTagIndex::FQuery EnvQuery = TagIndex.MakeQuery(FGameplayTagContainer(TAG_Env), ELevelSelectorTagMatch::Any);
+	TestTrue(TEXT("A parent tag matches a child tag"), TagIndex.Matches(0, EnvQuery));
+	TestTrue(TEXT("A parent tag matches any of its children"), TagIndex.Matches(1, EnvQuery));
+	TestFalse(TEXT("An untagged entry matches no tag"), TagIndex.Matches(2, EnvQuery));
+	TestFalse(TEXT("A sibling tag does not match"), TagIndex.Matches(0, TagIndex.MakeQuery(FGameplayTagContainer(TAG_Env_Forest), ELevelSelectorTagMatch::Any)));
+	TagIndex.SetTags(3, FGameplayTagContainer(TAG_Env));
+	TestFalse(TEXT("A child tag does not match its parent"), TagIndex.Matches(3, TagIndex.MakeQuery(FGameplayTagContainer(TAG_Env_Desert), ELevelSelectorTagMatch::Any)));
+
+	FGameplayTagContainer DesertAndGym(TAG_Env_Desert);
+	DesertAndGym.AddTag(TAG_Kind_Gym);
+	const FLevelSelectorTagIndex::FQuery AnyQuery = TagIndex.MakeQuery(DesertAndGym, ELevelSelectorTagMatch::Any);
+	const FLevelSelectorTagIndex::FQuery AllQuery = TagIndex.MakeQuery(DesertAndGym, ELevelSelectorTagMatch::All);
+	TestTrue(TEXT("Any matches one of the tags"), TagIndex.Matches(0, AnyQuery) && TagIndex.Matches(1, AnyQuery));
+	TestFalse(TEXT("All needs every tag"), TagIndex.Matches(0, AllQuery) || TagIndex.Matches(1, AllQuery));
+
+	const FLevelSelectorTagIndex::FQuery EmptyQuery = TagIndex.MakeQuery(FGameplayTagContainer(), ELevelSelectorTagMatch::All);
+	TestTrue(TEXT("An empty query has no mask"), EmptyQuery.IsEmpty());
+	TestTrue(TEXT("An empty query lets untagged entries pass"), TagIndex.Matches(2, EmptyQuery));
+	TestTrue(TEXT("An empty query lets unknown ids pass"), TagIndex.Matches(100, EmptyQuery));
+	TestFalse(TEXT("Unknown ids match no tag"), TagIndex.Matches(100, EnvQuery) || TagIndex.Matches(-1, EnvQuery));
+
+	// Compiled before the entry got its first tag, so the query has to survive the entry changing.
+	const FLevelSelectorTagIndex::FQuery GymQuery = TagIndex.MakeQuery(FGameplayTagContainer(TAG_Kind_Gym), ELevelSelectorTagMatch::Any);
+	TagIndex.SetTags(2, FGameplayTagContainer(TAG_Kind_Gym));
+	TestTrue(TEXT("A query sees tags set after it was compiled"), TagIndex.Matches(2, GymQuery));
+	TagIndex.SetTags(1, FGameplayTagContainer(TAG_Env_Desert));
+	TestFalse(TEXT("Replaced tags no longer match"), TagIndex.Matches(1, GymQuery));
+	TestTrue(TEXT("Replacing tags sets the new ones"), TagIndex.Matches(1, TagIndex.MakeQuery(FGameplayTagContainer(TAG_Env_Desert), ELevelSelectorTagMatch::All)));
+
+	TagIndex.Remove(0);
+	TestFalse(TEXT("A removed entry matches no tag"), TagIndex.Matches(0, EnvQuery));
+	TestTrue(TEXT("Removing an entry keeps the others"), TagIndex.Matches(1, EnvQuery));
+
+	const int32 NumBits = TagIndex.GetNumBits();
+	TagIndex.MakeQuery(FGameplayTagContainer(TAG_Env_Forest), ELevelSelectorTagMatch::Any);
+	TestEqual(TEXT("Tags get their bit once"), TagIndex.GetNumBits(), NumBits);
+
+	TestTrue(TEXT("Queries stay current while bits are added"), TagIndex.IsCurrent(EnvQuery));
+	TagIndex.Reset();
+	TestFalse(TEXT("Reset invalidates compiled queries"), TagIndex.IsCurrent(EnvQuery));
+	TestEqual(TEXT("Reset drops every bit"), TagIndex.GetNumBits(), 0);
+	TestFalse(TEXT("Reset drops every entry"), TagIndex.Matches(1, TagIndex.MakeQuery(FGameplayTagContainer(TAG_Env), ELevelSelectorTagMatch::Any)));
+	return true;
+}
+
+#endif
@@ -0,0 +1,85 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#include "LevelSelectorTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "BDC_LevelSelectorSettings.h"
+#include "Engine/World.h"
+#include "Misc/PackageName.h"
+
+namespace LevelSelectorTests
+{
+	UE_DEFINE_GAMEPLAY_TAG(TAG_Env, "LevelSelectorTest.Env");
+	UE_DEFINE_GAMEPLAY_TAG(TAG_Env_Desert, "LevelSelectorTest.Env.Desert");
+	UE_DEFINE_GAMEPLAY_TAG(TAG_Env_Forest, "LevelSelectorTest.Env.Forest");
+	UE_DEFINE_GAMEPLAY_TAG(TAG_Kind_Gym, "LevelSelectorTest.Kind.Gym");
+
+	FAssetData MakeWorldAsset(const FString& PackageName)
+	{
+		return FAssetData(FName(*PackageName), FName(*FPackageName::GetLongPackagePath(PackageName)),
+			FName(*FPackageName::GetShortName(PackageName)), UWorld::StaticClass()->GetClassPathName());
+	}
+
+	FSoftObjectPath MakeWorldPath(const FString& PackageName)
+	{
+		return FSoftObjectPath(PackageName + TEXT(".") + FPackageName::GetShortName(PackageName));
+	}
+
+	FScopedSettingsOverride::FScopedSettingsOverride()
+		: Settings(GetMutableDefault<UBDC_LevelSelectorSettings>())
+	{
+		SavedFavorites = MoveTemp(Settings->FavoriteLevels);
+		SavedTags = MoveTemp(Settings->LevelTagContainers);
+		SavedIncludedRoots = MoveTemp(Settings->IncludedContentRoots);
+		SavedExcludedRoots = MoveTemp(Settings->ExcludedContentRoots);
+		SavedQuietPeriod = Settings->SaveQuietPeriodSeconds;
+		bHadPendingSave = Settings->HasPendingConfigSave();
+
+		// Mutators called by a test only queue their save, it is dropped again below.
+		Settings->SaveQuietPeriodSeconds = 3600.0f;
+
+		Settings->FavoriteLevels.Reset();
+		Settings->LevelTagContainers.Reset();
+		Settings->IncludedContentRoots = { TEXT("/Game/") };
+		Settings->ExcludedContentRoots.Reset();
+		Settings->RebuildLevelLookups();
+	}
+
+	FScopedSettingsOverride::~FScopedSettingsOverride()
+	{
+		Settings->FavoriteLevels = MoveTemp(SavedFavorites);
+		Settings->LevelTagContainers = MoveTemp(SavedTags);
+		Settings->IncludedContentRoots = MoveTemp(SavedIncludedRoots);
+		Settings->ExcludedContentRoots = MoveTemp(SavedExcludedRoots);
+		Settings->SaveQuietPeriodSeconds = SavedQuietPeriod;
+		Settings->RebuildLevelLookups();
+
+		// A save that was queued before the test still writes, now with the restored values.
+		Settings->CancelConfigSave();
+		if (bHadPendingSave)
+		{
+			Settings->RequestConfigSave();
+		}
+	}
+
+	void FScopedSettingsOverride::SetFavorite(const FString& PackageName)
+	{
+		Settings->FavoriteLevels.AddUnique(TSoftObjectPtr<UWorld>(MakeWorldPath(PackageName)));
+		Settings->RebuildLevelLookups();
+	}
+
+	void FScopedSettingsOverride::SetTags(const FString& PackageName, const FGameplayTagContainer& Tags)
+	{
+		Settings->LevelTagContainers.Add(TSoftObjectPtr<UWorld>(MakeWorldPath(PackageName)), Tags);
+		Settings->RebuildLevelLookups();
+	}
+}
+
+#endif
@@ -0,0 +1,66 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AssetRegistry/AssetData.h"
+#include "GameplayTagContainer.h"
+#include "Misc/AutomationTest.h"
+#include "NativeGameplayTags.h"
+
+class UBDC_LevelSelectorSettings;
+class UWorld;
+
+namespace LevelSelectorTests
+{
+	/** Flags shared by all level selector tests. They need no map and run headless with -nullrhi. */
+	static constexpr auto TestFlags = EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter;
+
+	/** Registry entry of a world asset that does not exist on disk, e.g. "/Game/Tests/L_Desert". */
+	FAssetData MakeWorldAsset(const FString& PackageName);
+
+	/** Soft path of the world asset of MakeWorldAsset. */
+	FSoftObjectPath MakeWorldPath(const FString& PackageName);
+
+	/**
+	 * Replaces favorites, tags and content roots of the level selector settings for the lifetime of a test.
+	 * Only the in-memory settings change, the previous values are restored on destruction and saves requested
+	 * meanwhile are dropped, so nothing is written to config.
+	 */
+	class FScopedSettingsOverride
+	{
+	public:
+		FScopedSettingsOverride();
+		~FScopedSettingsOverride();
+
+		void SetFavorite(const FString& PackageName);
+		void SetTags(const FString& PackageName, const FGameplayTagContainer& Tags);
+
+		UBDC_LevelSelectorSettings* Get() const { return Settings; }
+
+	private:
+		UBDC_LevelSelectorSettings* Settings = nullptr;
+		TArray<TSoftObjectPtr<UWorld>> SavedFavorites;
+		TMap<TSoftObjectPtr<UWorld>, FGameplayTagContainer> SavedTags;
+		TArray<FString> SavedIncludedRoots;
+		TArray<FString> SavedExcludedRoots;
+		float SavedQuietPeriod = 0.0f;
+		bool bHadPendingSave = false;
+	};
+
+	UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Env);
+	UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Env_Desert);
+	UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Env_Forest);
+	UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Kind_Gym);
+}
+
+#endif
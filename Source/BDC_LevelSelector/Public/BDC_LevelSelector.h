@@ -11,8 +11,15 @@
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
 
+BDC_LEVELSELECTOR_API DECLARE_LOG_CATEGORY_EXTERN(LogBDCLevelSelector, Log, All);
+
 class SLevelSelectorComboBox;
 class SLevelSelectorCameraOverlay;
+class FLevelSelectorIndex;
+class FLevelSelectorPrefetcher;
+class FLevelSelectorSwitchTelemetry;
+class FLevelSelectorMetadataCache;
+class FLevelSelectorThumbnailCache;
 
 class BDC_LEVELSELECTOR_API FBDC_LevelSelectorModule : public IModuleInterface
 {
@@ -20,12 +27,37 @@ public:
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
 
+	/** Prefetcher of the editor session, null when running a commandlet. */
+	const TSharedPtr<FLevelSelectorPrefetcher>& GetPrefetcher() const { return Prefetcher; }
+
+	/** Level switch timings of the editor session, null when running a commandlet. */
+	const TSharedPtr<FLevelSelectorSwitchTelemetry>& GetSwitchTelemetry() const { return SwitchTelemetry; }
+
+	/** Level thumbnails of the editor session, null when running a commandlet. */
+	const TSharedPtr<FLevelSelectorThumbnailCache>& GetThumbnailCache() const { return ThumbnailCache; }
+
 private:
 	// Toolbar
 	void AddToolbarExtension(FToolBarBuilder& Builder);
 	TSharedPtr<FExtender> ToolbarExtender;
 	TSharedPtr<SLevelSelectorComboBox> LevelSelectorWidget;
 
+	// Level Index
+	TSharedPtr<FLevelSelectorIndex> LevelIndex;
+
+	// Prefetch
+	TSharedPtr<FLevelSelectorPrefetcher> Prefetcher;
+
+	// Telemetry
+	TSharedPtr<FLevelSelectorSwitchTelemetry> SwitchTelemetry;
+
+	// Metadata
+	TSharedPtr<FLevelSelectorMetadataCache> MetadataCache;
+	TSharedPtr<FLevelSelectorThumbnailCache> ThumbnailCache;
+
+	// Settings Persistence
+	void OnEnginePreExit();
+
 	// Camera Favorite
 	void OnMapOpened(const FString& Filename, bool bAsTemplate);
 	void OnPostEngineInit();
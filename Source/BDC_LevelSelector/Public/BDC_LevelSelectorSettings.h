@@ -13,6 +13,14 @@
 #include "Engine/DeveloperSettings.h"
 #include "BDC_LevelSelectorSettings.generated.h"
 
+class FLevelSelectorCameraFavoriteStore;
+class FLevelSelectorCameraSpatialIndex;
+class FLevelSelectorConfigWriter;
+struct FLevelSelectorConfigWriterStats;
+
+/** Camera favorites of a level were added, renamed or removed. An invalid path means any level may have changed. */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnCameraFavoritesChanged, const FSoftObjectPath& /*LevelPath*/);
+
 USTRUCT()
 struct FCameraFavorite
 {
@@ -34,29 +42,144 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category = "Level Selector")
 	TArray<TSoftObjectPtr<UWorld>> FavoriteLevels;
 	
-	/** A set of favorite levels. These levels will always appear at the top of the list. */
+	/** Tags of each level. Filtering by a tag also matches levels carrying one of its child tags. */
 	UPROPERTY(Config, EditAnywhere, Category = "Level Selector")
+	TMap<TSoftObjectPtr<UWorld>, FGameplayTagContainer> LevelTagContainers;
+
+	/** Single tag per level as saved by older versions, moved into LevelTagContainers on load. */
+	UPROPERTY(Config)
 	TMap<TSoftObjectPtr<UWorld>, FGameplayTag> LevelTags;
 
+	/** Mount points and folders whose levels are listed, e.g. "/Game/" or "/MyGameFeature/". "/" lists every mount point. */
+	UPROPERTY(Config, EditAnywhere, Category = "Content Roots")
+	TArray<FString> IncludedContentRoots;
+
+	/** Mount points and folders left out even if an included root contains them, e.g. "/Game/Developers/". */
+	UPROPERTY(Config, EditAnywhere, Category = "Content Roots")
+	TArray<FString> ExcludedContentRoots;
+
 	/** Restart the editor to apply the changes of this variable */
 	UPROPERTY(Config, EditAnywhere, Category = "Level Selector")
 	bool bDisplayCameraFavoritesOverlay;
+
+	/** Changes are written to the config file once no further change happened for this many seconds. 0 writes immediately. */
+	UPROPERTY(Config, EditAnywhere, Category = "Level Selector", meta = (ClampMin = "0.0", Units = "s"))
+	float SaveQuietPeriodSeconds;
 	
 	/** Adds a level to the favorite levels set. */
 	void AddFavorite(UWorld* TargetedLevel);
 
+	/** Adds a level to the favorite levels set without loading it. */
+	void AddFavorite(const FSoftObjectPath& LevelPath);
+
 	/** Removes a level from the favorite levels set. */
 	void RemoveFavorite(UWorld* TargetedLevel);
+
+	/** Removes a level from the favorite levels set without loading it. */
+	void RemoveFavorite(const FSoftObjectPath& LevelPath);
 	
-	/** Sets a Level Tag. */
-	void SetLevelTag(UWorld* TargetedLevel, FGameplayTag NewTag);
+	/** Sets the Tags of a Level. An empty container removes them. */
+	void SetLevelTags(UWorld* TargetedLevel, const FGameplayTagContainer& NewTags);
+
+	/** Sets the Tags of a Level without loading the level. An empty container removes them. */
+	void SetLevelTags(const FSoftObjectPath& LevelPath, const FGameplayTagContainer& NewTags);
 	
-	/** Returns a Level's Tag. */
-	FGameplayTag GetLevelTag(UWorld* TargetedLevel);
+	/** Returns a Level's Tags. */
+	const FGameplayTagContainer& GetLevelTags(UWorld* TargetedLevel) const;
+
+	/** Returns a Level's Tags without loading the level. */
+	const FGameplayTagContainer& GetLevelTags(const FSoftObjectPath& LevelPath) const;
+
+	/** Hashed favorite lookup by long package name. */
+	bool IsFavorite(FName PackageName) const { return FavoritePackages.Contains(PackageName); }
+
+	/** Hashed tag lookup by long package name. */
+	const FGameplayTagContainer& GetLevelTags(FName PackageName) const;
+
+	/** Single tag version of SetLevelTags from before levels had a tag container. Replaces all tags of the level, an invalid tag clears them. */
+	void SetLevelTag(UWorld* TargetedLevel, FGameplayTag NewTag) { SetLevelTags(TargetedLevel, NewTag.IsValid() ? FGameplayTagContainer(NewTag) : FGameplayTagContainer()); }
+	void SetLevelTag(const FSoftObjectPath& LevelPath, FGameplayTag NewTag) { SetLevelTags(LevelPath, NewTag.IsValid() ? FGameplayTagContainer(NewTag) : FGameplayTagContainer()); }
+
+	/** Single tag version of GetLevelTags from before levels had a tag container. Returns the first tag of the level. */
+	FGameplayTag GetLevelTag(UWorld* TargetedLevel) const { return GetLevelTags(TargetedLevel).First(); }
+	FGameplayTag GetLevelTag(const FSoftObjectPath& LevelPath) const { return GetLevelTags(LevelPath).First(); }
+	FGameplayTag GetLevelTag(FName PackageName) const { return GetLevelTags(PackageName).First(); }
+
+	/** Rebuilds the package name lookups from FavoriteLevels and LevelTagContainers. */
+	void RebuildLevelLookups();
+
+	virtual void PostInitProperties() override;
+	virtual void PostReloadConfig(FProperty* PropertyThatWasLoaded) override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
 	
-	/** Holds the Camera favorites per Level.*/
-	UPROPERTY(Config, EditAnywhere, Category = "Camera Favorites")
+	/** Camera favorites of all levels as saved by older versions, moved into per-level files on load. */
+	UPROPERTY(Config)
 	TMap<TSoftObjectPtr<UWorld>, FCameraFavorite> HoldFavorites;
+
+	/** Returns the camera favorites of a level, or nullptr if it has none. Reads the level's favorites file on first use. */
+	const FCameraFavorite* FindCameraFavorites(const FSoftObjectPath& LevelPath) const;
+
+	/** True if a level has camera favorites, without reading its favorites file. */
+	bool HasCameraFavorites(FName PackageName) const;
+
+	/** Returns the camera favorites of a level indexed by location, or nullptr if it has none. */
+	const FLevelSelectorCameraSpatialIndex* FindCameraFavoriteSpatialIndex(const FSoftObjectPath& LevelPath) const;
+
+	/** Adds or overwrites a camera favorite of a level. */
+	void AddCameraFavorite(const FSoftObjectPath& LevelPath, FName FavoriteName, const FTransform& CameraTransform);
+
+	/**
+	 * Adds many camera favorites of a level with a single write of its file. A name the level already uses gets a numbered
+	 * suffix, or replaces the existing favorite with bOverwrite. Returns the number written, 0 if the file could not be written.
+	 */
+	int32 AddCameraFavorites(const FSoftObjectPath& LevelPath, const TMap<FName, FTransform>& NewFavorites, bool bOverwrite = false, int32* OutNumReplaced = nullptr);
+
+	/** Renames a camera favorite of a level. Returns false if it does not exist. */
+	bool RenameCameraFavorite(const FSoftObjectPath& LevelPath, FName OldName, FName NewName);
+
+	/** Removes a camera favorite of a level. Returns false if it does not exist. */
+	bool RemoveCameraFavorite(const FSoftObjectPath& LevelPath, FName FavoriteName);
+
+	/** Moves the camera favorites of a renamed level along with it. */
+	void MoveCameraFavorites(FName OldPackageName, FName NewPackageName);
+
+	/** Deletes the camera favorites of levels for which DoesLevelExist returns false. */
+	void CollectCameraFavoriteGarbage(TFunctionRef<bool(FName)> DoesLevelExist);
+
+	FOnCameraFavoritesChanged& OnCameraFavoritesChanged() { return CameraFavoritesChangedDelegate; }
 	
+	/** Writes all settings to the project default config right away. */
 	void SaveToProjectDefaultConfig();
+
+	/** Queues a write-behind save, batched with other changes made within SaveQuietPeriodSeconds. */
+	void RequestConfigSave();
+
+	/** Writes a queued save right away. */
+	void FlushConfigSave();
+
+	/** Drops a queued save without writing it, e.g. after the in-memory changes were reverted. */
+	void CancelConfigSave();
+
+	bool HasPendingConfigSave() const;
+
+	const FLevelSelectorConfigWriterStats& GetConfigWriterStats() const;
+
+private:
+	/** Moves the legacy LevelTags into LevelTagContainers. Returns true if there was anything to move. */
+	bool MigrateLegacyLevelTags();
+
+	/** Moves the legacy HoldFavorites into the per-level files. Returns true if there was anything to move. */
+	bool MigrateLegacyCameraFavorites();
+
+	TSharedPtr<FLevelSelectorConfigWriter> ConfigWriter;
+	TSharedPtr<FLevelSelectorCameraFavoriteStore> CameraFavoriteStore;
+	FOnCameraFavoritesChanged CameraFavoritesChangedDelegate;
+
+	/** Levels whose legacy favorites could not be written this session. Config reloads skip them, the next editor start tries again. */
+	TSet<TSoftObjectPtr<UWorld>> FailedCameraFavoriteMigrations;
+
+	TSet<FName> FavoritePackages;
+	TMap<FName, FGameplayTagContainer> LevelTagsByPackage;
 };
\ No newline at end of file
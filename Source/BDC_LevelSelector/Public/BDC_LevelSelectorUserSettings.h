@@ -0,0 +1,128 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "BDC_LevelSelectorUserSettings.generated.h"
+
+class FLevelSelectorConfigWriter;
+
+/** Order of the levels in the dropdown, favorites stay on top in every mode. */
+UENUM()
+enum class ELevelSelectorSortMode : uint8
+{
+	Name,
+	/** Slowest median switch time first, levels without recorded switches last. */
+	OpenTime,
+	/** Most often and most recently opened levels first, see UBDC_LevelSelectorUserSettings::RecordLevelOpen. */
+	Frecency,
+	/** Largest map plus external actor packages first, levels not measured yet last. */
+	DiskSize,
+};
+
+/** Frecency of one level as an integer key, higher ranks first. */
+USTRUCT()
+struct FLevelFrecencyRecord
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(Config, VisibleAnywhere, Category = "Frecency")
+	FName PackageName;
+
+	UPROPERTY(Config, VisibleAnywhere, Category = "Frecency")
+	int32 Key = 0;
+};
+
+/** Level selector settings of the local user, stored in the per-project user config and never shared. */
+UCLASS(Config=EditorPerProjectUserSettings)
+class BDC_LEVELSELECTOR_API UBDC_LevelSelectorUserSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	UBDC_LevelSelectorUserSettings();
+
+	/** Loads levels in the background that are likely to be opened next, so switching to them is faster. */
+	UPROPERTY(Config, EditAnywhere, Category = "Prefetch")
+	bool bEnablePrefetch;
+
+	/** How long the mouse has to rest on a level in the dropdown before it is prefetched. */
+	UPROPERTY(Config, EditAnywhere, Category = "Prefetch", meta = (ClampMin = "0.0", Units = "s", EditCondition = "bEnablePrefetch"))
+	float PrefetchHoverDelaySeconds;
+
+	/** Number of the most frecently opened levels that are prefetched after every map change. */
+	UPROPERTY(Config, EditAnywhere, Category = "Prefetch", meta = (ClampMin = "0", ClampMax = "16", EditCondition = "bEnablePrefetch"))
+	int32 PredictedPrefetchCount;
+
+	/** Upper bound of the on-disk size of all packages kept loaded by prefetching. */
+	UPROPERTY(Config, EditAnywhere, Category = "Prefetch", meta = (ClampMin = "0", Units = "MB", EditCondition = "bEnablePrefetch"))
+	int32 PrefetchMemoryCapMB;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Dropdown")
+	ELevelSelectorSortMode SortMode;
+
+	/** Levels whose map and external actor packages exceed this size are highlighted in the dropdown. */
+	UPROPERTY(Config, EditAnywhere, Category = "Dropdown", meta = (ClampMin = "0", Units = "MB"))
+	int32 HeavyLevelThresholdMB;
+
+	/** Leaves levels above HeavyLevelThresholdMB out of the dropdown, so they are not opened by accident. */
+	UPROPERTY(Config, EditAnywhere, Category = "Dropdown")
+	bool bHideHeavyLevels;
+
+	/** Memory the decoded level thumbnails of the dropdown may use, 0 disables thumbnails. */
+	UPROPERTY(Config, EditAnywhere, Category = "Dropdown", meta = (ClampMin = "0", Units = "MB"))
+	int32 ThumbnailMemoryBudgetMB;
+
+	/** Shows the levels as a folder tree by package path instead of a flat list. */
+	UPROPERTY(Config, EditAnywhere, Category = "Dropdown")
+	bool bShowFolderTree;
+
+	/** The camera favorites menu only lists favorites this close to the viewport camera, nearest first. 0 lists all of them. */
+	UPROPERTY(Config, EditAnywhere, Category = "Camera Favorites", meta = (ClampMin = "0", Units = "cm"))
+	float CameraFavoriteMenuRadius;
+
+	/** Opening a World Partition level at a camera favorite loads only the editor cells this close to it. */
+	UPROPERTY(Config, EditAnywhere, Category = "Camera Favorites", meta = (ClampMin = "100", Units = "cm"))
+	float OpenAtFavoriteLoadRadius;
+
+	/** Open frecency of every level opened recently enough to still count, see RecordLevelOpen. */
+	UPROPERTY(Config, VisibleAnywhere, Category = "Frecency")
+	TArray<FLevelFrecencyRecord> LevelFrecency;
+
+	/**
+	 * Adds an open of a level to its exponentially decayed open count and returns the new sort key.
+	 * The key is the log of the decayed count scaled to a fixed point integer, measured against a fixed epoch
+	 * instead of now. All keys decay at the same rate, so their order never changes with time and only the
+	 * opened level needs a new key. Levels forgotten on the way are appended to OutForgottenPackages, their key is 0 now.
+	 * The record is written to config once no further open happened for a few seconds.
+	 */
+	int32 RecordLevelOpen(FName PackageName, TArray<FName>* OutForgottenPackages = nullptr);
+
+	/** Hashed frecency key lookup by long package name, 0 for levels not opened recently. */
+	int32 GetFrecencyKey(FName PackageName) const { return FrecencyKeysByPackage.FindRef(PackageName); }
+
+	/** Appends up to Count of the most frecently opened levels, highest frecency first. */
+	void GetPredictedLevels(int32 Count, FName ExcludedPackage, TArray<FName>& OutPackageNames) const;
+
+	/** Queues a write-behind save of the user settings, batched with other changes made within a few seconds. */
+	void RequestConfigSave();
+
+	/** Writes a queued save right away. */
+	void FlushConfigSave();
+
+	virtual void PostInitProperties() override;
+	virtual void PostReloadConfig(FProperty* PropertyThatWasLoaded) override;
+
+private:
+	void RebuildFrecencyLookup();
+
+	TMap<FName, int32> FrecencyKeysByPackage;
+	TSharedPtr<FLevelSelectorConfigWriter> ConfigWriter;
+};
@@ -0,0 +1,32 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "LevelSelectorBenchmarkCommandlet.generated.h"
+
+/**
+ * Times the level selector data paths against synthetic world assets and writes the results as JSON.
+ * Stages: Populate, Sort, IndexFilter:<Query>, IndexFilter:TagsAny/TagsAll, RefreshSelection and CacheSerialize.
+ * The widget side of filtering and row generation need a Slate application and are not covered.
+ *
+ * UnrealEditor-Cmd <Project> -run=LevelSelectorBenchmark -nullrhi [-Sizes=1000,10000,100000] [-Iterations=20]
+ *     [-FavoriteRatio=0.05] [-TagRatio=0.25] [-Output=<File.json>]
+ */
+UCLASS()
+class ULevelSelectorBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	ULevelSelectorBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
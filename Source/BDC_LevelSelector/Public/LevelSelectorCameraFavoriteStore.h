@@ -0,0 +1,85 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FLevelSelectorCameraSpatialIndex;
+struct FCameraFavorite;
+
+/**
+ * Camera favorites stored in one small text file per level under Config/LevelSelector/CameraFavorites/, mirroring the
+ * level's package path. A level's file is read the first time its favorites are asked for, usually when it opens,
+ * and only that file is rewritten when they change. Files of levels that no longer exist are removed by CollectGarbage.
+ * The files are meant to be shared through source control: read-only files are checked out before they are written,
+ * new files are marked for add and removed files for delete.
+ */
+class BDC_LEVELSELECTOR_API FLevelSelectorCameraFavoriteStore
+{
+public:
+	FLevelSelectorCameraFavoriteStore();
+	~FLevelSelectorCameraFavoriteStore();
+
+	/** Favorites of a level, read from its file on first use. Null if the level has none. */
+	const FCameraFavorite* Find(FName PackageName);
+
+	/** True if the level has a favorites file, without reading it. The folder is listed once on first use. */
+	bool HasFavorites(FName PackageName);
+
+	/**
+	 * Applies Mutation to the favorites of a level and writes its file if Mutation returns true. Returns true once the
+	 * file was written. If writing fails the favorites are rolled back to what the file still holds.
+	 */
+	bool Modify(FName PackageName, TFunctionRef<bool(FCameraFavorite&)> Mutation);
+
+	/** Adds or overwrites a favorite. Unlike Modify, these keep a built spatial index up to date instead of dropping it. */
+	bool AddFavorite(FName PackageName, FName FavoriteName, const FTransform& CameraTransform);
+	bool RenameFavorite(FName PackageName, FName OldName, FName NewName);
+	bool RemoveFavorite(FName PackageName, FName FavoriteName);
+
+	/** Favorites of a level by camera location, built on first use. Null if the level has none. */
+	const FLevelSelectorCameraSpatialIndex* FindSpatialIndex(FName PackageName);
+
+	/** Moves the favorites of a renamed level to its new package name. Returns false if there was nothing to move or the write failed. */
+	bool Move(FName OldPackageName, FName NewPackageName);
+
+	/**
+	 * Deletes the files of levels for which DoesLevelExist returns false. Files below content roots that are not
+	 * mounted right now are left alone, their plugin may just not be loaded. Returns the number of deleted files.
+	 */
+	int32 CollectGarbage(TFunctionRef<bool(FName)> DoesLevelExist);
+
+	static FString GetRootDir();
+	static FString GetFilename(FName PackageName);
+
+	/** Names have to fit an FName and a single line of the favorites file, so they are shorter than NAME_SIZE and have no line breaks. */
+	static bool IsValidFavoriteName(FStringView Name);
+
+private:
+	bool Load(FName PackageName, FCameraFavorite& OutFavorites) const;
+	bool Save(FName PackageName, const FCameraFavorite& Favorites);
+	bool ModifyInternal(FName PackageName, TFunctionRef<bool(FCameraFavorite&)> Mutation);
+	void ListFiles();
+
+	/** Makes a read-only file writable by checking it out. False if it stays read-only, it is never overwritten then. */
+	static bool CheckOutFile(const FString& Filename);
+	/** Marks the file for delete in source control and removes it. True if no file is left. */
+	static bool RemoveFile(const FString& Filename);
+
+	/** Package name of a favorites file below RootDir, or none for any other file. */
+	static FName GetPackageName(const FString& Filename, const FString& RootDir);
+
+	/** Levels whose file was read, including levels without one, so a missing file is only looked for once. */
+	TMap<FName, TUniquePtr<FCameraFavorite>> LoadedLevels;
+	TMap<FName, TUniquePtr<FLevelSelectorCameraSpatialIndex>> SpatialIndices;
+
+	/** Levels with a favorites file, from one listing of the folder kept up to date by Save and CollectGarbage. */
+	TSet<FName> LevelsWithFile;
+	bool bListedFiles = false;
+};
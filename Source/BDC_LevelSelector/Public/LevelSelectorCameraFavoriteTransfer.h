@@ -0,0 +1,68 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/SubclassOf.h"
+
+class AActor;
+class UWorld;
+struct FCameraFavorite;
+
+/** Which actors of a level become camera favorites. Every criterion that is set has to match. */
+struct FLevelSelectorActorQuery
+{
+	TSubclassOf<AActor> ActorClass;
+	FName ActorTag;
+	/** Short name of a data layer the actor has to be in. */
+	FName DataLayerName;
+	/** 0 takes the actor's own transform, as for cameras or target points. Otherwise the camera looks at the actor from this far behind and above it. */
+	double ViewDistance = 0.0;
+};
+
+/**
+ * Bulk creation of camera favorites, from actors of a level or from CSV and JSON files. Files are read and written
+ * through a fixed size buffer one favorite at a time, so large files never exist as one string in memory. The results
+ * are meant to be committed in a single write with UBDC_LevelSelectorSettings::AddCameraFavorites.
+ */
+class BDC_LEVELSELECTOR_API FLevelSelectorCameraFavoriteTransfer
+{
+public:
+	/**
+	 * Adds a favorite named after the label of each matching actor, duplicate labels get a numbered suffix. Returns the number added.
+	 * Only loaded actors are visited, in a World Partition level the regions to collect from have to be loaded first.
+	 */
+	static int32 CollectFromActors(UWorld* World, const FLevelSelectorActorQuery& Query, TMap<FName, FTransform>& OutFavorites);
+
+	/** Adds a favorite for each of the given actors. Returns the number added. */
+	static int32 CollectFromActors(TConstArrayView<AActor*> Actors, double ViewDistance, TMap<FName, FTransform>& OutFavorites);
+
+	/** Reads favorites from a .json file, or from a .csv file for any other extension. Returns false if the file could not be read. */
+	static bool Import(const FString& Filename, TMap<FName, FTransform>& OutFavorites);
+
+	/** Writes favorites sorted by name to a .json file, or to a .csv file for any other extension. */
+	static bool Export(const FString& Filename, const FCameraFavorite& Favorites);
+
+	static bool IsJsonFile(const FString& Filename);
+
+	/** Returns BaseName, or BaseName with the lowest numbered suffix from 2 up that Favorites does not use yet. */
+	static FName MakeUniqueName(const FString& BaseName, const TMap<FName, FTransform>& Favorites);
+
+	/** Finds an actor class by its name or path, native classes first. Returns null for unknown or non-actor classes. */
+	static UClass* FindActorClass(const FString& ClassName);
+
+private:
+	static bool MatchesQuery(const AActor& Actor, const FLevelSelectorActorQuery& Query);
+	static FTransform GetViewTransform(const AActor& Actor, double ViewDistance);
+
+	static bool ImportCsv(const FString& Filename, TMap<FName, FTransform>& OutFavorites);
+	static bool ImportJson(const FString& Filename, TMap<FName, FTransform>& OutFavorites);
+	static bool ParseCsvLine(const FString& Line, FName& OutName, FTransform& OutTransform);
+	static bool ParseJsonObject(const FString& ObjectText, FName& OutName, FTransform& OutTransform);
+};
@@ -0,0 +1,106 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Camera favorites of one level in a sparse uniform grid, for lookups by distance from the viewport camera.
+ * Inserting and removing touch one cell. Queries search the cells in rings around the origin and stop once no
+ * closer favorite can be left, so their cost depends on the favorites near the origin, not on how many there are.
+ * A query far away from all favorites reads each occupied cell at most once.
+ * Favorites are ordered by distance and then by name, which makes next and previous well defined for ties.
+ */
+class BDC_LEVELSELECTOR_API FLevelSelectorCameraSpatialIndex
+{
+public:
+	struct FHit
+	{
+		FName Name;
+		FVector Location = FVector::ZeroVector;
+		double Distance = 0.0;
+	};
+
+	explicit FLevelSelectorCameraSpatialIndex(double InCellSize = 5000.0);
+
+	/** Adds a favorite, or moves it if the name is already indexed. */
+	void Add(FName Name, const FVector& Location);
+	bool Remove(FName Name);
+	bool Rename(FName OldName, FName NewName);
+	void Reset();
+
+	int32 Num() const { return Entries.Num(); }
+
+	bool FindNearest(const FVector& Origin, FHit& OutHit) const;
+
+	/** The favorite right after (Distance, Name) in distance order from Origin. */
+	bool FindNext(const FVector& Origin, double Distance, FName Name, FHit& OutHit) const;
+
+	/** The favorite right before (Distance, Name) in distance order from Origin. */
+	bool FindPrevious(const FVector& Origin, double Distance, FName Name, FHit& OutHit) const;
+
+	/** Appends all favorites within Radius of Origin, nearest first. */
+	void FindInRadius(const FVector& Origin, double Radius, TArray<FHit>& OutHits) const;
+
+private:
+	struct FEntry
+	{
+		FName Name;
+		FVector Location;
+		FIntVector Cell;
+	};
+
+	static bool IsLess(double DistanceA, FName NameA, double DistanceB, FName NameB)
+	{
+		return DistanceA < DistanceB || (DistanceA == DistanceB && NameA.LexicalLess(NameB));
+	}
+
+	FIntVector GetCell(const FVector& Location) const;
+	void RemoveFromCell(int32 EntryIndex);
+
+	/** Ring beyond which no occupied cell is left, seen from Center. */
+	int32 GetMaxRing(const FIntVector& Center) const;
+
+	/** Last ring that can hold entries within Distance of a point in the Center cell. */
+	int32 GetLastRingWithin(const FIntVector& Center, double Distance) const;
+
+	using FCellEntries = TArray<int32, TInlineAllocator<4>>;
+
+	/**
+	 * Visits the entries of a query ring by ring, rings in increasing order. Near rings walk their cells. Once a ring has
+	 * more cells than the grid has occupied, the occupied cells from there on are bucketed by ring in a single pass,
+	 * so a query far from all favorites reads every cell once instead of once per ring.
+	 */
+	class FRingWalker
+	{
+	public:
+		FRingWalker(const FLevelSelectorCameraSpatialIndex& InIndex, const FIntVector& InCenter) : Index(InIndex), Center(InCenter) {}
+
+		/** Calls Visitor with every entry in the cells at Chebyshev distance Ring from Center. */
+		template <typename VisitorType>
+		void Visit(int32 Ring, VisitorType&& Visitor);
+
+	private:
+		const FLevelSelectorCameraSpatialIndex& Index;
+		FIntVector Center;
+		/** Occupied cells from the first bucketed ring on, sorted by ring. */
+		TArray<TPair<int32, const FCellEntries*>> BucketedCells;
+		int32 NextBucketedCell = 0;
+		bool bBucketed = false;
+	};
+
+	double CellSize;
+	TArray<FEntry> Entries;
+	TMap<FName, int32> EntryByName;
+	TMap<FIntVector, FCellEntries> Cells;
+
+	/** Bounds of all cells ever occupied, they only shrink on Reset. */
+	FIntVector MinCell = FIntVector::ZeroValue;
+	FIntVector MaxCell = FIntVector::ZeroValue;
+};
@@ -0,0 +1,59 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "UObject/WeakObjectPtr.h"
+
+/** Counters of the write-behind config persistence. */
+struct FLevelSelectorConfigWriterStats
+{
+	/** Save requests made by settings mutators. */
+	int32 RequestedSaves = 0;
+	/** Requests that were merged into an already pending write. */
+	int32 CoalescedSaves = 0;
+	/** Writes actually issued to the config file. */
+	int32 IssuedWrites = 0;
+};
+
+/**
+ * Write-behind persistence of a config object.
+ * Save requests are batched until no new request arrived for the quiet period, then the object is written
+ * on the game thread, DefaultConfig classes through TryUpdateDefaultConfigFile and others through SaveConfig.
+ */
+class BDC_LEVELSELECTOR_API FLevelSelectorConfigWriter
+{
+public:
+	explicit FLevelSelectorConfigWriter(UObject* InConfigObject);
+	~FLevelSelectorConfigWriter();
+
+	/** Marks the config dirty. The write happens once no further request arrived for QuietPeriodSeconds. */
+	void RequestSave(float QuietPeriodSeconds);
+
+	/** Writes a pending change right away. */
+	void Flush();
+
+	/** Drops a pending change without writing it, e.g. after the in-memory change was reverted. */
+	void Cancel();
+
+	bool HasPendingSave() const { return bDirty; }
+	const FLevelSelectorConfigWriterStats& GetStats() const { return Stats; }
+
+private:
+	bool OnQuietPeriodTick(float DeltaTime);
+
+	TWeakObjectPtr<UObject> ConfigObject;
+	FTSTicker::FDelegateHandle QuietPeriodTickerHandle;
+	FLevelSelectorConfigWriterStats Stats;
+
+	double LastRequestTime = 0.0;
+	float QuietPeriod = 0.0f;
+	bool bDirty = false;
+};
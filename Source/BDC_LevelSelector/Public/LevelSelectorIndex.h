@@ -0,0 +1,222 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "Containers/Ticker.h"
+#include "GameplayTagContainer.h"
+#include "LevelSelectorPathFilter.h"
+#include "LevelSelectorSearchIndex.h"
+#include "LevelSelectorTagIndex.h"
+#include "Tasks/Task.h"
+
+class UBDC_LevelSelectorSettings;
+
+struct FLevelSelectorItem
+{
+	FString DisplayName;
+	FString PackagePath;
+	FName PackageName;
+	FAssetData AssetData;
+
+	/** Favorite and tag state cached from the settings, see RefreshCachedState. */
+	bool bIsFavorite = false;
+	FGameplayTagContainer Tags;
+
+	/** Set if the level has camera favorites, so rows don't read its favorites file to find out. */
+	bool bHasCameraFavorites = false;
+
+	/** Open frecency cached from the user settings, higher ranks first. */
+	int32 FrecencyKey = 0;
+
+	/** Entry of this item in the index's search index. */
+	int32 SearchId = INDEX_NONE;
+
+	explicit FLevelSelectorItem(const FAssetData& InAssetData);
+
+	static TSharedRef<FLevelSelectorItem> Create(const FAssetData& InAssetData)
+	{
+		return MakeShareable(new FLevelSelectorItem(InAssetData));
+	}
+
+	bool IsFavorite() const { return bIsFavorite; }
+	void RefreshCachedState(const UBDC_LevelSelectorSettings* Settings);
+};
+
+/** Changes applied to the level index since the last broadcast. Removals are listed before updates and additions. */
+struct FLevelSelectorIndexDelta
+{
+	TArray<TSharedPtr<FLevelSelectorItem>> Removed;
+	TArray<TSharedPtr<FLevelSelectorItem>> Updated;
+	TArray<TSharedPtr<FLevelSelectorItem>> Added;
+
+	/** Set when the whole index was re-sorted, listeners should rebuild their views instead of applying the lists. */
+	bool bFullRefresh = false;
+
+	bool IsEmpty() const { return !bFullRefresh && Removed.IsEmpty() && Updated.IsEmpty() && Added.IsEmpty(); }
+	void Reset();
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnLevelIndexChanged, const FLevelSelectorIndexDelta&);
+
+/**
+ * Persistent index of all selectable levels, kept sorted (favorites first, then package path).
+ * Asset registry add/remove/rename events are applied as deltas and broadcast once per tick.
+ * While the registry is still scanning, the index is seeded from FLevelSelectorIndexCache and reconciled once it finished.
+ * Which levels are listed is decided by the content roots of the settings; mounting or unmounting a plugin only
+ * rescans or drops that plugin's root.
+ */
+class BDC_LEVELSELECTOR_API FLevelSelectorIndex
+{
+public:
+	FLevelSelectorIndex();
+	~FLevelSelectorIndex();
+
+	/** Subscribes to the asset registry and builds the initial index. */
+	void Initialize();
+	void Shutdown();
+
+	/** Full rescan of the asset registry. Only the differences to the current index are broadcast. */
+	void Rescan();
+
+	/**
+	 * Makes the given world assets the content of the index. Only the differences to the current index are broadcast.
+	 * With a RootPath, only the items below it are replaced and the rest of the index stays as it is.
+	 */
+	void Reconcile(TConstArrayView<FAssetData> AssetDataList, FStringView RootPath = FStringView());
+
+	/** Rescans the world assets below one mount point or folder, e.g. "/MyPlugin/". */
+	void RescanRoot(FStringView RootPath);
+
+	/** Re-sorts a single item around a change of its favorite or tag state. */
+	void UpdateItem(const TSharedPtr<FLevelSelectorItem>& Item, TFunctionRef<void()> Mutation);
+
+	/** Broadcasts the pending delta right away instead of waiting for the next tick. */
+	void FlushPendingChanges();
+
+	TSharedPtr<FLevelSelectorItem> FindItem(FName PackageName) const;
+
+	/** Appends all items whose display name or package path contains FoldedQuery, in no particular order. */
+	void FindMatches(FStringView FoldedQuery, TArray<TSharedPtr<FLevelSelectorItem>>& OutItems) const;
+
+	/** Appends the sorted items matching FoldedQuery and TagQuery. */
+	void GetFilteredItems(FStringView FoldedQuery, const FLevelSelectorTagIndex::FQuery& TagQuery, TArray<TSharedPtr<FLevelSelectorItem>>& OutItems) const;
+
+	/** Single item version of FindMatches. */
+	bool MatchesSearch(const FLevelSelectorItem& Item, FStringView FoldedQuery) const;
+
+	/** Compiles a tag filter for GetFilteredItems and MatchesTags. */
+	FLevelSelectorTagIndex::FQuery MakeTagQuery(const FGameplayTagContainer& FilterTags, ELevelSelectorTagMatch Match) { return TagIndex.MakeQuery(FilterTags, Match); }
+
+	/** True while the query was compiled against the current tag bits, otherwise it has to be compiled again. */
+	bool IsTagQueryCurrent(const FLevelSelectorTagIndex::FQuery& TagQuery) const { return TagIndex.IsCurrent(TagQuery); }
+
+	/** Single item version of the tag filter of GetFilteredItems. */
+	bool MatchesTags(const FLevelSelectorItem& Item, const FLevelSelectorTagIndex::FQuery& TagQuery) const { return TagIndex.Matches(Item.SearchId, TagQuery); }
+
+	const FLevelSelectorSearchIndex& GetSearchIndex() const { return SearchIndex; }
+	const TArray<TSharedPtr<FLevelSelectorItem>>& GetSortedItems() const { CompactSortedItems(); return SortedItems; }
+	FOnLevelIndexChanged& OnChanged() { return OnChangedDelegate; }
+
+	/** Sort order shared by the index and every filtered view of it. */
+	static bool CompareItems(const TSharedPtr<FLevelSelectorItem>& A, const TSharedPtr<FLevelSelectorItem>& B);
+
+	/** Merges the sorted Additions into the sorted Items in one linear pass, additions go behind equal items. */
+	template <typename PredicateType>
+	static void MergeSorted(TArray<TSharedPtr<FLevelSelectorItem>>& Items, TArray<TSharedPtr<FLevelSelectorItem>>& Additions, PredicateType Predicate);
+
+private:
+	void OnAssetAdded(const FAssetData& AssetData);
+	void OnAssetRemoved(const FAssetData& AssetData);
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+	void OnAssetRegistryFilesLoaded();
+	void OnSettingsChanged(UObject* Settings, FPropertyChangedEvent& PropertyChangedEvent);
+	void OnCameraFavoritesChanged(const FSoftObjectPath& LevelPath);
+	void OnContentPathMounted(const FString& AssetPath, const FString& ContentPath);
+	void OnContentPathDismounted(const FString& AssetPath, const FString& ContentPath);
+	void CompileContentRootFilter();
+	void RefreshAllItems();
+	void RefreshItem(const TSharedPtr<FLevelSelectorItem>& Item);
+
+	/** Seeds the empty index from the on-disk cache. Returns false if there was no usable cache. */
+	bool LoadFromCache();
+	/** Snapshots the index on the game thread and writes it on a background task. */
+	void SaveCache(bool bWait);
+
+	bool ShouldIndex(const FAssetData& AssetData) const;
+	TSharedPtr<FLevelSelectorItem> CreateItem(const FAssetData& AssetData);
+	void AddItem(const FAssetData& AssetData);
+	void RemoveItem(FName PackageName);
+	/** Queues an item for the sorted list, it is merged in by the next read. */
+	void InsertSorted(const TSharedPtr<FLevelSelectorItem>& Item);
+	/** Leaves a hole at the item's position, the next read closes all holes at once. */
+	void RemoveSorted(const TSharedPtr<FLevelSelectorItem>& Item);
+	/** Closes the holes of SortedItems, merges the queued inserts and records the new positions. */
+	void CompactSortedItems() const;
+	void RebuildSortedPositions() const;
+
+	void ScheduleFlush();
+	bool OnFlushTick(float DeltaTime);
+
+	TMap<FName, TSharedPtr<FLevelSelectorItem>> ItemsByPackage;
+	/**
+	 * Every add, remove and re-sort of a single item is O(1): removals null their slot found through SortedPositions,
+	 * inserts wait in PendingSortedInserts. The first read after a burst of changes compacts once in O(N + K log K),
+	 * instead of shifting the array once per change.
+	 */
+	mutable TArray<TSharedPtr<FLevelSelectorItem>> SortedItems;
+	mutable TArray<TSharedPtr<FLevelSelectorItem>> PendingSortedInserts;
+	mutable TMap<const FLevelSelectorItem*, int32> SortedPositions;
+	mutable int32 NumSortedHoles = 0;
+
+	FLevelSelectorSearchIndex SearchIndex;
+	TArray<TSharedPtr<FLevelSelectorItem>> ItemsBySearchId;
+
+	/** IncludedContentRoots and ExcludedContentRoots of the settings, compiled once per change. */
+	FLevelSelectorPathFilter ContentRootFilter;
+
+	/** Tag bits of every item, by search id. */
+	FLevelSelectorTagIndex TagIndex;
+
+	FLevelSelectorIndexDelta PendingDelta;
+	FOnLevelIndexChanged OnChangedDelegate;
+	FTSTicker::FDelegateHandle FlushTickerHandle;
+	UE::Tasks::FTask CacheWriteTask;
+
+	bool bInitialized = false;
+	bool bFilesLoaded = false;
+};
+
+template <typename PredicateType>
+void FLevelSelectorIndex::MergeSorted(TArray<TSharedPtr<FLevelSelectorItem>>& Items, TArray<TSharedPtr<FLevelSelectorItem>>& Additions, PredicateType Predicate)
+{
+	if (Additions.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<TSharedPtr<FLevelSelectorItem>> Merged;
+	Merged.Reserve(Items.Num() + Additions.Num());
+	int32 ItemIndex = 0;
+	for (TSharedPtr<FLevelSelectorItem>& Addition : Additions)
+	{
+		while (ItemIndex < Items.Num() && !Predicate(Addition, Items[ItemIndex]))
+		{
+			Merged.Add(MoveTemp(Items[ItemIndex++]));
+		}
+		Merged.Add(MoveTemp(Addition));
+	}
+	for (; ItemIndex < Items.Num(); ++ItemIndex)
+	{
+		Merged.Add(MoveTemp(Items[ItemIndex]));
+	}
+	Items = MoveTemp(Merged);
+	Additions.Reset();
+}
@@ -0,0 +1,44 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FLevelSelectorItem;
+
+/**
+ * On-disk snapshot of the level index under Saved/, so the list is complete before the asset registry finished its scan.
+ * The file is a header, a table of fixed size records in index order and a UTF-8 string blob the records point into.
+ * It is memory-mapped for reading and rejected as a whole when its magic, version or bounds don't match.
+ */
+class BDC_LEVELSELECTOR_API FLevelSelectorIndexCache
+{
+public:
+	struct FEntry
+	{
+		FName PackageName;
+		FName AssetName;
+		/** Tags of the level, comma separated. */
+		FString Tags;
+		bool bIsFavorite = false;
+	};
+
+	/** Reads the cache file into OutEntries, in the order the index had when it was written. */
+	static bool Load(TArray<FEntry>& OutEntries);
+
+	/** Encodes the given items into the cache file format. */
+	static TArray<uint8> Serialize(TConstArrayView<TSharedPtr<FLevelSelectorItem>> SortedItems);
+
+	/** Decodes the output of Serialize. Fails if magic, version or bounds don't match. */
+	static bool Parse(const uint8* Data, int64 Size, TArray<FEntry>& OutEntries);
+
+	static bool Save(const TArray<uint8>& Data);
+
+	static FString GetCacheFilename();
+};
@@ -0,0 +1,98 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Tasks/Task.h"
+#include "UObject/ObjectSaveContext.h"
+
+/** What a level costs on disk, gathered from file stats only. */
+struct FLevelPackageMetadata
+{
+	int64 MapFileSize = 0;
+	FDateTime LastModified;
+
+	/** World partition actor packages of the level, zero for levels without external actors. */
+	int32 ExternalActorCount = 0;
+	int64 ExternalActorBytes = 0;
+
+	int64 GetTotalSize() const { return MapFileSize + ExternalActorBytes; }
+};
+
+DECLARE_MULTICAST_DELEGATE(FOnLevelMetadataUpdated);
+
+/**
+ * Collects FLevelPackageMetadata on worker threads. Requests are batched per tick, a batch is stat'ed by one task
+ * and its results are applied on the game thread. Results are cached by package and the map file timestamp; a
+ * cached level is queued again as soon as its map or one of its actor packages was saved, and its external actor
+ * folder is only walked again if that stat found a newer map or an actor package was saved.
+ */
+class BDC_LEVELSELECTOR_API FLevelSelectorMetadataCache : public TSharedFromThis<FLevelSelectorMetadataCache>
+{
+public:
+	void Initialize();
+	void Shutdown();
+
+	/** Queues a level for collection unless its cached metadata is still valid. */
+	void Request(FName PackageName);
+
+	const FLevelPackageMetadata* Find(FName PackageName) const;
+
+	/** Bumped whenever results were applied, lets widgets keep derived texts until it changes. */
+	uint32 GetRevision() const { return Revision; }
+	FOnLevelMetadataUpdated& OnUpdated() { return UpdatedDelegate; }
+
+private:
+	struct FBatchEntry
+	{
+		FName PackageName;
+		FString MapFilename;
+		FString ExternalActorsDirectory;
+
+		/** Timestamp of the cached result, the external actor walk is skipped if it still matches. */
+		FDateTime CachedMapTimestamp;
+		bool bExternalActorsChanged = true;
+
+		FLevelPackageMetadata Metadata;
+		bool bUnchanged = false;
+		bool bFound = false;
+	};
+
+	struct FCacheEntry
+	{
+		FLevelPackageMetadata Metadata;
+		bool bValidated = false;
+		bool bExternalActorsChanged = false;
+	};
+
+	bool OnTick(float DeltaTime);
+	void DispatchBatch();
+	void ApplyBatch(TArray<FBatchEntry>& Batch);
+	static void CollectBatch(TArray<FBatchEntry>& Batch);
+	void OnPackageSaved(const FString& PackageFilename, UPackage* Package, FObjectPostSaveContext ObjectSaveContext);
+	/** Marks a cached or queued level as outdated and queues it again. */
+	void Invalidate(FName PackageName, bool bExternalActorsChanged);
+	/** Adds the ticker while there are requests or batches, it removes itself once both are done. */
+	void EnsureTicker();
+
+	TMap<FName, FCacheEntry> Cache;
+	/** Cached levels by the long package path of their actor packages, e.g. "/Game/__ExternalActors__/Maps/MyMap". */
+	TMap<FName, FName> LevelsByExternalActorsPath;
+	TArray<FName> PendingRequests;
+	TSet<FName> QueuedPackages;
+	/** Queued levels saved after their batch was dispatched. The batch's result predates the save, they are queued again. */
+	TSet<FName> ChangedWhileQueued;
+	TArray<UE::Tasks::TTask<TArray<FBatchEntry>>> BatchTasks;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	FOnLevelMetadataUpdated UpdatedDelegate;
+	uint32 Revision = 0;
+	bool bInitialized = false;
+};
@@ -0,0 +1,64 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Include and exclude rules for package paths, compiled into a trie with one node per path segment.
+ * Matching a package walks its segments once, the deepest rule on the way decides, so "/Game/" with an
+ * exclude of "/Game/Developers/" lists everything in /Game/ except the developer folders.
+ * Paths compare case-insensitively like package names do.
+ */
+class BDC_LEVELSELECTOR_API FLevelSelectorPathFilter
+{
+public:
+	FLevelSelectorPathFilter();
+
+	/**
+	 * Replaces all rules. Patterns are mount points or folders such as "/Game/", "/MyPlugin/" or "/Game/Maps/Test";
+	 * a missing leading slash is added, "/" matches every mount point. Excludes win over includes of the same path.
+	 */
+	void Compile(TConstArrayView<FString> IncludePatterns, TConstArrayView<FString> ExcludePatterns);
+
+	/** True if the deepest rule covering the package is an include. */
+	bool Matches(FStringView PackageName) const;
+
+	/** True if any package below RootPath can match, i.e. an include covers the root or lies below it. */
+	bool CouldMatchBelow(FStringView RootPath) const;
+
+	int32 GetNumNodes() const { return Nodes.Num(); }
+
+private:
+	enum class ERule : uint8
+	{
+		None,
+		Include,
+		Exclude,
+	};
+
+	struct FNode
+	{
+		FString Segment;
+		TArray<int32, TInlineAllocator<4>> Children;
+		ERule Rule = ERule::None;
+		/** Set if this node or a node below it is an include. */
+		bool bHasIncludeBelow = false;
+	};
+
+	void AddRule(FStringView Pattern, ERule Rule);
+	int32 FindChild(int32 NodeIndex, FStringView Segment) const;
+
+	/** Calls Visitor with the root and the node of each segment of Path, as long as the trie has one. False if it ran out of nodes. */
+	template <typename VisitorType>
+	bool Walk(FStringView Path, VisitorType&& Visitor) const;
+
+	/** Node 0 is the root and stands for "/". */
+	TArray<FNode> Nodes;
+};
@@ -0,0 +1,101 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FLevelSelectorItem;
+
+/** A folder of the path trie, or a level inside one. Levels are leaves and never have children. */
+struct FLevelSelectorTreeNode : public TSharedFromThis<FLevelSelectorTreeNode>
+{
+	/** Folder name, empty for level nodes which show the display name of their level. */
+	FString Name;
+	FString FoldedName;
+	/** Long package path of the folder, e.g. /Game/Maps/Desert. */
+	FString Path;
+
+	TSharedPtr<FLevelSelectorItem> Level;
+	FLevelSelectorTreeNode* Parent = nullptr;
+
+	/** Sub folders by folded name, and the levels directly inside this folder in index order. */
+	TArray<TSharedPtr<FLevelSelectorTreeNode>> Folders;
+	TArray<TSharedPtr<FLevelSelectorTreeNode>> Levels;
+
+	/** Levels in this folder and all folders below it. */
+	int32 NumLevels = 0;
+
+	bool IsFolder() const { return !Level.IsValid(); }
+};
+
+/** What the tree shows while a search or tag filter is active, see FLevelSelectorPathTrie::Filter. */
+struct FLevelSelectorTreeFilter
+{
+	bool bActive = false;
+
+	/** Folders whose name matched the search, shown with everything below them. */
+	TSet<FLevelSelectorTreeNode*> MatchedFolders;
+	/** Folders leading to a match, expanded so the match is in view. */
+	TSet<FLevelSelectorTreeNode*> VisibleFolders;
+	TSet<const FLevelSelectorItem*> VisibleLevels;
+
+	void Reset();
+
+	/** True if the node or one of its parent folders matched the search as a whole. */
+	bool IsInMatchedFolder(const FLevelSelectorTreeNode& Node) const;
+
+	/** Appends the children of a folder that pass the filter, sub folders first. */
+	void GetVisibleChildren(const FLevelSelectorTreeNode& Folder, TArray<TSharedPtr<FLevelSelectorTreeNode>>& OutChildren) const;
+};
+
+/**
+ * Folder hierarchy of all indexed levels, one node per package path segment. Every folder counts the levels
+ * below it, so the tree can show counts without walking collapsed subtrees. It is kept in sync with the level
+ * index through its deltas, adding or removing a level only touches the folders on its path.
+ */
+class BDC_LEVELSELECTOR_API FLevelSelectorPathTrie
+{
+public:
+	FLevelSelectorPathTrie();
+
+	/** Replaces the content of the trie with the given items, expected in index order. */
+	void Build(TConstArrayView<TSharedPtr<FLevelSelectorItem>> SortedItems);
+
+	void Add(const TSharedPtr<FLevelSelectorItem>& Item);
+	void Remove(const TSharedPtr<FLevelSelectorItem>& Item);
+
+	/** Moves a level to its new place among its siblings, after its favorite state changed. */
+	void Update(const TSharedPtr<FLevelSelectorItem>& Item);
+
+	/** Top level folders, one per mount point with levels. */
+	const TArray<TSharedPtr<FLevelSelectorTreeNode>>& GetRootFolders() const { return Root->Folders; }
+
+	TSharedPtr<FLevelSelectorTreeNode> FindLevelNode(const FLevelSelectorItem& Item) const;
+
+	/**
+	 * Collects what the tree shows for a search. A folder whose name contains FoldedQuery is taken as a whole, without
+	 * visiting anything below it; queries with a slash are matched against the whole folder path instead. MatchingLevels
+	 * are the levels that matched on their own. If LevelFilter is set, the levels below matched folders have to pass it
+	 * and are collected one by one.
+	 */
+	void Filter(FStringView FoldedQuery, TConstArrayView<TSharedPtr<FLevelSelectorItem>> MatchingLevels,
+		const TFunction<bool(const FLevelSelectorItem&)>& LevelFilter, FLevelSelectorTreeFilter& OutFilter) const;
+
+	int32 GetNumFolders() const { return FoldersByPath.Num(); }
+
+private:
+	FLevelSelectorTreeNode* FindOrAddFolder(const FString& FolderPath);
+	FLevelSelectorTreeNode* FindFolder(const FLevelSelectorItem& Item) const;
+	void InsertLevelNode(FLevelSelectorTreeNode& Folder, const TSharedPtr<FLevelSelectorTreeNode>& LevelNode);
+
+	static FString GetFolderPath(const FLevelSelectorItem& Item);
+
+	TSharedPtr<FLevelSelectorTreeNode> Root;
+	TMap<FString, FLevelSelectorTreeNode*> FoldersByPath;
+};
@@ -0,0 +1,129 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/AsyncFileHandle.h"
+#include "Containers/Ticker.h"
+#include "UObject/GCObject.h"
+#include "UObject/UObjectGlobals.h"
+
+enum class ELevelPrefetchReason : uint8
+{
+	Hover,
+	Predicted,
+};
+
+/** Counters of the level prefetcher. A hit is a level opened after its prefetch completed. */
+struct FLevelSelectorPrefetchStats
+{
+	int32 Requested = 0;
+	int32 Completed = 0;
+	int32 Cancelled = 0;
+	/** Completed prefetches dropped to stay within the memory cap. */
+	int32 Evicted = 0;
+	int32 Hits = 0;
+	/** Levels opened while their prefetch was still running. */
+	int32 PartialHits = 0;
+	int32 Misses = 0;
+
+	double GetHitRate() const
+	{
+		const int32 Opened = Hits + PartialHits + Misses;
+		return Opened > 0 ? static_cast<double>(Hits) / Opened : 0.0;
+	}
+};
+
+/**
+ * Warms level packages before they are opened. The map file is read once so it comes from the OS file cache,
+ * its hard dependencies are loaded with async package loading and kept referenced until the level is opened,
+ * cancelled, or evicted to stay within the memory cap of UBDC_LevelSelectorUserSettings.
+ */
+class BDC_LEVELSELECTOR_API FLevelSelectorPrefetcher : public FGCObject, public TSharedFromThis<FLevelSelectorPrefetcher>
+{
+public:
+	virtual ~FLevelSelectorPrefetcher() override;
+
+	void Initialize();
+	void Shutdown();
+
+	/** Starts warming a level. Does nothing if the level is loaded or already being prefetched. */
+	void Prefetch(FName PackageName, ELevelPrefetchReason Reason);
+
+	void Cancel(FName PackageName);
+	void CancelAll();
+
+	/** Prefetches the level once the hover lasted PrefetchHoverDelaySeconds. */
+	void BeginHover(FName PackageName);
+
+	/** Drops a hover that did not reach the delay yet. */
+	void EndHover();
+
+	bool IsPrefetched(FName PackageName) const;
+	const FLevelSelectorPrefetchStats& GetStats() const { return Stats; }
+
+	//~ Begin FGCObject Interface
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override;
+	//~ End FGCObject Interface
+
+private:
+	struct FPrefetch
+	{
+		ELevelPrefetchReason Reason = ELevelPrefetchReason::Predicted;
+		/** Tells load callbacks of a cancelled prefetch apart from a newer prefetch of the same level. */
+		uint32 Serial = 0;
+		double StartTime = 0.0;
+
+		/** Hard dependencies not requested yet. */
+		TArray<FName> QueuedDependencies;
+		int32 LoadsInFlight = 0;
+		int64 Bytes = 0;
+
+		/** Assets of the loaded dependencies, referenced so they stay resident until the level is opened. */
+		TArray<TObjectPtr<UObject>> LoadedAssets;
+
+		TUniquePtr<IAsyncReadFileHandle> MapFileHandle;
+		TUniquePtr<IAsyncReadRequest> MapFileRead;
+
+		bool bCompleted = false;
+	};
+
+	/** Map file read of a released prefetch, kept alive until the cancelled request finishes. */
+	struct FCancelledRead
+	{
+		TUniquePtr<IAsyncReadFileHandle> MapFileHandle;
+		TUniquePtr<IAsyncReadRequest> MapFileRead;
+	};
+
+	bool OnTick(float DeltaTime);
+	void OnMapOpened(const FString& Filename, bool bAsTemplate);
+	void PrefetchPredictedLevels(FName CurrentPackage);
+	void DispatchLoads();
+	void OnDependencyLoaded(const FName& DependencyName, UPackage* Package, EAsyncLoadingResult::Type Result, FName LevelPackage, uint32 Serial);
+	void UpdateCompletion(FName LevelPackage, FPrefetch& Entry);
+	void Release(FName PackageName);
+	void ReapCancelledReads(bool bWait);
+	bool MakeRoom(int64 Bytes, FName Requester);
+	int64 GetMemoryCapBytes() const;
+
+	TMap<FName, FPrefetch> Prefetches;
+	TArray<FCancelledRead> CancelledReads;
+	int64 TotalBytes = 0;
+	int32 LoadsInFlight = 0;
+	uint32 NextSerial = 1;
+
+	FName HoverCandidate;
+	double HoverStartTime = 0.0;
+	FName ActiveHoverPrefetch;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	FLevelSelectorPrefetchStats Stats;
+	bool bInitialized = false;
+};
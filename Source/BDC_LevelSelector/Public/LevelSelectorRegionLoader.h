@@ -0,0 +1,30 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UWorld;
+
+/** Loads parts of a World Partition level in the editor, the same way "Load Region" of the World Partition editor does. */
+class BDC_LEVELSELECTOR_API FLevelSelectorRegionLoader
+{
+public:
+	/**
+	 * Loads the editor cells within Radius of Center through a user created loader adapter, which shows up as a loaded
+	 * region in the World Partition editor and can be unloaded from there. Returns false if the world is not partitioned.
+	 */
+	static bool LoadAround(UWorld* World, const FVector& Center, double Radius);
+
+	/**
+	 * Unloads every region loaded through an editor loader adapter, including the ones World Partition restored from the
+	 * last session when the level was opened. Actors loaded by location volumes stay. Returns the number of regions unloaded.
+	 */
+	static int32 UnloadRegions(UWorld* World);
+};
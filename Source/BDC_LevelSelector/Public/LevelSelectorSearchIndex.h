@@ -0,0 +1,74 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/SparseArray.h"
+
+/**
+ * Case-insensitive substring index over short texts (level names, package paths, bookmark names).
+ * Every entry keeps its text pre-folded to lowercase and is listed in the posting list of each of its grams of one
+ * to three characters. Queries of up to three characters are answered by their posting list alone, longer ones
+ * only verify the entries of their rarest trigram instead of scanning the whole set.
+ */
+class BDC_LEVELSELECTOR_API FLevelSelectorSearchIndex
+{
+public:
+	/** Adds an entry searchable by all given texts. Returns its id, ids of removed entries are reused. */
+	int32 Add(TConstArrayView<FStringView> Texts);
+	void Remove(int32 Id);
+	void Reset();
+
+	/** Appends the ids of all entries containing FoldedQuery. The order of the ids is unspecified. */
+	void Find(FStringView FoldedQuery, TArray<int32>& OutIds) const;
+
+	/** True if the entry contains FoldedQuery. Does not allocate. */
+	bool Matches(int32 Id, FStringView FoldedQuery) const;
+
+	int32 Num() const { return Entries.Num(); }
+
+	/** Upper bound of all ids handed out so far, for sizing per-id bit arrays. */
+	int32 GetMaxId() const { return Entries.GetMaxIndex(); }
+
+	/** Lowercases a query the same way the indexed texts were folded. */
+	static FString Fold(FStringView Text);
+
+private:
+	/** Longest gram with a posting list, queries up to this length need no verification. */
+	static constexpr int32 MaxGramLength = 3;
+
+	/**
+	 * Ids of the entries containing one gram. Kept as a sorted array while sparse and as one bit per id once that
+	 * is smaller, so adding and removing an entry never scans the list, however many entries share the gram.
+	 */
+	struct FPosting
+	{
+		TArray<int32> SortedIds;
+		TBitArray<> Bits;
+		int32 Num = 0;
+		bool bDense = false;
+	};
+
+	void AddToPosting(FPosting& Posting, int32 Id) const;
+	static void RemoveFromPosting(FPosting& Posting, int32 Id);
+	static void AppendIds(const FPosting& Posting, TArray<int32>& OutIds);
+
+	static void CollectGrams(FStringView FoldedText, TArray<uint64>& OutGrams);
+	/** Packs a gram of one to MaxGramLength characters into a key. Characters are never 0, so shorter grams can't collide. */
+	static uint64 MakeGram(FStringView Gram);
+
+	struct FEntry
+	{
+		/** All texts of the entry, folded and separated by a newline so no match can span two texts. */
+		FString FoldedText;
+	};
+
+	TSparseArray<FEntry> Entries;
+	TMap<uint64, FPosting> Postings;
+};
@@ -0,0 +1,62 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+
+/** Trace channel of all level selector CPU scopes, enable with -trace=cpu,LevelSelector. */
+UE_TRACE_CHANNEL_EXTERN(LevelSelectorChannel, BDC_LEVELSELECTOR_API);
+
+DECLARE_STATS_GROUP(TEXT("LevelSelector"), STATGROUP_LevelSelector, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Populate Level List"), STAT_LevelSelector_PopulateLevelList, STATGROUP_LevelSelector, BDC_LEVELSELECTOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Sort Level List"), STAT_LevelSelector_SortLevelList, STATGROUP_LevelSelector, BDC_LEVELSELECTOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Apply Filters"), STAT_LevelSelector_ApplyFilters, STATGROUP_LevelSelector, BDC_LEVELSELECTOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Generate Level Row"), STAT_LevelSelector_GenerateRow, STATGROUP_LevelSelector, BDC_LEVELSELECTOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Refresh Selection"), STAT_LevelSelector_RefreshSelection, STATGROUP_LevelSelector, BDC_LEVELSELECTOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Asset Registry Files Loaded"), STAT_LevelSelector_FilesLoaded, STATGROUP_LevelSelector, BDC_LEVELSELECTOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Settings Write"), STAT_LevelSelector_SettingsWrite, STATGROUP_LevelSelector, BDC_LEVELSELECTOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Camera Overlay Refresh"), STAT_LevelSelector_OverlayRefresh, STATGROUP_LevelSelector, BDC_LEVELSELECTOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Collect Level Metadata"), STAT_LevelSelector_CollectMetadata, STATGROUP_LevelSelector, BDC_LEVELSELECTOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Filter Level Index"), STAT_LevelSelector_FilterIndex, STATGROUP_LevelSelector, BDC_LEVELSELECTOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Filter Folder Tree"), STAT_LevelSelector_FilterTree, STATGROUP_LevelSelector, BDC_LEVELSELECTOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Camera Overlay Paint"), STAT_LevelSelector_OverlayPaint, STATGROUP_LevelSelector, BDC_LEVELSELECTOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Camera Overlay Menu"), STAT_LevelSelector_OverlayMenu, STATGROUP_LevelSelector, BDC_LEVELSELECTOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Construct Toolbar Widget"), STAT_LevelSelector_ToolbarConstruct, STATGROUP_LevelSelector, BDC_LEVELSELECTOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Load Favorite Region"), STAT_LevelSelector_RegionLoad, STATGROUP_LevelSelector, BDC_LEVELSELECTOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Unload Regions"), STAT_LevelSelector_RegionUnload, STATGROUP_LevelSelector, BDC_LEVELSELECTOR_API);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Items Indexed"), STAT_LevelSelector_ItemsIndexed, STATGROUP_LevelSelector, BDC_LEVELSELECTOR_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Rows Generated"), STAT_LevelSelector_RowsGenerated, STATGROUP_LevelSelector, BDC_LEVELSELECTOR_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Filter Passes"), STAT_LevelSelector_FilterPasses, STATGROUP_LevelSelector, BDC_LEVELSELECTOR_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Camera Overlay Refreshes"), STAT_LevelSelector_OverlayRefreshes, STATGROUP_LevelSelector, BDC_LEVELSELECTOR_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Config Writes"), STAT_LevelSelector_ConfigWrites, STATGROUP_LevelSelector, BDC_LEVELSELECTOR_API);
+
+/** Cycle stat for `stat LevelSelector` plus a CPU scope of the same name on the level selector trace channel. */
+#define LEVELSELECTOR_SCOPE_CYCLE_COUNTER(Stat) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Stat, LevelSelectorChannel)
+
+/** Rolling window of the filter latency per search box keystroke. */
+class BDC_LEVELSELECTOR_API FLevelSelectorFilterLatency
+{
+public:
+	static void Record(double Milliseconds);
+
+	/** Logs count, p50, p90 and max of the current window. */
+	static void Dump();
+
+private:
+	static constexpr int32 WindowSize = 256;
+	static TArray<double> Samples;
+	static int32 NextSample;
+};
@@ -0,0 +1,35 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Styling/SlateStyle.h"
+
+/**
+ * Slate style set of the level selector, brushes are image files from the plugin Resources folder.
+ * Slate decodes them on first draw, so building a widget never waits on texture loading or streaming.
+ */
+class BDC_LEVELSELECTOR_API FLevelSelectorStyle
+{
+public:
+	static void Initialize();
+	static void Shutdown();
+
+	/** The registered style set. Only valid between Initialize and Shutdown. */
+	static const ISlateStyle& Get();
+	static FName GetStyleSetName();
+
+	/** Looks up a brush of the style set, falls back to the app style while the set is not registered. */
+	static const FSlateBrush* GetBrush(FName PropertyName);
+
+private:
+	static TSharedRef<FSlateStyleSet> Create();
+
+	static TSharedPtr<FSlateStyleSet> StyleInstance;
+};
@@ -0,0 +1,123 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Engine/World.h"
+
+/** Durations of one level switch, in milliseconds. */
+struct FLevelSwitchSample
+{
+	/** UTC ticks of the moment the switch was started. */
+	int64 Timestamp = 0;
+	/** Start of the switch until the previous level is torn down, mostly the save dirty packages prompt. */
+	float SavePromptMs = 0.0f;
+	/** Cleanup of the previous world. */
+	float UnloadMs = 0.0f;
+	/** Garbage collection and loading of the new map package until its world is initialized. */
+	float LoadMs = 0.0f;
+	/** World initialization, streaming setup and everything else until the map is reported as opened. */
+	float PostLoadMs = 0.0f;
+
+	float GetTotalMs() const { return SavePromptMs + UnloadMs + LoadMs + PostLoadMs; }
+
+	friend FArchive& operator<<(FArchive& Ar, FLevelSwitchSample& Sample)
+	{
+		return Ar << Sample.Timestamp << Sample.SavePromptMs << Sample.UnloadMs << Sample.LoadMs << Sample.PostLoadMs;
+	}
+};
+
+/** The last switches to one level, oldest sample overwritten first. */
+struct FLevelSwitchHistory
+{
+	static constexpr int32 Capacity = 16;
+
+	TArray<FLevelSwitchSample> Samples;
+	/** Slot the next sample overwrites once Samples is full. */
+	int32 Head = 0;
+
+	/** Percentiles of the total switch time, updated with every added sample. */
+	float MedianMs = 0.0f;
+	float P95Ms = 0.0f;
+
+	void Add(const FLevelSwitchSample& Sample);
+	void UpdatePercentiles();
+
+	/** Samples ordered oldest first. */
+	void GetOrderedSamples(TArray<FLevelSwitchSample>& OutSamples) const;
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnLevelSwitchRecorded, FName /*PackageName*/);
+
+/**
+ * Times level switches started from the level selector and keeps a short history per level under Saved/.
+ * A switch is split into phases by the world cleanup and initialization delegates the editor fires while
+ * FEditorFileUtils::LoadMap runs, so BeginSwitch and EndSwitch have to bracket that call.
+ */
+class BDC_LEVELSELECTOR_API FLevelSelectorSwitchTelemetry : public TSharedFromThis<FLevelSelectorSwitchTelemetry>
+{
+public:
+	void Initialize();
+	void Shutdown();
+
+	void BeginSwitch(FName PackageName);
+	/** Records the switch if the map was opened, otherwise the switch was cancelled and is dropped. */
+	void EndSwitch();
+
+	const FLevelSwitchHistory* FindHistory(FName PackageName) const { return Histories.Find(PackageName); }
+
+	/** Median total switch time of a level, or a negative value if it was never switched to. */
+	float GetMedianMs(FName PackageName) const;
+
+	/** Bumped whenever a sample was recorded, lets widgets keep derived texts until it changes. */
+	uint32 GetRevision() const { return Revision; }
+	FOnLevelSwitchRecorded& OnSwitchRecorded() { return SwitchRecordedDelegate; }
+
+	/** Writes recorded samples to the history file right away instead of after the save delay. */
+	void FlushSave();
+
+	/** Writes all samples as CSV, or as JSON with per-level percentiles if the filename ends with .json. */
+	bool Export(const FString& Filename) const;
+
+	static FString GetHistoryFilename();
+
+private:
+	void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+	void OnPostWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+	void OnPreWorldInitialization(UWorld* World, const UWorld::InitializationValues IVS);
+	void OnMapOpened(const FString& Filename, bool bAsTemplate);
+
+	bool Load();
+	void Save();
+	void RequestSave();
+	bool OnSaveTick(float DeltaTime);
+	FString ExportCsv() const;
+	FString ExportJson() const;
+
+	/** Timestamps of the switch in progress, zero until the phase boundary was seen. */
+	struct FPendingSwitch
+	{
+		FName PackageName;
+		FDateTime StartTime;
+		double Start = 0.0;
+		double WorldCleanup = 0.0;
+		double PostWorldCleanup = 0.0;
+		double PreWorldInitialization = 0.0;
+		double MapOpened = 0.0;
+	};
+
+	TOptional<FPendingSwitch> PendingSwitch;
+	TMap<FName, FLevelSwitchHistory> Histories;
+	uint32 Revision = 0;
+	FOnLevelSwitchRecorded SwitchRecordedDelegate;
+	FTSTicker::FDelegateHandle SaveTickerHandle;
+	bool bSavePending = false;
+	bool bInitialized = false;
+};
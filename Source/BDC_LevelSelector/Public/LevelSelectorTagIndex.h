@@ -0,0 +1,69 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+/** How a filter with several tags combines them. */
+enum class ELevelSelectorTagMatch : uint8
+{
+	/** A level needs at least one of the filter tags. */
+	Any,
+	/** A level needs every filter tag. */
+	All,
+};
+
+/**
+ * Tag filter over packed bitsets. Every tag in use gets a bit, and so do all of its parents; an entry stores the
+ * union of the bits of its tags and their parents. That makes hierarchical matching ("Env" matches "Env.Desert.Day")
+ * and AND/OR filters a few word operations per entry, without touching the tag containers while filtering.
+ * Bits are only handed out, never reassigned, until Reset.
+ */
+class BDC_LEVELSELECTOR_API FLevelSelectorTagIndex
+{
+public:
+	/** Filter compiled against the bit assignment of one index, see MakeQuery. */
+	struct FQuery
+	{
+		TArray<uint64> Mask;
+		ELevelSelectorTagMatch Match = ELevelSelectorTagMatch::Any;
+		uint32 Generation = 0;
+
+		/** True if the query has no tags and lets every entry pass. */
+		bool IsEmpty() const { return Mask.IsEmpty(); }
+	};
+
+	/** Replaces the tags of an entry. Ids are expected to be dense, like the ids of FLevelSelectorSearchIndex. */
+	void SetTags(int32 Id, const FGameplayTagContainer& Tags);
+	void Remove(int32 Id);
+	void Reset();
+
+	/** Compiles a filter. Tags no entry carries yet get a bit too, so the query stays valid while entries change. */
+	FQuery MakeQuery(const FGameplayTagContainer& FilterTags, ELevelSelectorTagMatch Match);
+
+	/** False once Reset reassigned the bits the query was compiled against. */
+	bool IsCurrent(const FQuery& Query) const { return Query.Generation == Generation; }
+
+	bool Matches(int32 Id, const FQuery& Query) const;
+
+	int32 GetNumBits() const { return BitsByTag.Num(); }
+
+private:
+	int32 FindOrAddBit(const FGameplayTag& Tag);
+	void SetWordsPerId(int32 NewWordsPerId);
+
+	TMap<FGameplayTag, int32> BitsByTag;
+
+	/** Bitsets of all entries back to back, WordsPerId words per id. */
+	TArray<uint64> Words;
+	int32 WordsPerId = 0;
+	int32 NumIds = 0;
+	uint32 Generation = 1;
+};
@@ -0,0 +1,60 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Reads a UTF-8 text file line by line through a fixed size buffer, so only the current line is ever held as a
+ * string. A byte order mark at the start is skipped, line terminators are stripped.
+ */
+class BDC_LEVELSELECTOR_API FLevelSelectorLineReader
+{
+public:
+	explicit FLevelSelectorLineReader(const FString& Filename);
+	~FLevelSelectorLineReader();
+
+	bool IsOpen() const { return Archive.IsValid(); }
+
+	/** Reads the next line. Returns false once the end of the file was reached. */
+	bool ReadLine(FString& OutLine);
+
+private:
+	bool FillBuffer();
+
+	TUniquePtr<FArchive> Archive;
+	TArray<uint8> Buffer;
+	TArray<uint8> LineBytes;
+	int32 BufferPos = 0;
+	int32 BufferEnd = 0;
+	bool bAtStart = true;
+};
+
+/** Writes a UTF-8 text file through a fixed size buffer, the counterpart of FLevelSelectorLineReader. */
+class BDC_LEVELSELECTOR_API FLevelSelectorLineWriter
+{
+public:
+	explicit FLevelSelectorLineWriter(const FString& Filename);
+	~FLevelSelectorLineWriter();
+
+	bool IsOpen() const { return Archive.IsValid(); }
+
+	void Write(FStringView Text);
+	void WriteLine(FStringView Line);
+
+	/** Writes what is left in the buffer and closes the file. Returns false if any write failed. */
+	bool Close();
+
+private:
+	void FlushBuffer();
+
+	TUniquePtr<FArchive> Archive;
+	TArray<uint8> Buffer;
+	bool bError = false;
+};
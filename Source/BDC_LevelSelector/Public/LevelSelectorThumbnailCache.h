@@ -0,0 +1,102 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/LruCache.h"
+#include "Containers/Ticker.h"
+#include "Tasks/Task.h"
+#include "UObject/ObjectSaveContext.h"
+
+struct FSlateBrush;
+class FSlateDynamicImageBrush;
+
+/**
+ * Level thumbnails for the dropdown rows. A thumbnail is the capture taken when a camera favorite was added, or
+ * the thumbnail embedded in the map package, read from the package file without loading it. Both are scaled down,
+ * written as PNG under Saved/LevelSelector/Thumbnails and decoded on worker threads; the decoded brushes are kept
+ * in an LRU cache that never holds more than the memory budget.
+ */
+class BDC_LEVELSELECTOR_API FLevelSelectorThumbnailCache : public TSharedFromThis<FLevelSelectorThumbnailCache>
+{
+public:
+	/** Longest edge of a stored thumbnail in pixels. */
+	static constexpr int32 ThumbnailSize = 128;
+
+	void Initialize();
+	void Shutdown();
+
+	/**
+	 * Returns the thumbnail of a level, or nullptr while it is being decoded or if the level has none.
+	 * A miss queues the level, so only rows that are painted ever request thumbnails.
+	 */
+	const FSlateBrush* GetThumbnail(FName PackageName);
+
+	/** Stores a viewport capture as the thumbnail of a level. Pixels are BGRA of the given size. */
+	void StoreCapture(FName PackageName, TArray<FColor>&& Pixels, FIntPoint Size);
+
+	/** Bumped whenever a thumbnail was decoded. */
+	uint32 GetRevision() const { return Revision; }
+
+private:
+	struct FRequest
+	{
+		FName PackageName;
+		FString MapFilename;
+		/** Full name of the world asset, the key of the embedded thumbnail in the package. */
+		FName WorldFullName;
+		FString CaptureFilename;
+		FString CacheFilename;
+	};
+
+	struct FDecoded
+	{
+		FName PackageName;
+		TArray<uint8> Pixels;
+		FIntPoint Size = FIntPoint::ZeroValue;
+	};
+
+	struct FEntry
+	{
+		TSharedPtr<FSlateDynamicImageBrush> Brush;
+		int64 Bytes = 0;
+	};
+
+	bool OnTick(float DeltaTime);
+	/** A saved map may have got an embedded thumbnail, it is looked for again on its next paint. */
+	void OnPackageSaved(const FString& PackageFilename, UPackage* Package, FObjectPostSaveContext ObjectSaveContext);
+	void DispatchRequests();
+	void AddDecoded(FDecoded& Decoded);
+	void EvictToBudget();
+	int64 GetMemoryBudgetBytes() const;
+
+	static FDecoded Decode(const FRequest& Request);
+	static bool DecodePng(const FString& Filename, FDecoded& OutDecoded);
+	static bool ReadEmbeddedThumbnail(const FRequest& Request, FDecoded& OutDecoded);
+	static void ScaleAndStore(TArray<FColor>& Pixels, FIntPoint& Size, const FString& Filename);
+	static void ToBrushPixels(const TArray<FColor>& Pixels, FIntPoint Size, FDecoded& OutDecoded);
+
+	static FString GetThumbnailDirectory();
+	static FString GetThumbnailBaseFilename(FName PackageName);
+
+	TLruCache<FName, FEntry> Entries;
+	int64 TotalBytes = 0;
+
+	/** Levels without any thumbnail, not asked for again until a capture is stored or the level is saved. */
+	TSet<FName> MissingThumbnails;
+
+	/** Newest request last, older ones are dropped when rows scrolled past them. */
+	TArray<FName> PendingRequests;
+	TSet<FName> InFlight;
+	TArray<UE::Tasks::TTask<FDecoded>> DecodeTasks;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	uint32 Revision = 0;
+	bool bInitialized = false;
+};
@@ -9,13 +9,38 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Editor.h"
 #include "Widgets/SCompoundWidget.h"
 #include "Widgets/Input/SComboButton.h"
+#include "Widgets/Views/SListView.h"
+#include "LevelSelectorSearchIndex.h"
 
+class FLevelEditorViewportClient;
+class FMenuBuilder;
+class SBox;
 class SEditableTextBox;
+class SHorizontalBox;
+class SImage;
 struct FSlateRoundedBoxBrush;
 class UBDC_LevelSelectorSettings;
 
+/** One camera favorite in the favorites menu of the overlay. */
+struct FLevelSelectorCameraMenuItem
+{
+	FName Name;
+	FText NameText;
+	FTransform Transform;
+	/** Distance to the camera when the menu opened, negative if the menu is in stored order or it was not needed yet. */
+	double Distance = -1.0;
+	/** Position in the menu as opened, INDEX_NONE if outside the menu radius. Search results are sorted back into it, those outside the radius follow by distance. */
+	int32 Order = INDEX_NONE;
+};
+
+/**
+ * Viewport overlay to store and jump to camera favorites of the current level. It binds no attributes; its state is
+ * pushed into the widgets when the editor map changes, the favorites change or it is collapsed, so it can stay cached in an
+ * invalidation panel between those events.
+ */
 class SLevelSelectorCameraOverlay : public SCompoundWidget
 {
 public:
@@ -23,24 +48,99 @@ public:
 	SLATE_END_ARGS()
 
 	void Construct(const FArguments& InArgs);
-	bool IsFavListEnabled() const;
+	virtual ~SLevelSelectorCameraOverlay() override;
+
+	/** True if the current level has camera favorites, as of the last map change or favorite change. */
+	bool IsFavListEnabled() const { return bHasFavorites; }
+
+	/** Counted as Camera Overlay Paint, compare it with LevelSelector.Overlay.Cache on and off to see what the invalidation panel saves. */
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements,
+		int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
 
 private:
+	/** Loading, creating, saving as and tearing down a map all change the level the favorites apply to. */
+	void HandleMapChanged(UWorld* World, EMapChangeType MapChangeType);
+	void HandleCameraFavoritesChanged(const FSoftObjectPath& LevelPath);
+	/** Re-reads the current level and whether it has favorites. */
+	void RefreshFavoriteState();
+	void UpdateCollapseState();
+
 	UBDC_LevelSelectorSettings* GetSettings() const;
 	void GetCurrentLevelSoftPtr(TSoftObjectPtr<UWorld>& OutLevelPtr) const;
 	
 	FReply OnAddClicked();
 	TSharedRef<SWidget> OnGetMenuContent();
+	/** Rebuilds the menu items and their search index from the favorites of the current level. */
+	void RebuildMenuItems();
+	/** Orders the menu items nearest first from the camera, or in stored order without a viewport. Keeps the order while the camera stays put. */
+	void SortMenuItems();
+	void FilterMenuItems();
+	TSharedRef<ITableRow> OnGenerateMenuRow(TSharedPtr<FLevelSelectorCameraMenuItem> Item, const TSharedRef<STableViewBase>& OwnerTable);
+	void OnMenuSearchChanged(const FText& Text);
+	void OnMenuSearchCommitted(const FText& Text, ETextCommit::Type CommitType);
+	FReply OnMenuSearchKeyDown(const FGeometry& MyGeometry, const FKeyEvent& KeyEvent);
+	void OnMenuItemClicked(TSharedPtr<FLevelSelectorCameraMenuItem> Item);
 	FReply OnTeleportClicked(FName Key, FTransform Transform);
+	FReply OnNearestClicked();
+	/** Steps to the next or previous favorite by distance from where the walk started. */
+	FReply OnStepClicked(bool bForward);
+	TSharedRef<SWidget> OnGetBulkMenuContent();
+	void MakeActorQueryMenu(FMenuBuilder& MenuBuilder);
+	void OnAddFromSelectionClicked();
+	void OnAddFromQueryClicked();
+	void OnImportClicked();
+	void OnExportClicked();
 	FReply OnEditItemClicked(FName Key);
 	FReply OnDeleteItemClicked(FName Key);
 
 	FReply OnToggleCollapse();
-	void GetCollapseIcon(const FSlateBrush*& OutBrush) const;
-	void GetContentVisibility(EVisibility& OutVisibility) const;
+
+	FLevelEditorViewportClient* GetActiveViewportClient() const;
+	void TeleportTo(const FTransform& Transform);
 
 	TSharedPtr<SEditableTextBox> NameInputBox;
 	TSharedPtr<SComboButton> FavComboButton;
+	TSharedPtr<SImage> CollapseImage;
+	TSharedPtr<SBox> ContentBox;
+	TSharedPtr<SHorizontalBox> NavigationBox;
 	bool bIsCollapsed;
+	bool bHasFavorites = false;
+	FSoftObjectPath CurrentLevelPath;
+
+	/** Criteria of the actor query in the bulk menu, kept while the overlay lives so a query can be repeated. */
+	FString ActorQueryClassName;
+	FString ActorQueryTag;
+	FString ActorQueryDataLayer;
+	double ActorQueryViewDistance = 0.0;
+
+	/** Origin and position of the current next/previous walk, it goes on while the camera stays at LastStepLocation. */
+	FVector StepOrigin = FVector::ZeroVector;
+	FVector LastStepLocation = FVector::ZeroVector;
+	double StepDistance = 0.0;
+	FName StepName;
+	bool bIsStepping = false;
+
+	/** Items of all favorites by search id, the search index over their names and the items as currently listed. */
+	TArray<TSharedPtr<FLevelSelectorCameraMenuItem>> MenuItems;
+	TMap<FName, TSharedPtr<FLevelSelectorCameraMenuItem>> MenuItemsByName;
+	TArray<TSharedPtr<FLevelSelectorCameraMenuItem>> OrderedMenuItems;
+	TArray<TSharedPtr<FLevelSelectorCameraMenuItem>> FilteredMenuItems;
+	/** Items outside the menu radius that a search gave a distance, reset with the order. */
+	TArray<TSharedPtr<FLevelSelectorCameraMenuItem>> OutOfRadiusMenuItems;
+
+	/** Camera location and radius OrderedMenuItems was built for. */
+	FVector MenuOrderOrigin = FVector::ZeroVector;
+	double MenuOrderRadius = 0.0;
+	bool bMenuOrderByDistance = false;
+	bool bMenuOrderValid = false;
+	/** FilteredMenuItems holds OrderedMenuItems unfiltered. */
+	bool bMenuUnfiltered = false;
+	FLevelSelectorSearchIndex MenuSearchIndex;
+	FText MenuSearchText;
+	FString MenuFoldedQuery;
+	bool bMenuItemsDirty = true;
+	TSharedPtr<SListView<TSharedPtr<FLevelSelectorCameraMenuItem>>> MenuListView;
+	TSharedPtr<SEditableTextBox> MenuSearchBox;
+
 	TSharedPtr<FSlateRoundedBoxBrush> BackgroundBrush;
 };
\ No newline at end of file
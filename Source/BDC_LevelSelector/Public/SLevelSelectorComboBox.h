@@ -9,83 +9,147 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/Ticker.h"
 #include "Widgets/SCompoundWidget.h"
-#include "Widgets/Input/SComboBox.h"
+#include "Widgets/Views/SListView.h"
+#include "Widgets/Views/STreeView.h"
 #include "GameplayTagContainer.h"
-#include "Templates/UniquePtr.h"
+#include "LevelSelectorIndex.h"
+#include "LevelSelectorPathTrie.h"
+#include "BDC_LevelSelectorUserSettings.h"
 
-struct FAssetData;
 class SBox;
+class SComboButton;
+class SLevelSelectorRow;
+class FLevelSelectorPrefetcher;
+class FLevelSelectorSwitchTelemetry;
+class FLevelSelectorMetadataCache;
+class FLevelSelectorThumbnailCache;
 struct FSlateBrush;
 class UWorld;
-class UTexture2D;
-
-DECLARE_DELEGATE_OneParam(FOnGameplayTagChanged, const FGameplayTag);
-
-struct FLevelSelectorItem
-{
-	FString DisplayName;
-	FString PackagePath;
-	FAssetData AssetData;
-
-	explicit FLevelSelectorItem(const FAssetData& InAssetData);
-
-	static TSharedRef<FLevelSelectorItem> Create(const FAssetData& InAssetData)
-	{
-		return MakeShareable(new FLevelSelectorItem(InAssetData));
-	}
-
-	bool IsFavorite() const;
-};
 
 class BDC_LEVELSELECTOR_API SLevelSelectorComboBox : public SCompoundWidget
 {
 public:
 	SLATE_BEGIN_ARGS(SLevelSelectorComboBox) {}
+		SLATE_ARGUMENT(TSharedPtr<FLevelSelectorIndex>, LevelIndex)
+		/** Optional, warms the level under the mouse. */
+		SLATE_ARGUMENT(TSharedPtr<FLevelSelectorPrefetcher>, Prefetcher)
+		/** Optional, times switches started from the dropdown and feeds the open time badges and sort mode. */
+		SLATE_ARGUMENT(TSharedPtr<FLevelSelectorSwitchTelemetry>, SwitchTelemetry)
+		/** Optional, provides the size badges of the rows and the disk size sort mode. */
+		SLATE_ARGUMENT(TSharedPtr<FLevelSelectorMetadataCache>, MetadataCache)
+		/** Optional, provides the level thumbnails of the rows. */
+		SLATE_ARGUMENT(TSharedPtr<FLevelSelectorThumbnailCache>, ThumbnailCache)
 	SLATE_END_ARGS();
 
 	void Construct(const FArguments& InArgs);
 	virtual ~SLevelSelectorComboBox() override;
 
 private:
-	void PopulateLevelList();
 	void RefreshSelection(const FString& MapPath, bool bStrict = true);
-	void SortLevelList();
 	void OnComboBoxOpening();
+	void OnMenuOpenChanged(bool bIsOpen);
+	void OnLevelRowHovered(const TSharedPtr<FLevelSelectorItem>& InItem);
+	void OnLevelRowUnhovered();
 	void EnsureSelectedCurrentLevel(bool bStrict);
 	void HandleMapOpened(const FString& Filename, bool bAsTemplate);
-	void OnAssetRegistryFilesLoaded();
+	void HandleLevelIndexChanged(const FLevelSelectorIndexDelta& Delta);
 
-	TSharedRef<SWidget> OnGenerateComboWidget(TSharedPtr<FLevelSelectorItem> InItem);
+	TSharedRef<SWidget> CreateMenuContent();
+	TSharedRef<SWidget> CreateFilterHeaderWidget();
+	TSharedRef<ITableRow> OnGenerateLevelRow(TSharedPtr<FLevelSelectorItem> InItem, const TSharedRef<STableViewBase>& OwnerTable);
+	void OnLevelRowReleased(const TSharedRef<ITableRow>& InRow);
 	void OnSelectionChanged(TSharedPtr<FLevelSelectorItem> InItem, ESelectInfo::Type SelectInfo);
-	TSharedRef<SWidget> CreateLevelItemWidget(const TSharedPtr<FLevelSelectorItem>& InItem);
+	void OpenLevel(const TSharedPtr<FLevelSelectorItem>& InItem);
+	/** Opens a level with the camera at one of its favorites, loading only the region around it in World Partition levels. */
+	void OpenLevelAtFavorite(const TSharedPtr<FLevelSelectorItem>& InItem, FName FavoriteName);
 	TSharedRef<SWidget> CreateSelectedItemWidget(const TSharedPtr<FLevelSelectorItem>& InItem);
-	TSharedRef<SWidget> CreateTagSelectionWidget(const TSharedPtr<FLevelSelectorItem>& InItem);
+	void CloseMenu();
+	void OnToggleFavorite(const TSharedPtr<FLevelSelectorItem>& InItem);
 	void OnFavoriteCheckboxChanged(ECheckBoxState NewState, TSharedPtr<FLevelSelectorItem> InItem);
-	void OnTagChanged(const TSharedPtr<FLevelSelectorItem>& InItem, FGameplayTag NewTag);
-
-	void ApplyFilters();
-	bool IsHeaderItem(const TSharedPtr<FLevelSelectorItem>& InItem) const;
-	FGameplayTag GetItemTag(const TSharedPtr<FLevelSelectorItem>& InItem) const;
+	void OnTagsChanged(const TSharedPtr<FLevelSelectorItem>& InItem, const FGameplayTagContainer& NewTags);
+
+	void ApplyFilters(bool bForceFullPass = false);
+	bool IsRefinementOfAppliedFilters() const;
+	void RefineAppliedFilters();
+	bool PassesFilters(const TSharedPtr<FLevelSelectorItem>& InItem) const;
+	void InsertFiltered(const TSharedPtr<FLevelSelectorItem>& InItem);
+	/** Sorts the items and merges them into LevelListSource in one pass. */
+	void MergeFiltered(TArray<TSharedPtr<FLevelSelectorItem>>& InItems);
+	bool CompareListItems(const TSharedPtr<FLevelSelectorItem>& A, const TSharedPtr<FLevelSelectorItem>& B) const;
+	void SortLevelListSource();
+	/** Queues the levels of the list whose size is not known yet, when sorting by or hiding on disk size only. */
+	void RequestMissingMetadata();
+	bool NeedsMetadata() const;
+	/** Levels not measured yet are not heavy, they are hidden once their size arrives. */
+	bool IsHeavyLevel(const FLevelSelectorItem& InItem) const;
+	void SetHideHeavyLevels(bool bInHideHeavyLevels);
+	bool OnMetadataResortTick(float DeltaTime);
+	TSharedRef<SWidget> CreateSortMenuContent();
+	void SetSortMode(ELevelSelectorSortMode InSortMode);
+	void HandleSwitchRecorded(FName PackageName);
+	void HandleMetadataUpdated();
+	const FLevelSelectorTagIndex::FQuery& GetTagQuery() const;
 	void OnSearchTextChanged(const FText& InText);
 	void OnSearchTextCommitted(const FText& InText, ETextCommit::Type CommitType);
-	void OnFilterTagChanged(FGameplayTag InTag);
+	void OnFilterTagsChanged(const FGameplayTagContainer& InTags);
+	FReply OnTagMatchClicked();
+	FText GetTagMatchText() const;
 	FReply OnClearFilterClicked();
 
+	TSharedRef<ITableRow> OnGenerateTreeRow(TSharedPtr<FLevelSelectorTreeNode> InNode, const TSharedRef<STableViewBase>& OwnerTable);
+	void OnGetTreeChildren(TSharedPtr<FLevelSelectorTreeNode> InNode, TArray<TSharedPtr<FLevelSelectorTreeNode>>& OutChildren);
+	void OnTreeSelectionChanged(TSharedPtr<FLevelSelectorTreeNode> InNode, ESelectInfo::Type SelectInfo);
+	void SetShowFolderTree(bool bInShowFolderTree);
+	/** Builds the path trie on first use, the list mode never pays for it. */
+	void EnsurePathTrie();
+	/** Applies the current filters to the tree and expands the folders leading to matches. */
+	void RefreshTree();
+	/** Expands the folders above a level and selects it in the tree. */
+	void RevealInTree(const FLevelSelectorItem& InItem);
+
 	FReply OnRefreshButtonClicked();
 	FReply OnShowInContentBrowserClicked(const TSharedPtr<FLevelSelectorItem>& InItem) const;
 
-	TArray<TSharedPtr<FLevelSelectorItem>> AllLevels;
+	TSharedPtr<FLevelSelectorIndex> LevelIndex;
+	TSharedPtr<FLevelSelectorPrefetcher> Prefetcher;
+	TSharedPtr<FLevelSelectorSwitchTelemetry> SwitchTelemetry;
+	TSharedPtr<FLevelSelectorMetadataCache> MetadataCache;
+	TSharedPtr<FLevelSelectorThumbnailCache> ThumbnailCache;
 	TArray<TSharedPtr<FLevelSelectorItem>> LevelListSource;
-	TSharedPtr<FLevelSelectorItem> HeaderItem;
 
-	TSharedPtr<SComboBox<TSharedPtr<FLevelSelectorItem>>> LevelComboBox;
+	TSharedPtr<SComboButton> LevelComboButton;
+	TSharedPtr<SListView<TSharedPtr<FLevelSelectorItem>>> LevelListView;
+	/** Rows scrolled out of view, handed out again before a new row is constructed. */
+	TArray<TSharedRef<SLevelSelectorRow>> RowPool;
+	TSharedPtr<STreeView<TSharedPtr<FLevelSelectorTreeNode>>> LevelTreeView;
+	TSharedPtr<FLevelSelectorPathTrie> PathTrie;
+	TArray<TSharedPtr<FLevelSelectorTreeNode>> TreeRootItems;
+	FLevelSelectorTreeFilter TreeFilter;
+	bool bShowFolderTree = false;
+	bool bHideHeavyLevels = false;
 	TSharedPtr<SBox> ComboBoxContentContainer;
 	TSharedPtr<class SEditableTextBox> SearchTextBoxWidget;
-	TSharedPtr<class SGameplayTagCombo> FilterTagComboWidget;
 
 	FText SearchTextFilter;
-	FGameplayTag SelectedFilterTag;
+	FString SearchTextFolded;
+
+	/** Query and tags LevelListSource was last filtered with, used to narrow it down instead of refiltering the index. */
+	FString AppliedSearchFolded;
+	FGameplayTagContainer AppliedFilterTags;
+	ELevelSelectorTagMatch AppliedTagMatch = ELevelSelectorTagMatch::Any;
+	bool bHasAppliedFilters = false;
+	FGameplayTagContainer SelectedFilterTags;
+	ELevelSelectorTagMatch TagMatch = ELevelSelectorTagMatch::Any;
+
+	/** SelectedFilterTags compiled against the tag bits of the index, recompiled when they changed. */
+	mutable FLevelSelectorTagIndex::FQuery TagQuery;
+	mutable bool bTagQueryDirty = true;
+	ELevelSelectorSortMode SortMode = ELevelSelectorSortMode::Name;
+
+	/** Resorts the list once per interval while sizes arrive, instead of once per collected batch. */
+	FTSTicker::FDelegateHandle MetadataResortTickerHandle;
 
 	const FSlateBrush* DefaultLevelIcon;
 	const FSlateBrush* RefreshIconBrush;
@@ -93,10 +157,4 @@ private:
 	const FSlateBrush* FavoriteIconBrush;
 	const FSlateBrush* UnfavoriteIconBrush;
 
-	UTexture2D* FavoriteIconTextureTrue = nullptr;
-	UTexture2D* FavoriteIconTextureFalse = nullptr;
-
-	TUniquePtr<FSlateBrush> FavoriteOwnedBrush;
-	TUniquePtr<FSlateBrush> UnfavoriteOwnedBrush;
-
 };
@@ -0,0 +1,119 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Widgets/Views/STableRow.h"
+#include "LevelSelectorIndex.h"
+
+class SComboButton;
+class FLevelSelectorSwitchTelemetry;
+class FLevelSelectorMetadataCache;
+class FLevelSelectorThumbnailCache;
+struct FSlateBrush;
+
+DECLARE_DELEGATE_OneParam(FOnLevelRowAction, const TSharedPtr<FLevelSelectorItem>&);
+DECLARE_DELEGATE_TwoParams(FOnLevelRowTagsChanged, const TSharedPtr<FLevelSelectorItem>&, const FGameplayTagContainer&);
+DECLARE_DELEGATE_TwoParams(FOnLevelRowOpenAtFavorite, const TSharedPtr<FLevelSelectorItem>&, FName /*FavoriteName*/);
+
+/**
+ * One row of the level list. Rows are pooled by the owning list and rebound to another item with SetItem,
+ * so everything shown is read from the current item through attributes instead of being baked in on construction.
+ */
+class SLevelSelectorRow : public STableRow<TSharedPtr<FLevelSelectorItem>>
+{
+public:
+	SLATE_BEGIN_ARGS(SLevelSelectorRow) {}
+		SLATE_ARGUMENT(TSharedPtr<FLevelSelectorItem>, Item)
+		SLATE_ARGUMENT(const FSlateBrush*, LevelIcon)
+		SLATE_ARGUMENT(const FSlateBrush*, FavoriteIcon)
+		SLATE_ARGUMENT(const FSlateBrush*, UnfavoriteIcon)
+		/** Optional, shows the recorded open times of the level. */
+		SLATE_ARGUMENT(TSharedPtr<FLevelSelectorSwitchTelemetry>, SwitchTelemetry)
+		/** Optional, shows size, last change and actor count of the level once they were collected. */
+		SLATE_ARGUMENT(TSharedPtr<FLevelSelectorMetadataCache>, MetadataCache)
+		/** Optional, replaces LevelIcon with the level's thumbnail once it was decoded. */
+		SLATE_ARGUMENT(TSharedPtr<FLevelSelectorThumbnailCache>, ThumbnailCache)
+		SLATE_EVENT(FOnLevelRowAction, OnToggleFavorite)
+		SLATE_EVENT(FOnLevelRowAction, OnShowInContentBrowser)
+		SLATE_EVENT(FOnLevelRowTagsChanged, OnTagsChanged)
+		/** Optional, offers to open the level at one of its camera favorites. */
+		SLATE_EVENT(FOnLevelRowOpenAtFavorite, OnOpenAtFavorite)
+		SLATE_EVENT(FOnLevelRowAction, OnHovered)
+		SLATE_EVENT(FSimpleDelegate, OnUnhovered)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTable);
+
+	/** Binds a recycled row to another item. */
+	void SetItem(const TSharedPtr<FLevelSelectorItem>& InItem);
+	const TSharedPtr<FLevelSelectorItem>& GetItem() const { return Item; }
+
+	//~ Begin SWidget Interface
+	virtual void OnMouseEnter(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual void OnMouseLeave(const FPointerEvent& MouseEvent) override;
+	//~ End SWidget Interface
+
+private:
+	FText GetDisplayNameText() const;
+	const FSlateBrush* GetLevelIconBrush() const;
+	FText GetTagText() const;
+	FText GetOpenTimeText() const;
+	FText GetOpenTimeToolTipText() const;
+	EVisibility GetOpenTimeVisibility() const;
+	void UpdateOpenTimeTexts() const;
+	FText GetMetadataText() const;
+	FText GetMetadataToolTipText() const;
+	FSlateColor GetMetadataColor() const;
+	void UpdateMetadataTexts() const;
+	const FSlateBrush* GetFavoriteBrush() const;
+
+	FReply OnFavoriteClicked();
+	FReply OnShowInContentBrowserClicked();
+	/** Builds the tag picker only when the tag button is opened. */
+	TSharedRef<SWidget> OnGetTagMenuContent();
+	/** Load radius and the camera favorites of the level, grouped by name prefix when there are many. Read only when the button is opened. */
+	TSharedRef<SWidget> OnGetOpenAtFavoriteMenuContent();
+	EVisibility GetOpenAtFavoriteVisibility() const;
+
+	TSharedPtr<FLevelSelectorItem> Item;
+	TSharedPtr<SComboButton> TagComboButton;
+	TSharedPtr<SComboButton> OpenAtFavoriteComboButton;
+	TSharedPtr<FLevelSelectorSwitchTelemetry> SwitchTelemetry;
+	TSharedPtr<FLevelSelectorMetadataCache> MetadataCache;
+	TSharedPtr<FLevelSelectorThumbnailCache> ThumbnailCache;
+
+	const FSlateBrush* LevelIcon = nullptr;
+	const FSlateBrush* FavoriteIcon = nullptr;
+	const FSlateBrush* UnfavoriteIcon = nullptr;
+
+	FOnLevelRowAction OnToggleFavorite;
+	FOnLevelRowAction OnShowInContentBrowser;
+	FOnLevelRowTagsChanged OnTagsChanged;
+	FOnLevelRowOpenAtFavorite OnOpenAtFavorite;
+	FOnLevelRowAction OnHovered;
+	FSimpleDelegate OnUnhovered;
+
+	/** Texts of the bound item, rebuilt only when the item or its tags change instead of every paint. */
+	FText DisplayNameText;
+	mutable FGameplayTagContainer CachedTags;
+	mutable FText CachedTagText;
+
+	/** Open time badge, rebuilt when the item changes or the telemetry recorded another switch. */
+	mutable uint32 CachedTelemetryRevision = MAX_uint32;
+	mutable FText CachedOpenTimeText;
+	mutable FText CachedOpenTimeToolTipText;
+
+	/** Metadata badge, rebuilt when the item changes or the metadata cache applied new results. */
+	mutable uint32 CachedMetadataRevision = MAX_uint32;
+	mutable FText CachedMetadataText;
+	mutable FText CachedMetadataToolTipText;
+	mutable bool bCachedIsHeavy = false;
+};
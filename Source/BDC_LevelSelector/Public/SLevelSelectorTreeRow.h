@@ -0,0 +1,41 @@
+/* Copyright © beginning at 2025 - BlackDevilCreations
+* Author: Patrick Wenzel
+* All rights reserved.
+* This file and the corresponding Definition is part of a BlackDevilCreations project and may not be distributed, copied,
+* or modified without prior written permission from BlackDevilCreations.
+* Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+* and are used with permission.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/Views/STableRow.h"
+#include "LevelSelectorPathTrie.h"
+
+struct FSlateBrush;
+
+/** One folder or level of the folder tree. Folders show how many levels they hold below them. */
+class SLevelSelectorTreeRow : public STableRow<TSharedPtr<FLevelSelectorTreeNode>>
+{
+public:
+	SLATE_BEGIN_ARGS(SLevelSelectorTreeRow) {}
+		SLATE_ARGUMENT(TSharedPtr<FLevelSelectorTreeNode>, Node)
+		SLATE_ARGUMENT(const FSlateBrush*, LevelIcon)
+		SLATE_ARGUMENT(const FSlateBrush*, FavoriteIcon)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTable);
+
+private:
+	const FSlateBrush* GetIconBrush() const;
+	FText GetCountText() const;
+	EVisibility GetFavoriteVisibility() const;
+
+	TSharedPtr<FLevelSelectorTreeNode> Node;
+	const FSlateBrush* LevelIcon = nullptr;
+	const FSlateBrush* FavoriteIcon = nullptr;
+
+	/** Level count text, rebuilt only when the count of the folder changed. */
+	mutable int32 CachedCount = INDEX_NONE;
+	mutable FText CachedCountText;
+};